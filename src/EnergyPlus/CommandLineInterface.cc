@@ -411,6 +411,7 @@ namespace CommandLineInterface {
         outputShdFileName = outputFilePrefix + normalSuffix + ".shd";
         outputDfsFileName = outputFilePrefix + normalSuffix + ".dfs";
         outputGLHEFileName = outputFilePrefix + normalSuffix + ".glhe";
+        outputFDGroundTempFileName = outputFilePrefix + normalSuffix + ".fdgt";
         outputEddFileName = outputFilePrefix + normalSuffix + ".edd";
         outputIperrFileName = outputFilePrefix + normalSuffix + ".iperr";
         outputSlnFileName = outputFilePrefix + normalSuffix + ".sln";
@@ -1927,6 +1927,10 @@ namespace CondenserLoopTowers {
                                                this->BranchNum,
                                                this->CompNum);
 
+            // Sized and design values may change between environments
+            this->MerkelModelMemo.clear();
+            this->VSRangeMemo.clear();
+
             this->envrnFlag = false;
         }
 
@@ -5035,7 +5039,7 @@ namespace CondenserLoopTowers {
         }
 
         if ((MinSpeedFanQdot < std::abs(MyLoad)) && (std::abs(MyLoad) < FullSpeedFanQdot)) {
-            // load can be refined by modulating fan speed, call regula-falsi
+            // load can be refined by modulating fan speed, use Newton's method and fall back to regula-falsi
 
             Par(1) = double(this->thisTowerNum);
             Par(2) = MyLoad;
@@ -5046,8 +5050,10 @@ namespace CondenserLoopTowers {
             Par(7) = CpWater;
             Par(8) = this->WaterMassFlowRate;
 
-            auto f = std::bind(&CoolingTower::residualMerkelLoad, this, std::placeholders::_1, std::placeholders::_2);
-            General::SolveRoot(Acc, MaxIte, SolFla, this->__AirFlowRateRatio, f, this->MinimumVSAirFlowFrac, 1.0, Par);
+            if (!this->solveMerkelAirFlowRatio(Par, MinSpeedFanQdot, FullSpeedFanQdot, Acc)) {
+                auto f = std::bind(&CoolingTower::residualMerkelLoad, this, std::placeholders::_1, std::placeholders::_2);
+                General::SolveRoot(Acc, MaxIte, SolFla, this->__AirFlowRateRatio, f, this->MinimumVSAirFlowFrac, 1.0, Par);
+            }
 
             if (SolFla == -1) {
                 if (!DataGlobals::WarmupFlag) {
@@ -5103,6 +5109,97 @@ namespace CondenserLoopTowers {
         }
     }
 
+    bool CoolingTower::solveMerkelAirFlowRatio(Array1<Real64> const &Par,     // parameters passed to residualMerkelLoad
+                                               Real64 const MinSpeedFanQdot,  // heat rejection rate at the minimum fan speed ratio [W]
+                                               Real64 const FullSpeedFanQdot, // heat rejection rate at full fan speed [W]
+                                               Real64 const Acc               // required accuracy of the residual [W]
+    )
+    {
+
+        // PURPOSE OF THIS FUNCTION:
+        // Finds the fan speed ratio at which the Merkel variable speed tower meets the load in Par(2) using
+        // Newton's method.  Returns false when Newton's method does not converge, so the caller can use
+        // regula falsi instead.
+
+        // METHODOLOGY EMPLOYED:
+        // The heat rejected by one cell is Q = q * (Twater,in - Twb,in).  For a counterflow exchanger
+        //   q = (1 - E) / (1/Ca - E/Cw),  E = exp(-UA * (1/Ca - 1/Cw))
+        // whichever side has the smaller capacity.  Ca is proportional to the fan speed ratio r, and UA scales
+        // with the UA air flow modifier curve f, so
+        //   dQ/dr = Q/q * (dq/dCa * Ca/r + dq/dUA * UA * f'(r)/f(r))
+        // where Ca and UA come from the last evaluation of the tower model.  The slope of the curve comes from a
+        // central difference.  The air side specific heat is held at the value of the current iterate.  A step
+        // that would leave the interval bracketing the root is replaced by bisection.
+
+        // FUNCTION PARAMETER DEFINITIONS:
+        int const MaxIte(50);            // Maximum number of Newton iterations
+        Real64 const CurveDelta(1.0e-4); // Fan speed ratio step for the UA air flow modifier curve slope
+
+        Real64 const TargetLoad = std::abs(Par(2));
+        Real64 const MdotCpWater = Par(3) * Par(7); // Water side capacity of one cell [W/C]
+
+        Real64 AirFlowRateRatioLow = this->MinimumVSAirFlowFrac;
+        Real64 AirFlowRateRatioHigh = 1.0;
+        Real64 _AirFlowRateRatio =
+            AirFlowRateRatioLow + (AirFlowRateRatioHigh - AirFlowRateRatioLow) * (TargetLoad - MinSpeedFanQdot) / (FullSpeedFanQdot - MinSpeedFanQdot);
+
+        for (int Iter = 1; Iter <= MaxIte; ++Iter) {
+            Real64 const Residual = this->residualMerkelLoad(_AirFlowRateRatio, Par);
+            if (std::abs(Residual) < Acc) {
+                this->__AirFlowRateRatio = _AirFlowRateRatio;
+                return true;
+            }
+            // the residual falls as the fan speed ratio rises
+            if (Residual > 0.0) {
+                AirFlowRateRatioLow = _AirFlowRateRatio;
+            } else {
+                AirFlowRateRatioHigh = _AirFlowRateRatio;
+            }
+
+            Real64 const Qdot = TargetLoad - Residual;
+            Real64 const AirCapacity = this->SimpleTowerAirCapacity;
+            Real64 const UAactual = this->SimpleTowerUAactual;
+            Real64 dQdotdRatio = 0.0;
+            if (Qdot > 0.0 && AirCapacity > 0.0 && UAactual > 0.0 && MdotCpWater > 0.0) {
+                Real64 const CapacityRatioMin = min(AirCapacity, MdotCpWater);
+                Real64 const CapacityRatio = CapacityRatioMin / max(AirCapacity, MdotCpWater);
+                Real64 q;     // heat rejected per unit water to air wet-bulb temperature difference [W/C]
+                Real64 dqdCa; // derivative of q with respect to the air side capacity [-]
+                Real64 dqdUA; // derivative of q with respect to UA [-]
+                if (CapacityRatio <= 0.995 && UAactual / CapacityRatioMin * (1.0 - CapacityRatio) < 700.0) {
+                    Real64 const InvCa = 1.0 / AirCapacity;
+                    Real64 const InvCw = 1.0 / MdotCpWater;
+                    Real64 const E = std::exp(-UAactual * (InvCa - InvCw));
+                    Real64 const Denom = InvCa - InvCw * E;
+                    q = (1.0 - E) / Denom;
+                    dqdUA = pow_2(InvCa - InvCw) * E / pow_2(Denom);
+                    dqdCa = -(UAactual * E * Denom - (1.0 - E) * (1.0 + InvCw * UAactual * E)) / pow_2(Denom) * pow_2(InvCa);
+                } else {
+                    q = UAactual * CapacityRatioMin / (UAactual + CapacityRatioMin);
+                    dqdUA = pow_2(CapacityRatioMin / (UAactual + CapacityRatioMin));
+                    dqdCa = (AirCapacity <= MdotCpWater) ? pow_2(UAactual / (UAactual + CapacityRatioMin)) : 0.0;
+                }
+                Real64 const RatioLow = max(_AirFlowRateRatio - CurveDelta, 0.0);
+                Real64 const RatioHigh = min(_AirFlowRateRatio + CurveDelta, 1.0);
+                Real64 const UAairflowAdjFac = CurveManager::CurveValue(this->UAModFuncAirFlowRatioCurvePtr, _AirFlowRateRatio);
+                Real64 const UAairflowAdjFacSlope = (CurveManager::CurveValue(this->UAModFuncAirFlowRatioCurvePtr, RatioHigh) -
+                                                     CurveManager::CurveValue(this->UAModFuncAirFlowRatioCurvePtr, RatioLow)) /
+                                                    (RatioHigh - RatioLow);
+                if (q > 0.0 && UAairflowAdjFac > 0.0) {
+                    dQdotdRatio = Qdot / q * (dqdCa * AirCapacity / _AirFlowRateRatio + dqdUA * UAactual * UAairflowAdjFacSlope / UAairflowAdjFac);
+                }
+            }
+
+            Real64 NewAirFlowRateRatio = AirFlowRateRatioLow - 1.0; // force bisection unless the Newton step is usable
+            if (dQdotdRatio > 0.0) NewAirFlowRateRatio = _AirFlowRateRatio + Residual / dQdotdRatio;
+            if (NewAirFlowRateRatio <= AirFlowRateRatioLow || NewAirFlowRateRatio >= AirFlowRateRatioHigh) {
+                NewAirFlowRateRatio = 0.5 * (AirFlowRateRatioLow + AirFlowRateRatioHigh);
+            }
+            _AirFlowRateRatio = NewAirFlowRateRatio;
+        }
+        return false;
+    }
+
     Real64 CoolingTower::residualMerkelLoad(Real64 _AirFlowRateRatio, // fan speed ratio (1.0 is continuous, 0.0 is off)
                                             Array1<Real64> const &Par // par(1) = Tower number
     )
@@ -5160,6 +5257,7 @@ namespace CondenserLoopTowers {
 
         // METHODOLOGY EMPLOYED:
         // See methodology for Single Speed or Two Speed tower model
+        // Results are kept in MerkelModelMemo and reused when the tower is evaluated again at the same conditions.
 
         // REFERENCES:
         // Merkel, F. 1925.  Verduftungskuhlung. VDI Forschungsarbeiten, Nr 275, Berlin.
@@ -5176,9 +5274,20 @@ namespace CondenserLoopTowers {
         Real64 _OutletWaterTemp = this->InletWaterTemp;
         Real64 InletAirTemp = this->AirTemp;       // Dry-bulb temperature of air entering the tower [C]
         Real64 InletAirWetBulb = this->AirWetBulb; // Wetbulb temp of entering moist air [C]
+        this->SimpleTowerAirCapacity = 0.0;
+        this->SimpleTowerUAactual = 0.0;
 
         if (UAdesign == 0.0) return _OutletWaterTemp;
 
+        HeatRejectionMemo::MemoKey const MemoKey{
+            {this->InletWaterTemp, _WaterMassFlowRate, AirFlowRate, UAdesign, InletAirTemp, InletAirWetBulb, this->AirPress, this->AirHumRat}};
+        HeatRejectionMemo::MemoResult MemoResult;
+        if (this->MerkelModelMemo.lookup(MemoKey, MemoResult)) {
+            this->SimpleTowerAirCapacity = MemoResult[1];
+            this->SimpleTowerUAactual = MemoResult[2];
+            return MemoResult[0];
+        }
+
         // set water and air properties
         Real64 AirDensity = Psychrometrics::PsyRhoAirFnPbTdbW(this->AirPress, InletAirTemp, this->AirHumRat); // Density of air [kg/m3]
         Real64 AirMassFlowRate = AirFlowRate * AirDensity;                                                    // Mass flow rate of air [kg/s]
@@ -5239,6 +5348,8 @@ namespace CondenserLoopTowers {
             }
             // calculate water to air heat transfer and store last exiting WB temp of air
             _Qactual = effectiveness * CapacityRatioMin * (this->InletWaterTemp - InletAirWetBulb);
+            this->SimpleTowerAirCapacity = AirCapacity;
+            this->SimpleTowerUAactual = UAactual;
             OutletAirWetBulbLast = OutletAirWetBulb;
             // calculate new exiting wet bulb temperature of airstream
             OutletAirWetBulb = InletAirWetBulb + _Qactual / AirCapacity;
@@ -5254,6 +5365,7 @@ namespace CondenserLoopTowers {
         } else {
             _OutletWaterTemp = this->InletWaterTemp;
         }
+        this->MerkelModelMemo.store(MemoKey, {{_OutletWaterTemp, this->SimpleTowerAirCapacity, this->SimpleTowerUAactual}});
         return _OutletWaterTemp;
     }
 
@@ -5276,6 +5388,7 @@ namespace CondenserLoopTowers {
         // The range temperature is varied to determine balance point where model output (Tapproach),
         // range temperature and inlet air wet-bulb temperature show a balance as:
         // Twb + Tapproach + Trange = Node(WaterInletNode)%Temp
+        // Converged results are kept in VSRangeMemo and reused when the tower is evaluated again at the same conditions.
 
         // REFERENCES:
         // Benton, D.J., Bowmand, C.F., Hydeman, M., Miller, P.,
@@ -5292,6 +5405,11 @@ namespace CondenserLoopTowers {
         int SolFla;             // Flag of solver
         Array1D<Real64> Par(4); // Parameter array for regula falsi solver
 
+        HeatRejectionMemo::MemoKey const MemoKey{
+            {this->WaterTemp, DataLoopNode::Node(this->WaterInletNodeNum).Temp, WaterFlowRateRatio, _AirFlowRateRatio, Twb, 0.0, 0.0, 0.0}};
+        HeatRejectionMemo::MemoResult MemoResult;
+        if (this->VSRangeMemo.lookup(MemoKey, MemoResult)) return MemoResult[0];
+
         //   determine tower outlet water temperature
         Par(1) = this->thisTowerNum; // Index to cooling tower
         Par(2) = WaterFlowRateRatio; // water flow rate ratio
@@ -5303,7 +5421,9 @@ namespace CondenserLoopTowers {
 
         Real64 _OutletWaterTemp = this->WaterTemp - Tr;
 
-        if (SolFla == -1) {
+        if (SolFla > 0) {
+            this->VSRangeMemo.store(MemoKey, {{_OutletWaterTemp, Tr, 0.0}});
+        } else if (SolFla == -1) {
             ShowSevereError("Iteration limit exceeded in calculating tower nominal capacity at minimum air flow ratio");
             ShowContinueError(
                 "Design inlet air wet-bulb or approach temperature must be modified to achieve an acceptable range at the minimum air flow rate");
@@ -54,6 +54,7 @@
 // EnergyPlus Headers
 #include <DataGlobals.hh>
 #include <EnergyPlus.hh>
+#include <HeatRejectionMemo.hh>
 #include <PlantComponent.hh>
 
 namespace EnergyPlus {
@@ -303,6 +304,12 @@ namespace CondenserLoopTowers {
         Real64 WaterFlowRateRatioLast; // value of WFRR when warning occurred (passed to Recurring Warn)
         Real64 LGLast;                 // value of LG when warning occurred (passed to Recurring Warn)
 
+        // Model result memos
+        HeatRejectionMemo::ModelMemo MerkelModelMemo; // recent results of calculateSimpleTowerOutletTemp
+        HeatRejectionMemo::ModelMemo VSRangeMemo;     // recent results of calculateVariableTowerOutletTemp
+        Real64 SimpleTowerAirCapacity;                // air side capacity of the last calculateSimpleTowerOutletTemp result [W/C]
+        Real64 SimpleTowerUAactual;                   // UA at actual conditions of the last calculateSimpleTowerOutletTemp result [W/C]
+
         // Hopefully temporary members
         int thisTowerNum; // regula falsi residual functions are static and so they need to get an index passed from a member function
 
@@ -345,7 +352,7 @@ namespace CondenserLoopTowers {
               MaxWaterFlowRatio(0.0), MaxLiquidToGasRatio(0.0), VSErrorCountFlowFrac(0), VSErrorCountWFRR(0), VSErrorCountIAWB(0), VSErrorCountTR(0),
               VSErrorCountTA(0), ErrIndexFlowFrac(0), ErrIndexWFRR(0), ErrIndexIAWB(0), ErrIndexTR(0), ErrIndexTA(0), ErrIndexLG(0),
               PrintTrMessage(false), PrintTwbMessage(false), PrintTaMessage(false), PrintWFRRMessage(false), PrintLGMessage(false), TrLast(0.0),
-              TwbLast(0.0), TaLast(0.0), WaterFlowRateRatioLast(0.0), LGLast(0.0), thisTowerNum(0)
+              TwbLast(0.0), TaLast(0.0), WaterFlowRateRatioLast(0.0), LGLast(0.0), SimpleTowerAirCapacity(0.0), SimpleTowerUAactual(0.0), thisTowerNum(0)
         {
         }
 
@@ -371,6 +378,12 @@ namespace CondenserLoopTowers {
 
         void calculateMerkelVariableSpeedTower(Real64 &MyLoad);
 
+        bool solveMerkelAirFlowRatio(Array1<Real64> const &Par, // parameters passed to residualMerkelLoad
+                                     Real64 MinSpeedFanQdot,    // heat rejection rate at the minimum fan speed ratio [W]
+                                     Real64 FullSpeedFanQdot,   // heat rejection rate at full fan speed [W]
+                                     Real64 Acc                 // required accuracy of the residual [W]
+        );
+
         void calculateVariableSpeedTower();
 
         Real64 calculateSimpleTowerOutletTemp(Real64 _WaterMassFlowRate, Real64 AirFlowRate, Real64 UAdesign);
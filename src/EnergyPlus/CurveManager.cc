@@ -2123,10 +2123,14 @@ namespace CurveManager {
         return (int)grids[gridIndex].get_ndims();
     }
 
-    double BtwxtManager::getGridValue(int gridIndex, int outputIndex, const std::vector<double> target) {
+    double BtwxtManager::getGridValue(int gridIndex, int outputIndex, const std::vector<double> &target) {
         return grids[gridIndex](target)[outputIndex];
     }
 
+    const Btwxt::GriddedData &BtwxtManager::getGridData(int gridIndex) {
+        return grids[gridIndex].get_grid_data();
+    }
+
     void BtwxtManager::normalizeGridValues(int gridIndex, int outputIndex, const std::vector<double> target, const double scalar) {
         grids[gridIndex].normalize_values_at_target(outputIndex, target, scalar);
     }
@@ -2489,6 +2493,164 @@ namespace CurveManager {
         return CurveValue;
     }
 
+    Real64 BtwxtTableValueAtTarget(int const CurveIndex, std::vector<double> const &target)
+    {
+        // PURPOSE OF THIS FUNCTION:
+        // Evaluates a Table:Lookup curve at a target that has already been limited to the variable ranges.
+
+        // METHODOLOGY EMPLOYED:
+        // Coil and chiller models call the same curve many times per timestep, usually at the same or nearby
+        // conditions, while btwxt relocates the grid cell, recomputes the weights and interpolates every table on
+        // the shared independent variable list on each call.  Each curve therefore keeps the cell of its last
+        // evaluation (TableCell): an exact repeat returns the stored value, and a new target in the same cell
+        // only updates the weights of the axes that moved and sums the stored corner values.  Cells are located
+        // and interpolated here only when every axis is linear and the target is inside the grid, where the
+        // result is identical to btwxt; cubic axes and extrapolation still go through btwxt.  btwxt issues no
+        // messages for such targets, so its message callback is only needed on the btwxt path.
+
+        auto &thisCurve(PerfCurve(CurveIndex));
+        auto &Cell(thisCurve.TableCell);
+        Real64 TableValue;
+        if (Cell.ValueValid && target == Cell.Target) {
+            TableValue = Cell.Value;
+        } else {
+            if (!Cell.GridChecked) {
+                Cell.LinearGrid = true;
+                for (auto const &Axis : btwxtManager.getGridData(thisCurve.TableIndex).grid_axes) {
+                    if (Axis.interpolation_method != Btwxt::Method::LINEAR) Cell.LinearGrid = false;
+                }
+                Cell.GridChecked = true;
+            }
+
+            bool InCell = Cell.CellValid && (target.size() == Cell.Weights.size());
+            if (InCell) {
+                for (std::size_t Dim = 0; Dim < target.size(); ++Dim) {
+                    if ((target[Dim] < Cell.Lower[Dim]) || (target[Dim] > Cell.Upper[Dim])) {
+                        InCell = false;
+                        break;
+                    }
+                }
+            }
+            if (InCell) {
+                // same cell as the last evaluation, so only the axes that moved need new weights
+                for (std::size_t Dim = 0; Dim < target.size(); ++Dim) {
+                    if (target[Dim] == Cell.Target[Dim]) continue;
+                    if (Cell.Upper[Dim] > Cell.Lower[Dim]) {
+                        Cell.Weights[Dim] = (target[Dim] - Cell.Lower[Dim]) / (Cell.Upper[Dim] - Cell.Lower[Dim]);
+                    } else {
+                        Cell.Weights[Dim] = 1.0;
+                    }
+                }
+            } else if (Cell.LinearGrid) {
+                InCell = LocateTableLookupCell(btwxtManager.getGridData(thisCurve.TableIndex), thisCurve.GridValueIndex, target, Cell);
+            }
+
+            if (InCell) {
+                TableValue = TableLookupCellValue(Cell);
+            } else {
+                std::string contextString = "Table:Lookup \"" + thisCurve.Name + "\"";
+                Btwxt::setMessageCallback(BtwxtMessageCallback, &contextString);
+                TableValue = btwxtManager.getGridValue(thisCurve.TableIndex, thisCurve.GridValueIndex, target);
+            }
+            Cell.Target = target;
+            Cell.Value = TableValue;
+            Cell.ValueValid = true;
+        }
+
+        if (thisCurve.CurveMinPresent) TableValue = max(TableValue, thisCurve.CurveMin);
+        if (thisCurve.CurveMaxPresent) TableValue = min(TableValue, thisCurve.CurveMax);
+
+        return TableValue;
+    }
+
+    bool LocateTableLookupCell(Btwxt::GriddedData const &GridData, // grid of the table
+                               std::size_t const OutputIndex,      // value table of the curve in the grid
+                               std::vector<double> const &target,  // independent variable values, limited to the variable ranges
+                               TableLookupCellData &Cell           // cell containing the target
+    )
+    {
+        // PURPOSE OF THIS FUNCTION:
+        // Finds the grid cell containing the target, its corner values and the target weights on each axis.
+        // Returns false (and invalidates the cell) when the target is outside the grid on any axis.
+
+        // METHODOLOGY EMPLOYED:
+        // The cell floor, weights and corner order follow btwxt (GridPoint::set_dim_floor, calculate_weights and
+        // set_hypercube): a target on the last grid value uses the last interval, an axis with a single value has
+        // a weight of one, and the corners are ordered with the first axis varying slowest.
+
+        std::size_t const NumDims = GridData.grid_axes.size();
+        Cell.CellValid = false;
+        if (target.size() != NumDims) return false;
+
+        Cell.Floor.resize(NumDims);
+        Cell.Lower.resize(NumDims);
+        Cell.Upper.resize(NumDims);
+        Cell.Weights.resize(NumDims);
+        for (std::size_t Dim = 0; Dim < NumDims; ++Dim) {
+            auto const &Axis(GridData.grid_axes[Dim]);
+            auto const &Grid(Axis.grid);
+            Real64 const X = target[Dim];
+            if ((X < Grid.front()) || (X > Grid.back()) || (X < Axis.extrapolation_limits.first) || (X > Axis.extrapolation_limits.second)) {
+                return false;
+            }
+            if (Grid.size() == 1u) {
+                Cell.Floor[Dim] = 0u;
+                Cell.Lower[Dim] = Grid[0];
+                Cell.Upper[Dim] = Grid[0];
+                Cell.Weights[Dim] = 1.0;
+            } else {
+                if (X == Grid.back()) {
+                    Cell.Floor[Dim] = Grid.size() - 2u;
+                } else {
+                    Cell.Floor[Dim] = std::upper_bound(Grid.begin(), Grid.end(), X) - Grid.begin() - 1;
+                }
+                Cell.Lower[Dim] = Grid[Cell.Floor[Dim]];
+                Cell.Upper[Dim] = Grid[Cell.Floor[Dim] + 1];
+                Cell.Weights[Dim] = (X - Cell.Lower[Dim]) / (Cell.Upper[Dim] - Cell.Lower[Dim]);
+            }
+        }
+
+        // value tables are stored with the last axis varying fastest
+        std::vector<std::size_t> StepSize(NumDims, 1u);
+        for (std::size_t Dim = NumDims - 1; Dim > 0; --Dim) {
+            StepSize[Dim - 1] = StepSize[Dim] * GridData.grid_axes[Dim].grid.size();
+        }
+        auto const &Values(GridData.value_tables[OutputIndex]);
+        Cell.Corners.resize(std::size_t(1) << NumDims);
+        for (std::size_t Corner = 0; Corner < Cell.Corners.size(); ++Corner) {
+            std::size_t ValueIndex = 0;
+            for (std::size_t Dim = 0; Dim < NumDims; ++Dim) {
+                std::size_t const Coord = Cell.Floor[Dim] + ((Corner >> (NumDims - 1 - Dim)) & 1u);
+                ValueIndex += std::min(Coord, GridData.grid_axes[Dim].grid.size() - 1) * StepSize[Dim];
+            }
+            Cell.Corners[Corner] = Values[ValueIndex];
+        }
+
+        Cell.CellValid = true;
+        return true;
+    }
+
+    Real64 TableLookupCellValue(TableLookupCellData const &Cell) // cell containing the target, with the target weights
+    {
+        // PURPOSE OF THIS FUNCTION:
+        // Multilinear interpolation of the cell corner values at the cell weights.
+
+        // METHODOLOGY EMPLOYED:
+        // Corner weights are products of (1 - weight) or weight on each axis, and corners are summed in the same
+        // order and with the same operations as btwxt (GridPoint::set_results), so results are identical.
+
+        std::size_t const NumDims = Cell.Weights.size();
+        Real64 Value = 0.0;
+        for (std::size_t Corner = 0; Corner < Cell.Corners.size(); ++Corner) {
+            Real64 Weight = 1.0;
+            for (std::size_t Dim = 0; Dim < NumDims; ++Dim) {
+                Weight *= ((Corner >> (NumDims - 1 - Dim)) & 1u) ? Cell.Weights[Dim] : 1.0 - Cell.Weights[Dim];
+            }
+            Value += Cell.Corners[Corner] * Weight;
+        }
+        return Value;
+    }
+
     Real64 BtwxtTableInterpolation(int const CurveIndex,        // index of curve in curve array
                                    Real64 const Var1,           // 1st independent variable
                                    Optional<Real64 const> Var2, // 2nd independent variable
@@ -2499,9 +2661,11 @@ namespace CurveManager {
     )
     {
       // TODO: Generalize for N-dims
+      std::vector<double> target;
+      target.reserve(6);
       Real64 var = Var1;
       var = max(min(var, PerfCurve(CurveIndex).Var1Max), PerfCurve(CurveIndex).Var1Min);
-      std::vector<double> target{var};
+      target.push_back(var);
       if (present(Var2)) {
         var = Var2;
         var = max(min(var, PerfCurve(CurveIndex).Var2Max), PerfCurve(CurveIndex).Var2Min);
@@ -2528,14 +2692,61 @@ namespace CurveManager {
         target.push_back(var);
       }
 
-      std::string contextString = "Table:Lookup \"" + PerfCurve(CurveIndex).Name + "\"";
-      Btwxt::setMessageCallback(BtwxtMessageCallback, &contextString);
-      Real64 TableValue = btwxtManager.getGridValue(PerfCurve(CurveIndex).TableIndex,PerfCurve(CurveIndex).GridValueIndex,target);
+      return BtwxtTableValueAtTarget(CurveIndex, target);
+    }
+
+    void TableLookupValues(int const CurveIndex,                            // index of a Table:Lookup curve in curve array
+                           std::vector<std::vector<Real64>> const &Targets, // independent variable values, one vector per point
+                           std::vector<Real64> &Values                      // curve results, one per point
+    )
+    {
+        // PURPOSE OF THIS SUBROUTINE:
+        // Evaluates a Table:Lookup curve at many points in one call for callers that need a set of
+        // results (e.g., one per speed or per operating point). Each point is limited to the variable
+        // ranges as in CurveValue, and EMS overrides and curve output reporting are applied as in CurveValue
+        // with the last point reported.
+
+        // METHODOLOGY EMPLOYED:
+        // Points are evaluated in order through BtwxtTableValueAtTarget, so consecutive points in the same grid
+        // cell reuse its corner values.  Ordering the points along each axis keeps most of them in the same cell.
+
+        if ((CurveIndex <= 0) || (CurveIndex > NumCurves)) {
+            ShowFatalError("TableLookupValues: Invalid curve passed.");
+        }
+        auto &thisCurve(PerfCurve(CurveIndex));
+        if (thisCurve.InterpolationType != BtwxtMethod) {
+            ShowFatalError("TableLookupValues: Curve \"" + thisCurve.Name + "\" is not a Table:Lookup object.");
+        }
+
+        std::vector<Real64> const VarMin{thisCurve.Var1Min, thisCurve.Var2Min, thisCurve.Var3Min, thisCurve.Var4Min, thisCurve.Var5Min, thisCurve.Var6Min};
+        std::vector<Real64> const VarMax{thisCurve.Var1Max, thisCurve.Var2Max, thisCurve.Var3Max, thisCurve.Var4Max, thisCurve.Var5Max, thisCurve.Var6Max};
 
-      if (PerfCurve(CurveIndex).CurveMinPresent) TableValue = max(TableValue, PerfCurve(CurveIndex).CurveMin);
-      if (PerfCurve(CurveIndex).CurveMaxPresent) TableValue = min(TableValue, PerfCurve(CurveIndex).CurveMax);
+        Values.resize(Targets.size());
+        std::vector<double> target;
+        target.reserve(VarMin.size());
+        for (std::size_t Point = 0; Point < Targets.size(); ++Point) {
+            auto const &thisTarget(Targets[Point]);
+            if (thisTarget.empty() || thisTarget.size() > VarMin.size()) {
+                ShowFatalError("TableLookupValues: Invalid number of independent variables for curve \"" + thisCurve.Name + "\".");
+            }
+            target.resize(thisTarget.size());
+            for (std::size_t Dim = 0; Dim < thisTarget.size(); ++Dim) {
+                target[Dim] = max(min(thisTarget[Dim], VarMax[Dim]), VarMin[Dim]);
+            }
+            Values[Point] = BtwxtTableValueAtTarget(CurveIndex, target);
+            if (thisCurve.EMSOverrideOn) Values[Point] = thisCurve.EMSOverrideCurveValue;
+        }
 
-      return TableValue;
+        if (!Targets.empty()) {
+            auto const &LastTarget(Targets.back());
+            thisCurve.CurveOutput = Values.back();
+            thisCurve.CurveInput1 = LastTarget[0];
+            if (LastTarget.size() > 1) thisCurve.CurveInput2 = LastTarget[1];
+            if (LastTarget.size() > 2) thisCurve.CurveInput3 = LastTarget[2];
+            if (LastTarget.size() > 3) thisCurve.CurveInput4 = LastTarget[3];
+            if (LastTarget.size() > 4) thisCurve.CurveInput5 = LastTarget[4];
+            if (LastTarget.size() > 5) thisCurve.CurveInput6 = LastTarget[5];
+        }
     }
 
     bool IsCurveInputTypeValid(std::string const &InInputType) // index of curve in curve array
@@ -158,6 +158,28 @@ namespace CurveManager {
         }
     };
 
+    struct TableLookupCellData
+    {
+        // Members
+        // this structure keeps the grid cell of the last Table:Lookup evaluation for reuse by the next one
+        bool GridChecked;               // TRUE once LinearGrid has been set from the grid
+        bool LinearGrid;                // TRUE when every axis of the grid uses linear interpolation (cell reuse is possible)
+        bool CellValid;                 // TRUE when Floor/Lower/Upper/Corners/Weights describe the cell of the last target
+        bool ValueValid;                // TRUE when Target/Value hold the last evaluation
+        std::vector<std::size_t> Floor; // grid index of the lower cell corner on each axis
+        std::vector<Real64> Lower;      // axis value at the lower cell corner on each axis
+        std::vector<Real64> Upper;      // axis value at the upper cell corner on each axis
+        std::vector<Real64> Corners;    // table values at the 2^N cell corners, first axis varying slowest
+        std::vector<Real64> Weights;    // fractional position of the last target in the cell on each axis
+        std::vector<Real64> Target;     // independent variable values (limited) of the last evaluation
+        Real64 Value;                   // interpolated table value (before curve min/max limits) of the last evaluation
+
+        // Default Constructor
+        TableLookupCellData() : GridChecked(false), LinearGrid(false), CellValid(false), ValueValid(false), Value(0.0)
+        {
+        }
+    };
+
     struct PerfomanceCurveData
     {
         // Members
@@ -224,6 +246,7 @@ namespace CurveManager {
         Real64 CurveInput4; // curve input #4 (e.g., X4 variable)
         Real64 CurveInput5; // curve input #5 (e.g., X5 variable)
         Real64 CurveInput6; // curve input #6 (e.g., X6 variable)
+        TableLookupCellData TableCell; // grid cell and result of the last Table:Lookup evaluation
 
         // Default Constructor
         PerfomanceCurveData()
@@ -275,7 +298,8 @@ namespace CurveManager {
         int getGridIndex(std::string indVarListName, bool &ErrorsFound);
         int getNumGridDims(int gridIndex);
         std::pair<double, double> getGridAxisLimits(int gridIndex, int axisIndex);
-        double getGridValue(int gridIndex, int outputIndex, const std::vector<double> target);
+        double getGridValue(int gridIndex, int outputIndex, const std::vector<double> &target);
+        const Btwxt::GriddedData &getGridData(int gridIndex);
         std::map<std::string, const json&> independentVarRefs;
         std::map<std::string, TableFile> tableFiles;
         void clear();
@@ -323,6 +347,18 @@ namespace CurveManager {
                                   Optional<Real64 const> Var4 = _  // 4th independent variable
     );
 
+    Real64 BtwxtTableValueAtTarget(int const CurveIndex,                // index of curve in curve array
+                                   std::vector<double> const &target // independent variable values, limited to the variable ranges
+    );
+
+    bool LocateTableLookupCell(Btwxt::GriddedData const &GridData, // grid of the table
+                               std::size_t const OutputIndex,      // value table of the curve in the grid
+                               std::vector<double> const &target,  // independent variable values, limited to the variable ranges
+                               TableLookupCellData &Cell           // cell containing the target
+    );
+
+    Real64 TableLookupCellValue(TableLookupCellData const &Cell); // cell containing the target, with the target weights
+
     Real64 BtwxtTableInterpolation(int const CurveIndex,            // index of curve in curve array
                                    Real64 const Var1,               // 1st independent variable
                                    Optional<Real64 const> Var2 = _, // 2nd independent variable
@@ -331,6 +367,11 @@ namespace CurveManager {
                                    Optional<Real64 const> Var5 = _, // 5th independent variable
                                    Optional<Real64 const> Var6 = _);
 
+    void TableLookupValues(int const CurveIndex,                            // index of a Table:Lookup curve in curve array
+                           std::vector<std::vector<Real64>> const &Targets, // independent variable values, one vector per point
+                           std::vector<Real64> &Values                      // curve results, one per point
+    );
+
     bool IsCurveInputTypeValid(std::string const &InInputType); // index of curve in curve array
 
     bool IsCurveOutputTypeValid(std::string const &InOutputType); // index of curve in curve array
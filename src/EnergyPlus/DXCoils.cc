@@ -11890,6 +11890,87 @@ namespace DXCoils {
         TotCapModFac = TotCapTempModFac * TotCapFlowModFac;
     }
 
+    void SetMSCoilInletState(int const DXCoilNum,              // the number of the multispeed DX coil
+                             Real64 const InletAirDryBulbTemp, // inlet air dry bulb temperature [C]
+                             Real64 const InletAirHumRat,      // inlet air humidity ratio [kg/kg]
+                             Real64 const Pressure,            // barometric pressure [Pa]
+                             Real64 const OutdoorTemp,         // condenser inlet or outdoor dry-bulb temperature [C]
+                             std::string const &CallingRoutine // routine name used in psychrometric warnings
+    )
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Maintains the inlet-dependent quantities of a multispeed DX coil. The multispeed coil models are
+        // called many times per iteration by the parent objects while they solve for part-load and speed ratios,
+        // and the inlet air and outdoor conditions do not change between those calls.
+
+        // METHODOLOGY EMPLOYED:
+        // The inlet wet-bulb temperature and air density are recalculated only when the inlet state differs from
+        // the cached state. The per-speed temperature modifier curve results are kept by MSCoilCurveValue.
+
+        auto &thisDXCoil(DXCoil(DXCoilNum));
+
+        if (thisDXCoil.MSCacheCapFTemp.Value.size() != static_cast<std::size_t>(thisDXCoil.NumOfSpeeds)) {
+            for (auto *cache : {&thisDXCoil.MSCacheCapFTemp, &thisDXCoil.MSCacheEIRFTemp}) {
+                cache->Value.dimension(thisDXCoil.NumOfSpeeds, 0.0);
+                cache->Input1.dimension(thisDXCoil.NumOfSpeeds, 0.0);
+                cache->Input2.dimension(thisDXCoil.NumOfSpeeds, 0.0);
+                cache->Valid.dimension(thisDXCoil.NumOfSpeeds, false);
+            }
+            thisDXCoil.MSCacheValid = false;
+        }
+
+        if (thisDXCoil.MSCacheValid && InletAirDryBulbTemp == thisDXCoil.MSCacheInletDBTemp && InletAirHumRat == thisDXCoil.MSCacheInletHumRat &&
+            Pressure == thisDXCoil.MSCachePressure && OutdoorTemp == thisDXCoil.MSCacheOutdoorTemp) {
+            return;
+        }
+
+        thisDXCoil.MSCacheInletDBTemp = InletAirDryBulbTemp;
+        thisDXCoil.MSCacheInletHumRat = InletAirHumRat;
+        thisDXCoil.MSCachePressure = Pressure;
+        thisDXCoil.MSCacheOutdoorTemp = OutdoorTemp;
+        thisDXCoil.MSCacheInletWetBulb = PsyTwbFnTdbWPb(InletAirDryBulbTemp, InletAirHumRat, Pressure, CallingRoutine);
+        thisDXCoil.MSCacheInletRhoAir = PsyRhoAirFnPbTdbW(Pressure, InletAirDryBulbTemp, InletAirHumRat, CallingRoutine);
+        thisDXCoil.MSCacheValid = true;
+    }
+
+    Real64 MSCoilCurveValue(int const SpeedNum,          // speed number
+                            int const CurveIndex,        // index of the temperature modifier curve for this speed
+                            MSCurveCacheData &Cache,     // cached curve results by speed
+                            Real64 const Var1,           // 1st independent variable
+                            Optional<Real64 const> Var2  // 2nd independent variable
+    )
+    {
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns a multispeed coil temperature modifier curve result, evaluating the curve only when its independent
+        // variables differ from the ones the cached result for the speed was evaluated at. Curves under EMS override
+        // are always re-evaluated so the current override value is used.
+
+        // METHODOLOGY EMPLOYED:
+        // A cache hit reports the cached result and inputs on the curve, as CurveValue would, so the curve output
+        // and input report variables reflect the current call.
+
+        Real64 const Input2 = present(Var2) ? Var2() : 0.0;
+        auto &thisCurve(CurveManager::PerfCurve(CurveIndex));
+
+        if (thisCurve.EMSOverrideOn) {
+            Cache.Valid(SpeedNum) = false;
+            return CurveManager::CurveValue(CurveIndex, Var1, Var2);
+        }
+        if (Cache.Valid(SpeedNum) && Cache.Input1(SpeedNum) == Var1 && Cache.Input2(SpeedNum) == Input2) {
+            thisCurve.CurveOutput = Cache.Value(SpeedNum);
+            thisCurve.CurveInput1 = Var1;
+            if (present(Var2)) thisCurve.CurveInput2 = Var2;
+            return Cache.Value(SpeedNum);
+        }
+        Cache.Value(SpeedNum) = CurveManager::CurveValue(CurveIndex, Var1, Var2);
+        Cache.Input1(SpeedNum) = Var1;
+        Cache.Input2(SpeedNum) = Input2;
+        Cache.Valid(SpeedNum) = true;
+        return Cache.Value(SpeedNum);
+    }
+
     void CalcMultiSpeedDXCoilCooling(int const DXCoilNum,     // the number of the DX heating coil to be simulated
                                      Real64 const SpeedRatio, // = (CompressorSpeed - CompressorSpeedMin) / (CompressorSpeedMax - CompressorSpeedMin)
                                      Real64 const CycRatio,   // cycling part load ratio
@@ -12094,7 +12175,6 @@ namespace DXCoils {
         //  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
         // InletAirPressure = DXCoil(DXCoilNum)%InletAirPressure
         // InletAirWetBulbC = PsyTwbFnTdbWPb(InletAirDryBulbTemp,InletAirHumRat,InletAirPressure)
-        InletAirWetBulbC = PsyTwbFnTdbWPb(InletAirDryBulbTemp, InletAirHumRat, OutdoorPressure, RoutineName);
         if (DXCoil(DXCoilNum).CondenserType(DXMode) == AirCooled) {
             CondInletTemp = OutdoorDryBulb; // Outdoor dry-bulb temp
         } else if (DXCoil(DXCoilNum).CondenserType(DXMode) == EvapCooled) {
@@ -12113,10 +12193,13 @@ namespace DXCoils {
             (CompOp == On)) {
 
             RhoAir = PsyRhoAirFnPbTdbW(OutdoorPressure, OutdoorDryBulb, OutdoorHumRat, RoutineName);
+            // inlet wet-bulb, density and temperature modifier curves are reused while the inlet state is unchanged
+            SetMSCoilInletState(DXCoilNum, InletAirDryBulbTemp, InletAirHumRat, OutdoorPressure, CondInletTemp, RoutineName);
+            InletAirWetBulbC = DXCoil(DXCoilNum).MSCacheInletWetBulb;
             if (SpeedNum > 1 && SingleMode == 0) {
 
                 // Check for valid air volume flow per rated total cooling capacity (200 - 500 cfm/ton) at low speed
-                AirVolumeFlowRate = MSHPMassFlowRateLow / PsyRhoAirFnPbTdbW(OutdoorPressure, InletAirDryBulbTemp, InletAirHumRat, RoutineName);
+                AirVolumeFlowRate = MSHPMassFlowRateLow / DXCoil(DXCoilNum).MSCacheInletRhoAir;
                 //  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
                 //  AirVolumeFlowRate = AirMassFlow/PsyRhoAirFnPbTdbW(InletAirPressure,InletAirDryBulbTemp, InletAirHumRat)
                 VolFlowperRatedTotCap = AirVolumeFlowRate / DXCoil(DXCoilNum).MSRatedTotCap(SpeedNumLS);
@@ -12143,7 +12226,7 @@ namespace DXCoils {
                 }
 
                 // Check for valid air volume flow per rated total cooling capacity (200 - 500 cfm/ton) at high speed
-                AirVolumeFlowRate = MSHPMassFlowRateHigh / PsyRhoAirFnPbTdbW(OutdoorPressure, InletAirDryBulbTemp, InletAirHumRat, RoutineName);
+                AirVolumeFlowRate = MSHPMassFlowRateHigh / DXCoil(DXCoilNum).MSCacheInletRhoAir;
                 //  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
                 //  AirVolumeFlowRate = AirMassFlow/PsyRhoAirFnPbTdbW(InletAirPressure,InletAirDryBulbTemp, InletAirHumRat)
                 VolFlowperRatedTotCap = AirVolumeFlowRate / DXCoil(DXCoilNum).MSRatedTotCap(SpeedNumHS);
@@ -12299,11 +12382,19 @@ namespace DXCoils {
                 }
 
                 // get high speed EIR at current conditions
-                EIRTempModFacHS = CurveValue(DXCoil(DXCoilNum).MSEIRFTemp(SpeedNumHS), InletAirWetBulbC, CondInletTemp);
+                EIRTempModFacHS = MSCoilCurveValue(SpeedNumHS,
+                                                   DXCoil(DXCoilNum).MSEIRFTemp(SpeedNumHS),
+                                                   DXCoil(DXCoilNum).MSCacheEIRFTemp,
+                                                   InletAirWetBulbC,
+                                                   CondInletTemp);
                 EIRFlowModFacHS = CurveValue(DXCoil(DXCoilNum).MSEIRFFlow(SpeedNumHS), AirMassFlowRatioHS);
                 EIRHS = 1.0 / DXCoil(DXCoilNum).MSRatedCOP(SpeedNumHS) * EIRFlowModFacHS * EIRTempModFacHS;
                 // get low speed EIR at current conditions
-                EIRTempModFacLS = CurveValue(DXCoil(DXCoilNum).MSEIRFTemp(SpeedNumLS), InletAirWetBulbC, CondInletTemp);
+                EIRTempModFacLS = MSCoilCurveValue(SpeedNumLS,
+                                                   DXCoil(DXCoilNum).MSEIRFTemp(SpeedNumLS),
+                                                   DXCoil(DXCoilNum).MSCacheEIRFTemp,
+                                                   InletAirWetBulbC,
+                                                   CondInletTemp);
                 EIRFlowModFacLS = CurveValue(DXCoil(DXCoilNum).MSEIRFFlow(SpeedNumLS), AirMassFlowRatioLS);
                 EIRLS = 1.0 / DXCoil(DXCoilNum).MSRatedCOP(SpeedNumLS) * EIRTempModFacLS * EIRFlowModFacLS;
 
@@ -12422,7 +12513,7 @@ namespace DXCoils {
                 if (FanOpMode == ContFanCycCoil) AirMassFlow = MSHPMassFlowRateHigh;
 
                 // Check for valid air volume flow per rated total cooling capacity (200 - 500 cfm/ton) at low speed
-                AirVolumeFlowRate = MSHPMassFlowRateHigh / PsyRhoAirFnPbTdbW(OutdoorPressure, InletAirDryBulbTemp, InletAirHumRat, RoutineName);
+                AirVolumeFlowRate = MSHPMassFlowRateHigh / DXCoil(DXCoilNum).MSCacheInletRhoAir;
                 //  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
                 //  AirVolumeFlowRate = AirMassFlow/PsyRhoAirFnPbTdbW(InletAirPressure,InletAirDryBulbTemp, InletAirHumRat)
                 VolFlowperRatedTotCap = AirVolumeFlowRate / DXCoil(DXCoilNum).MSRatedTotCap(SpeedNum);
@@ -12564,7 +12655,11 @@ namespace DXCoils {
                 OutletAirHumRat = LSOutletAirHumRat;
                 OutletAirDryBulbTemp = LSOutletAirDryBulbTemp;
                 // get low speed EIR at current conditions
-                EIRTempModFacLS = CurveValue(DXCoil(DXCoilNum).MSEIRFTemp(SpeedNum), InletAirWetBulbC, CondInletTemp);
+                EIRTempModFacLS = MSCoilCurveValue(SpeedNum,
+                                                   DXCoil(DXCoilNum).MSEIRFTemp(SpeedNum),
+                                                   DXCoil(DXCoilNum).MSCacheEIRFTemp,
+                                                   InletAirWetBulbC,
+                                                   CondInletTemp);
                 EIRFlowModFacLS = CurveValue(DXCoil(DXCoilNum).MSEIRFFlow(SpeedNum), AirMassFlowRatioLS);
                 EIRLS = 1.0 / DXCoil(DXCoilNum).MSRatedCOP(SpeedNum) * EIRTempModFacLS * EIRFlowModFacLS;
 
@@ -12899,7 +12994,9 @@ namespace DXCoils {
         //  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
         // InletAirPressure = DXCoil(DXCoilNum)%InletAirPressure
         // InletAirWetBulbC = PsyTwbFnTdbWPb(InletAirDryBulbTemp,InletAirHumRat,InletAirPressure)
-        InletAirWetBulbC = PsyTwbFnTdbWPb(InletAirDryBulbTemp, InletAirHumRat, OutdoorPressure, RoutineName);
+        // inlet wet-bulb, density and temperature modifier curves are reused while the inlet state is unchanged
+        SetMSCoilInletState(DXCoilNum, InletAirDryBulbTemp, InletAirHumRat, OutdoorPressure, OutdoorDryBulb, RoutineName);
+        InletAirWetBulbC = DXCoil(DXCoilNum).MSCacheInletWetBulb;
         PLRHeating = 0.0;
         DXCoil(DXCoilNum).HeatingCoilRuntimeFraction = 0.0;
         // Initialize crankcase heater, operates below OAT defined in input deck for HP DX heating coil
@@ -12917,7 +13014,7 @@ namespace DXCoils {
             if (SpeedNum > 1 && SingleMode == 0) {
 
                 // Check for valid air volume flow per rated total cooling capacity (200 - 600 cfm/ton) at low speed
-                AirVolumeFlowRate = MSHPMassFlowRateLow / PsyRhoAirFnPbTdbW(OutdoorPressure, InletAirDryBulbTemp, InletAirHumRat, RoutineName);
+                AirVolumeFlowRate = MSHPMassFlowRateLow / DXCoil(DXCoilNum).MSCacheInletRhoAir;
                 //  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
                 //  AirVolumeFlowRate = AirMassFlow/PsyRhoAirFnPbTdbW(InletAirPressure,InletAirDryBulbTemp, InletAirHumRat)
                 VolFlowperRatedTotCap = AirVolumeFlowRate / DXCoil(DXCoilNum).MSRatedTotCap(SpeedNumLS);
@@ -12944,7 +13041,7 @@ namespace DXCoils {
                 }
 
                 // Check for valid air volume flow per rated total cooling capacity (200 - 600 cfm/ton) at high speed
-                AirVolumeFlowRate = MSHPMassFlowRateHigh / PsyRhoAirFnPbTdbW(OutdoorPressure, InletAirDryBulbTemp, InletAirHumRat, RoutineName);
+                AirVolumeFlowRate = MSHPMassFlowRateHigh / DXCoil(DXCoilNum).MSCacheInletRhoAir;
                 //  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
                 //  AirVolumeFlowRate = AirMassFlow/PsyRhoAirFnPbTdbW(InletAirPressure,InletAirDryBulbTemp, InletAirHumRat)
                 VolFlowperRatedTotCap = AirVolumeFlowRate / DXCoil(DXCoilNum).MSRatedTotCap(SpeedNumHS);
@@ -12976,9 +13073,16 @@ namespace DXCoils {
                 // advised to use the bi-quaratic curve if sufficient manufacturer data is available.
                 // Low speed
                 if (CurveManager::PerfCurve(DXCoil(DXCoilNum).MSCCapFTemp(SpeedNumLS)).NumDims == 1) {
-                    TotCapTempModFac = CurveValue(DXCoil(DXCoilNum).MSCCapFTemp(SpeedNumLS), OutdoorDryBulb);
+                    TotCapTempModFac = MSCoilCurveValue(SpeedNumLS,
+                                                        DXCoil(DXCoilNum).MSCCapFTemp(SpeedNumLS),
+                                                        DXCoil(DXCoilNum).MSCacheCapFTemp,
+                                                        OutdoorDryBulb);
                 } else {
-                    TotCapTempModFac = CurveValue(DXCoil(DXCoilNum).MSCCapFTemp(SpeedNumLS), InletAirDryBulbTemp, OutdoorDryBulb);
+                    TotCapTempModFac = MSCoilCurveValue(SpeedNumLS,
+                                                        DXCoil(DXCoilNum).MSCCapFTemp(SpeedNumLS),
+                                                        DXCoil(DXCoilNum).MSCacheCapFTemp,
+                                                        InletAirDryBulbTemp,
+                                                        OutdoorDryBulb);
                 }
                 //  Get total capacity modifying factor (function of mass flow) for off-rated conditions
                 TotCapFlowModFac = CurveValue(DXCoil(DXCoilNum).MSCCapFFlow(SpeedNumLS), AirMassFlowRatioLS);
@@ -12986,9 +13090,16 @@ namespace DXCoils {
                 TotCapLS = DXCoil(DXCoilNum).MSRatedTotCap(SpeedNumLS) * TotCapFlowModFac * TotCapTempModFac;
                 // High speed
                 if (CurveManager::PerfCurve(DXCoil(DXCoilNum).MSCCapFTemp(SpeedNumHS)).NumDims == 1) {
-                    TotCapTempModFac = CurveValue(DXCoil(DXCoilNum).MSCCapFTemp(SpeedNumHS), OutdoorDryBulb);
+                    TotCapTempModFac = MSCoilCurveValue(SpeedNumHS,
+                                                        DXCoil(DXCoilNum).MSCCapFTemp(SpeedNumHS),
+                                                        DXCoil(DXCoilNum).MSCacheCapFTemp,
+                                                        OutdoorDryBulb);
                 } else {
-                    TotCapTempModFac = CurveValue(DXCoil(DXCoilNum).MSCCapFTemp(SpeedNumHS), InletAirDryBulbTemp, OutdoorDryBulb);
+                    TotCapTempModFac = MSCoilCurveValue(SpeedNumHS,
+                                                        DXCoil(DXCoilNum).MSCCapFTemp(SpeedNumHS),
+                                                        DXCoil(DXCoilNum).MSCacheCapFTemp,
+                                                        InletAirDryBulbTemp,
+                                                        OutdoorDryBulb);
                 }
                 //  Get total capacity modifying factor (function of mass flow) for off-rated conditions
                 TotCapFlowModFac = CurveValue(DXCoil(DXCoilNum).MSCCapFFlow(SpeedNumHS), AirMassFlowRatioHS);
@@ -13000,17 +13111,31 @@ namespace DXCoils {
                 // advised to use the bi-quaratic curve if sufficient manufacturer data is available.
                 // Low Speed
                 if (CurveManager::PerfCurve(DXCoil(DXCoilNum).MSEIRFTemp(SpeedNumLS)).NumDims == 1) {
-                    EIRTempModFac = CurveValue(DXCoil(DXCoilNum).MSEIRFTemp(SpeedNumLS), OutdoorDryBulb);
+                    EIRTempModFac = MSCoilCurveValue(SpeedNumLS,
+                                                     DXCoil(DXCoilNum).MSEIRFTemp(SpeedNumLS),
+                                                     DXCoil(DXCoilNum).MSCacheEIRFTemp,
+                                                     OutdoorDryBulb);
                 } else {
-                    EIRTempModFac = CurveValue(DXCoil(DXCoilNum).MSEIRFTemp(SpeedNumLS), InletAirDryBulbTemp, OutdoorDryBulb);
+                    EIRTempModFac = MSCoilCurveValue(SpeedNumLS,
+                                                     DXCoil(DXCoilNum).MSEIRFTemp(SpeedNumLS),
+                                                     DXCoil(DXCoilNum).MSCacheEIRFTemp,
+                                                     InletAirDryBulbTemp,
+                                                     OutdoorDryBulb);
                 }
                 EIRFlowModFac = CurveValue(DXCoil(DXCoilNum).MSEIRFFlow(SpeedNumLS), AirMassFlowRatioLS);
                 EIRLS = 1.0 / DXCoil(DXCoilNum).MSRatedCOP(SpeedNumLS) * EIRTempModFac * EIRFlowModFac;
                 // High Speed
                 if (CurveManager::PerfCurve(DXCoil(DXCoilNum).MSEIRFTemp(SpeedNumHS)).NumDims == 1) {
-                    EIRTempModFac = CurveValue(DXCoil(DXCoilNum).MSEIRFTemp(SpeedNumHS), OutdoorDryBulb);
+                    EIRTempModFac = MSCoilCurveValue(SpeedNumHS,
+                                                     DXCoil(DXCoilNum).MSEIRFTemp(SpeedNumHS),
+                                                     DXCoil(DXCoilNum).MSCacheEIRFTemp,
+                                                     OutdoorDryBulb);
                 } else {
-                    EIRTempModFac = CurveValue(DXCoil(DXCoilNum).MSEIRFTemp(SpeedNumHS), InletAirDryBulbTemp, OutdoorDryBulb);
+                    EIRTempModFac = MSCoilCurveValue(SpeedNumHS,
+                                                     DXCoil(DXCoilNum).MSEIRFTemp(SpeedNumHS),
+                                                     DXCoil(DXCoilNum).MSCacheEIRFTemp,
+                                                     InletAirDryBulbTemp,
+                                                     OutdoorDryBulb);
                 }
                 EIRFlowModFac = CurveValue(DXCoil(DXCoilNum).MSEIRFFlow(SpeedNumHS), AirMassFlowRatioHS);
                 EIRHS = 1.0 / DXCoil(DXCoilNum).MSRatedCOP(SpeedNumHS) * EIRTempModFac * EIRFlowModFac;
@@ -13179,7 +13304,7 @@ namespace DXCoils {
                 if (FanOpMode == CycFanCycCoil) AirMassFlow /= CycRatio;
                 if (FanOpMode == ContFanCycCoil) AirMassFlow = MSHPMassFlowRateHigh;
                 // Check for valid air volume flow per rated total cooling capacity (200 - 600 cfm/ton)
-                AirVolumeFlowRate = AirMassFlow / PsyRhoAirFnPbTdbW(OutdoorPressure, InletAirDryBulbTemp, InletAirHumRat, RoutineName);
+                AirVolumeFlowRate = AirMassFlow / DXCoil(DXCoilNum).MSCacheInletRhoAir;
                 //  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
                 //  AirVolumeFlowRate = AirMassFlow/PsyRhoAirFnPbTdbW(InletAirPressure,InletAirDryBulbTemp, InletAirHumRat)
                 VolFlowperRatedTotCap = AirVolumeFlowRate / DXCoil(DXCoilNum).MSRatedTotCap(SpeedNum);
@@ -13209,9 +13334,16 @@ namespace DXCoils {
                 // to the entering dry-bulb temperature as well as the outside dry-bulb temperature. User is
                 // advised to use the bi-quaratic curve if sufficient manufacturer data is available.
                 if (CurveManager::PerfCurve(DXCoil(DXCoilNum).MSCCapFTemp(SpeedNum)).NumDims == 1) {
-                    TotCapTempModFac = CurveValue(DXCoil(DXCoilNum).MSCCapFTemp(SpeedNum), OutdoorDryBulb);
+                    TotCapTempModFac = MSCoilCurveValue(SpeedNum,
+                                                        DXCoil(DXCoilNum).MSCCapFTemp(SpeedNum),
+                                                        DXCoil(DXCoilNum).MSCacheCapFTemp,
+                                                        OutdoorDryBulb);
                 } else {
-                    TotCapTempModFac = CurveValue(DXCoil(DXCoilNum).MSCCapFTemp(SpeedNum), InletAirDryBulbTemp, OutdoorDryBulb);
+                    TotCapTempModFac = MSCoilCurveValue(SpeedNum,
+                                                        DXCoil(DXCoilNum).MSCCapFTemp(SpeedNum),
+                                                        DXCoil(DXCoilNum).MSCacheCapFTemp,
+                                                        InletAirDryBulbTemp,
+                                                        OutdoorDryBulb);
                 }
 
                 //  Get total capacity modifying factor (function of mass flow) for off-rated conditions
@@ -13290,9 +13422,16 @@ namespace DXCoils {
                 // to the entering dry-bulb temperature as well as the outside dry-bulb temperature. User is
                 // advised to use the bi-quadratic curve if sufficient manufacturer data is available.
                 if (CurveManager::PerfCurve(DXCoil(DXCoilNum).MSEIRFTemp(1)).NumDims == 1) {
-                    EIRTempModFac = CurveValue(DXCoil(DXCoilNum).MSEIRFTemp(1), OutdoorDryBulb);
+                    EIRTempModFac = MSCoilCurveValue(1,
+                                                     DXCoil(DXCoilNum).MSEIRFTemp(1),
+                                                     DXCoil(DXCoilNum).MSCacheEIRFTemp,
+                                                     OutdoorDryBulb);
                 } else {
-                    EIRTempModFac = CurveValue(DXCoil(DXCoilNum).MSEIRFTemp(1), InletAirDryBulbTemp, OutdoorDryBulb);
+                    EIRTempModFac = MSCoilCurveValue(1,
+                                                     DXCoil(DXCoilNum).MSEIRFTemp(1),
+                                                     DXCoil(DXCoilNum).MSCacheEIRFTemp,
+                                                     InletAirDryBulbTemp,
+                                                     OutdoorDryBulb);
                 }
                 EIRFlowModFac = CurveValue(DXCoil(DXCoilNum).MSEIRFFlow(1), AirMassFlowRatioLS);
                 EIR = 1.0 / DXCoil(DXCoilNum).MSRatedCOP(1) * EIRTempModFac * EIRFlowModFac;
@@ -174,6 +174,15 @@ namespace DXCoils {
 
     // Types
 
+    struct MSCurveCacheData
+    {
+        // Members
+        Array1D<Real64> Value;  // curve result by speed
+        Array1D<Real64> Input1; // 1st independent variable the result was evaluated at, by speed
+        Array1D<Real64> Input2; // 2nd independent variable the result was evaluated at, by speed
+        Array1D_bool Valid;     // TRUE when a result has been stored for the speed
+    };
+
     struct DXCoilData
     {
         // Members
@@ -448,6 +457,16 @@ namespace DXCoils {
         bool MSHPHeatRecActive;  // True when entered Heat Rec Vol Flow Rate > 0
         int MSHPDesignSpecIndex; // index to MSHPDesignSpecification object used for variable speed coils
         // End of multispeed DX coil input
+        // multispeed inlet condition cache, reused while the coil inlet state is unchanged (e.g., during PLR/speed ratio iteration)
+        bool MSCacheValid;                  // TRUE when the cached inlet state below is current
+        Real64 MSCacheInletDBTemp;          // inlet air dry-bulb temperature the cache was built for [C]
+        Real64 MSCacheInletHumRat;          // inlet air humidity ratio the cache was built for [kg/kg]
+        Real64 MSCachePressure;             // barometric pressure the cache was built for [Pa]
+        Real64 MSCacheOutdoorTemp;          // condenser inlet (cooling) or outdoor dry-bulb (heating) temperature [C]
+        Real64 MSCacheInletWetBulb;         // inlet air wet-bulb temperature [C]
+        Real64 MSCacheInletRhoAir;          // inlet air density [kg/m3]
+        MSCurveCacheData MSCacheCapFTemp;   // capacity modifier (function of temperature) by speed
+        MSCurveCacheData MSCacheEIRFTemp;   // EIR modifier (function of temperature) by speed
         // VRF system variables used for sizing
         bool CoolingCoilPresent;         // FALSE if coil not present
         bool HeatingCoilPresent;         // FALSE if coil not present
@@ -553,7 +572,9 @@ namespace DXCoils {
               PrintHighAmbMessage(false), EvapWaterSupplyMode(WaterSupplyFromMains), EvapWaterSupTankID(0), EvapWaterTankDemandARRID(0),
               CondensateCollectMode(CondensateDiscarded), CondensateTankID(0), CondensateTankSupplyARRID(0), CondensateVdot(0.0), CondensateVol(0.0),
               CurrentEndTimeLast(0.0), TimeStepSysLast(0.0), FuelType(0), NumOfSpeeds(0), PLRImpact(false), LatentImpact(false), MSFuelWasteHeat(0.0),
-              MSHPHeatRecActive(false), MSHPDesignSpecIndex(0), CoolingCoilPresent(true), HeatingCoilPresent(true), ISHundredPercentDOASDXCoil(false),
+              MSHPHeatRecActive(false), MSHPDesignSpecIndex(0), MSCacheValid(false),
+              MSCacheInletDBTemp(0.0), MSCacheInletHumRat(0.0), MSCachePressure(0.0), MSCacheOutdoorTemp(0.0), MSCacheInletWetBulb(0.0),
+              MSCacheInletRhoAir(0.0), CoolingCoilPresent(true), HeatingCoilPresent(true), ISHundredPercentDOASDXCoil(false),
               SHRFTemp(MaxModes, 0), SHRFTempErrorIndex(0), SHRFFlow(MaxModes, 0), SHRFFlowErrorIndex(0), SHRFTemp2(0), SHRFFlow2(0),
               UserSHRCurveExists(false), ASHRAE127StdRprt(false), SecZonePtr(0), SecCoilSHRFT(0), SecCoilSHRFF(0), SecCoilAirFlow(0.0),
               SecCoilAirFlowScalingFactor(1.0), SecCoilRatedSHR(1.0), SecCoilSHR(1.0), EvapInletWetBulb(0.0), SecCoilSensibleHeatGainRate(0.0),
@@ -740,6 +761,21 @@ namespace DXCoils {
                                      int const SingleMode     // Single mode operation Yes/No; 1=Yes, 0=No
     );
 
+    void SetMSCoilInletState(int const DXCoilNum,              // the number of the multispeed DX coil
+                             Real64 const InletAirDryBulbTemp, // inlet air dry bulb temperature [C]
+                             Real64 const InletAirHumRat,      // inlet air humidity ratio [kg/kg]
+                             Real64 const Pressure,            // barometric pressure [Pa]
+                             Real64 const OutdoorTemp,         // condenser inlet or outdoor dry-bulb temperature [C]
+                             std::string const &CallingRoutine // routine name used in psychrometric warnings
+    );
+
+    Real64 MSCoilCurveValue(int const SpeedNum,            // speed number
+                            int const CurveIndex,          // index of the temperature modifier curve for this speed
+                            MSCurveCacheData &Cache,       // cached curve results by speed
+                            Real64 const Var1,             // 1st independent variable
+                            Optional<Real64 const> Var2 = _ // 2nd independent variable
+    );
+
     void CalcMultiSpeedDXCoilHeating(int const DXCoilNum,     // the number of the DX heating coil to be simulated
                                      Real64 const SpeedRatio, // = (CompressorSpeed - CompressorSpeedMin) / (CompressorSpeedMax - CompressorSpeedMin)
                                      Real64 const CycRatio,   // cycling part load ratio
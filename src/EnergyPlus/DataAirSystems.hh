@@ -254,6 +254,10 @@ namespace DataAirSystems {
         int RetFanNum;                        // index of the return fan in the Fan data structure when model type is structArrayLegacyFanModels
         int retFanVecIndex;    // index in fan object vector for return fan when model type is objectVectorOOFanSystemModel, zero-based index
         Real64 FanDesCoolLoad; // design fan heat gain for the air loop [W]
+        bool ControllerResimCompiled;       // true once ControllerResimCompNum has been set up
+        Array1D_int ControllerResimCompNum; // first main branch component affected by each controller's actuator (0 = whole air loop)
+        int ResimOASysCompNum;              // main branch position of the outside air system (0 if none)
+        bool OASysHeatingActiveFlag;        // air loop HeatingActiveFlag seen by the outside air system when it was last simulated
 
         // Default Constructor
         DefinePrimaryAirSystem()
@@ -262,7 +266,8 @@ namespace DataAirSystems {
               OASysInletNodeNum(0), OASysOutletNodeNum(0), OAMixOAInNodeNum(0), RABExists(false), RABMixInNode(0), SupMixInNode(0), MixOutNode(0),
               RABSplitOutNode(0), OtherSplitOutNode(0), NumOACoolCoils(0), NumOAHeatCoils(0), NumOAHXs(0), SizeAirloopCoil(true),
               supFanModelTypeEnum(fanModelTypeNotYetSet), SupFanNum(0), supFanVecIndex(-1), supFanLocation(fanPlacement::fanPlaceNotSet),
-              retFanModelTypeEnum(fanModelTypeNotYetSet), RetFanNum(0), retFanVecIndex(-1), FanDesCoolLoad(0.0)
+              retFanModelTypeEnum(fanModelTypeNotYetSet), RetFanNum(0), retFanVecIndex(-1), FanDesCoolLoad(0.0),
+              ControllerResimCompiled(false), ResimOASysCompNum(0), OASysHeatingActiveFlag(false)
         {
         }
     };
@@ -231,12 +231,15 @@ namespace DataErrorTracking {
 
     // Object Data
     Array1D<RecurringErrorData> RecurringErrors;
+    std::unordered_map<std::string, int> RecurringErrorIndex; // uppercase recurring message -> index in RecurringErrors
 
     // Clears the global data in DataErrorTracking
     // Needed for unit tests, should not normally be called.
     void clear_state()
     {
         NumRecurringErrors = 0; // Number of stored recurring error messages
+        RecurringErrors.deallocate();
+        RecurringErrorIndex.clear();
         MatchCounts = 0;
         TotalSevereErrors = 0;               // Counter
         TotalWarningErrors = 0;              // Counter
@@ -48,6 +48,10 @@
 #ifndef DataErrorTracking_hh_INCLUDED
 #define DataErrorTracking_hh_INCLUDED
 
+// C++ Headers
+#include <string>
+#include <unordered_map>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -146,6 +150,7 @@ namespace DataErrorTracking {
 
     // Object Data
     extern Array1D<RecurringErrorData> RecurringErrors;
+    extern std::unordered_map<std::string, int> RecurringErrorIndex; // uppercase recurring message -> index in RecurringErrors
 
     // Clears the global data in DataErrorTracking
     // Needed for unit tests, should not normally be called.
@@ -90,6 +90,7 @@ namespace DataMoistureBalanceEMPD {
     Array1D<Real64> RVSurfLayer;
     Array1D<Real64> RVDeepLayer;
     Array1D<Real64> RVwall;
+    Array1D<Real64> TempSurfSat; // Inside face dew point temperature from the latest EMPD evaluation [C]
 
     void clear_state()
     {
@@ -101,6 +102,7 @@ namespace DataMoistureBalanceEMPD {
         RVSurfLayer.deallocate();
         RVDeepLayer.deallocate();
         RVwall.deallocate();
+        TempSurfSat.deallocate();
     }
 
 } // namespace DataMoistureBalanceEMPD
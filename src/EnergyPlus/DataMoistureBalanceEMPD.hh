@@ -82,6 +82,7 @@ namespace DataMoistureBalanceEMPD {
     extern Array1D<Real64> RVSurfLayer;
     extern Array1D<Real64> RVDeepLayer;
     extern Array1D<Real64> RVwall;
+    extern Array1D<Real64> TempSurfSat; // Inside face dew point temperature from the latest EMPD evaluation [C]
 
     void clear_state();
 
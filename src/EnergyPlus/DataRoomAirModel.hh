@@ -668,6 +668,7 @@ namespace DataRoomAirModel {
         std::string NodeSurfListName;                               // name of nodes' adjacent surface list
         bool HasSurfacesAssigned;                                   // True if this node has surfaces assigned
         Array1D<bool> SurfMask;                                     // Sized to num of surfs in Zone, true if surface is associated with this node
+        Array1D_int SurfNums;                                       // Heat transfer surfaces convecting to this node, compiled from SurfMask
         std::string NodeIntGainsListName;                           // name of node's internal gains list
         bool HasIntGainsAssigned;                                   // True if this node has internal gain assigned
         int NumIntGains;                                            // Number of internal gain objects
@@ -116,6 +116,7 @@ namespace DataStringGlobals {
     extern std::string outputAdsFileName;
     extern std::string outputDfsFileName;
     extern std::string outputGLHEFileName;
+    extern std::string outputFDGroundTempFileName;
     extern std::string outputDelightInFileName;
     extern std::string outputDelightOutFileName;
     extern std::string outputDelightEldmpFileName;
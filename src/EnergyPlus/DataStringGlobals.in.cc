@@ -166,6 +166,7 @@ namespace DataStringGlobals {
     std::string outputAdsFileName("eplusADS.out");
     std::string outputDfsFileName("eplusout.dfs");
     std::string outputGLHEFileName("eplusout.glhe");
+    std::string outputFDGroundTempFileName("eplusout.fdgt");
     std::string outputDelightInFileName("eplusout.delightin");
     std::string outputDelightOutFileName("eplusout.delightout");
     std::string outputDelightEldmpFileName("eplusout.delighteldmp");
@@ -103,6 +103,7 @@ namespace DataSystemVariables {
     std::string const DDOnlyEnvVar("DDONLY");       // Only run design days
     std::string const ReverseDDEnvVar("REVERSEDD"); // Reverse DD during run
     std::string const DisableGLHECachingEnvVar("DISABLEGLHECACHING");
+    std::string const DisableGroundTempCachingEnvVar("DISABLEGROUNDTEMPCACHING");
     std::string const FullAnnualSimulation("FULLANNUALRUN"); // Generate annual run
     std::string const cDeveloperFlag("DeveloperFlag");
     std::string const cDisplayAllWarnings("DisplayAllWarnings");
@@ -131,6 +132,14 @@ namespace DataSystemVariables {
     // solutions of all controllers on each air loop at each call to SimAirLoop()
     std::string const TraceHVACControllerEnvVar("TRACE_HVACCONTROLLER"); // To generate a trace file for
     //  each individual HVAC controller with all controller iterations
+    std::string const CoupledAirLoopControllersEnvVar("COUPLED_AIRLOOP_CONTROLLERS"); // To solve the water coil controllers
+    // on each air loop together with a Newton predictor
+    std::string const FastPsychrometricsEnvVar("FAST_PSYCHROMETRICS"); // To use the direct wet-bulb and saturation temperature
+    // approximations
+    std::string const FastPsyNewtonStepsEnvVar("FAST_PSYCHROMETRICS_NEWTON_STEPS"); // Number of Newton refinement steps
+    // (0 to 3) applied to the direct approximations when FAST_PSYCHROMETRICS is on
+    std::string const TrackHeatRejectionMemoEnvVar("TRACK_HEAT_REJECTION_MEMO"); // To report the evaluations and reused
+    // results of the heat rejection model memos to the eio file
 
     std::string const MinReportFrequencyEnvVar("MINREPORTFREQUENCY"); // environment var for reporting frequency.
     std::string const
@@ -146,6 +155,7 @@ namespace DataSystemVariables {
     bool DDOnly(false);                           // TRUE if design days (sizingperiod:*) only are to be run.
     bool ReverseDD(false);                        // TRUE if reverse design days (reordering sizingperiod:*) are to be run.
     bool DisableGLHECaching(false);               // TRUE if caching is to be disabled, for example, during unit tests.
+    bool DisableGroundTempCaching(false);         // TRUE if finite difference ground temperature caching is to be disabled
     bool FullAnnualRun(false);                    // TRUE if full annual simulation is to be run.
     bool DeveloperFlag(false);                    // TRUE if developer flag is turned on. (turns on more displays to console)
     bool TimingFlag(false);                       // TRUE if timing flag is turned on. (turns on more timing displays to console)
@@ -158,6 +168,10 @@ namespace DataSystemVariables {
     // HVAC controllers on each air loop at each call to SimAirLoop()
     bool TraceHVACControllerEnvFlag(false); // If TRUE generates a trace file for each individual HVAC
     // controller with all controller iterations
+    bool CoupledAirLoopControllersEnvFlag(false); // If TRUE solves the water coil controllers on each air loop
+    // together with a Newton predictor before the individual controller iterations
+    bool TrackHeatRejectionMemoEnvFlag(false); // If TRUE reports the evaluations and reused results of the heat
+    // rejection model memos to the eio file
     bool ReportDuringWarmup(false);                      // True when the report outputs even during warmup
     bool ReportDuringHVACSizingSimulation(false);        // true when reporting outputs during HVAC sizing Simulation
     bool ReportDetailedWarmupConvergence(false);         // True when the detailed warmup convergence is requested
@@ -371,6 +385,7 @@ namespace DataSystemVariables {
         DDOnly = false;
         ReverseDD = false;
         DisableGLHECaching = false;
+        DisableGroundTempCaching = false;
         FullAnnualRun = false;
         DeveloperFlag = false;
         TimingFlag = false;
@@ -380,6 +395,8 @@ namespace DataSystemVariables {
         TrackAirLoopEnvFlag = false;
         TraceAirLoopEnvFlag = false;
         TraceHVACControllerEnvFlag = false;
+        CoupledAirLoopControllersEnvFlag = false;
+        TrackHeatRejectionMemoEnvFlag = false;
         ReportDuringWarmup = false;
         ReportDuringHVACSizingSimulation = false;
         ReportDetailedWarmupConvergence = false;
@@ -72,6 +72,7 @@ namespace DataSystemVariables {
     extern std::string const DDOnlyEnvVar;             // Only run design days
     extern std::string const ReverseDDEnvVar;          // Reverse DD during run
     extern std::string const DisableGLHECachingEnvVar; // GLHE Caching
+    extern std::string const DisableGroundTempCachingEnvVar; // Finite difference ground temperature caching
     extern std::string const FullAnnualSimulation;     // Generate annual run
     extern std::string const cDeveloperFlag;
     extern std::string const cDisplayAllWarnings;
@@ -100,6 +101,14 @@ namespace DataSystemVariables {
     // solutions of all controllers on each air loop at each call to SimAirLoop()
     extern std::string const TraceHVACControllerEnvVar; // To generate a trace file for
     //  each individual HVAC controller with all controller iterations
+    extern std::string const CoupledAirLoopControllersEnvVar; // To solve the water coil controllers
+    // on each air loop together with a Newton predictor
+    extern std::string const FastPsychrometricsEnvVar; // To use the direct wet-bulb and saturation temperature
+    // approximations
+    extern std::string const FastPsyNewtonStepsEnvVar; // Number of Newton refinement steps
+    // (0 to 3) applied to the direct approximations when FAST_PSYCHROMETRICS is on
+    extern std::string const TrackHeatRejectionMemoEnvVar; // To report the evaluations and reused
+    // results of the heat rejection model memos to the eio file
 
     extern std::string const MinReportFrequencyEnvVar;   // environment var for reporting frequency.
     extern std::string const cDisplayInputInAuditEnvVar; // environmental variable that enables the echoing of the input file into the audit file
@@ -114,6 +123,7 @@ namespace DataSystemVariables {
     extern bool DDOnly;                           // TRUE if design days (sizingperiod:*) only are to be run.
     extern bool ReverseDD;                        // TRUE if reverse design days (reordering sizingperiod:*) are to be run.
     extern bool DisableGLHECaching;               // TRUE if GLHE caching is to be disabled, for example, during unit tests
+    extern bool DisableGroundTempCaching;         // TRUE if finite difference ground temperature caching is to be disabled
     extern bool FullAnnualRun;                    // TRUE if full annual simulation is to be run.
     extern bool DeveloperFlag;                    // TRUE if developer flag is turned on. (turns on more displays to console)
     extern bool TimingFlag;                       // TRUE if timing flag is turned on. (turns on more timing displays to console)
@@ -126,6 +136,10 @@ namespace DataSystemVariables {
     // HVAC controllers on each air loop at each call to SimAirLoop()
     extern bool TraceHVACControllerEnvFlag; // If TRUE generates a trace file for each individual HVAC
     // controller with all controller iterations
+    extern bool CoupledAirLoopControllersEnvFlag; // If TRUE solves the water coil controllers on each air loop
+    // together with a Newton predictor before the individual controller iterations
+    extern bool TrackHeatRejectionMemoEnvFlag; // If TRUE reports the evaluations and reused results of the heat
+    // rejection model memos to the eio file
     extern bool ReportDuringWarmup;                      // True when the report outputs even during warmup
     extern bool ReportDuringHVACSizingSimulation;        // true when reporting outputs during HVAC sizing Simulation
     extern bool ReportDetailedWarmupConvergence;         // True when the detailed warmup convergence is requested
@@ -47,9 +47,11 @@
 
 // C++ Headers
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -169,6 +171,9 @@ namespace DaylightingManager {
     bool mapFirstTime(true);
     bool CheckTDDs_firstTime(true);
     bool DayltgExtHorizIllum_firstTime(true); // flag for first time thru to initialize
+    int const ExtHorizIllumMemoSize(48); // Sun positions remembered by DayltgExtHorizIllum (two days of hours)
+    std::vector<std::array<Real64, 8>> ExtHorizIllumMemo; // PHSUN, THSUN, SPHSUN, CPHSUN and the resulting HISK(1:4)
+    int ExtHorizIllumMemoNext(0); // Memo slot to overwrite next once the memo is full
     bool DayltgInteriorMapIllum_FirstTimeFlag(true);
     bool ReportIllumMap_firstTime(true);
     bool SQFirstTime(true);
@@ -262,6 +267,8 @@ namespace DaylightingManager {
         mapFirstTime = true;
         CheckTDDs_firstTime = true;
         DayltgExtHorizIllum_firstTime = true;
+        ExtHorizIllumMemo.clear();
+        ExtHorizIllumMemoNext = 0;
         DayltgInteriorMapIllum_FirstTimeFlag = true;
         ReportIllumMap_firstTime = true;
         SQFirstTime = true;
@@ -6024,6 +6031,18 @@ namespace DaylightingManager {
             DayltgExtHorizIllum_firstTime = false;
         }
 
+        // The sky integration only depends on the sun position, which recurs across sizing/run environments
+        // and shading calculation periods, so remember the most recent results.
+        for (auto const &memo : ExtHorizIllumMemo) {
+            if (memo[0] == PHSUN && memo[1] == THSUN && memo[2] == SPHSUN && memo[3] == CPHSUN) {
+                for (ISky = 1; ISky <= 4; ++ISky) {
+                    HISK(ISky) = memo[3 + ISky];
+                }
+                HISU = SPHSUN * 1.0;
+                return;
+            }
+        }
+
         HISK = 0.0;
 
         // Sky integration
@@ -6042,6 +6061,14 @@ namespace DaylightingManager {
             HISK(ISky) *= DTH * DPH;
         }
 
+        std::array<Real64, 8> const newMemo{{PHSUN, THSUN, SPHSUN, CPHSUN, HISK(1), HISK(2), HISK(3), HISK(4)}};
+        if (int(ExtHorizIllumMemo.size()) < ExtHorizIllumMemoSize) {
+            ExtHorizIllumMemo.push_back(newMemo);
+        } else {
+            ExtHorizIllumMemo[ExtHorizIllumMemoNext] = newMemo;
+            ExtHorizIllumMemoNext = (ExtHorizIllumMemoNext + 1) % ExtHorizIllumMemoSize;
+        }
+
         // Direct solar horizontal illum (for unit direct normal illuminance)
         HISU = SPHSUN * 1.0;
     }
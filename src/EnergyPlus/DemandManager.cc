@@ -65,6 +65,7 @@
 #include <OutputProcessor.hh>
 #include <ScheduleManager.hh>
 #include <SimulationManager.hh>
+#include <TimestepCheckpoint.hh>
 #include <UtilityRoutines.hh>
 
 namespace EnergyPlus {
@@ -262,6 +263,9 @@ namespace DemandManager {
                     }
                 }
 
+                // Snapshots taken during this timestep must not be restored into the next one
+                TimestepCheckpoint::InvalidateCheckpoints();
+
                 for (ListNum = 1; ListNum <= NumDemandManagerList; ++ListNum) {
                     ReportDemandManagerList(ListNum);
                 } // ListNum
@@ -427,6 +431,7 @@ namespace DemandManager {
         inputProcessor->getObjectDefMaxArgs(CurrentModuleObject, ListNum, NumAlphas, NumNums);
 
         NumDemandManagerList = inputProcessor->getNumObjectsFound(CurrentModuleObject);
+        TimestepCheckpoint::CheckpointingActive = (NumDemandManagerList > 0);
 
         if (NumDemandManagerList > 0) {
             AlphArray.dimension(NumAlphas, BlankString);
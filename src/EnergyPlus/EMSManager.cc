@@ -109,6 +109,11 @@ namespace EMSManager {
     int const iMassFlowRateMinSetPoint(108);  // integer for node setpoint control type
     int const iMassFlowRateMaxSetPoint(109);  // integer for node setpoint control type
 
+    int const iSensorSourceReal(1);     // sensor reads a real output variable through a direct pointer
+    int const iSensorSourceInteger(2);  // sensor reads an integer output variable through a direct pointer
+    int const iSensorSourceSchedule(3); // sensor reads a schedule value
+    int const iSensorSourceOther(4);    // sensor reads a meter (or anything else) through the output processor
+
     static std::string const BlankString;
 
     // DERIVED TYPE DEFINITIONS:
@@ -119,6 +124,12 @@ namespace EMSManager {
     bool GetEMSUserInput(true); // Flag to prevent input from being read multiple times
     bool ZoneThermostatActuatorsHaveBeenSetup(false);
     bool FinishProcessingUserInput(true); // Flag to indicate still need to process input
+    bool EMSBindingsNeedUpdate(true);     // Flag to indicate sensors or actuators changed since they were last bound
+
+    SensorBindingsType ReportedSensorBindings; // sensors also read by EMS output or trend variables, refreshed at every calling point
+    SensorBindingsType ProgramSensorBindings;  // sensors only read by Erl programs, refreshed where programs run
+    ActuatorBindingsType ActuatorBindings;
+    std::vector<bool> ProgramsRunAtCallingPoint; // true if a program calling manager has programs for the calling point
 
     // SUBROUTINE SPECIFICATIONS:
 
@@ -128,6 +139,30 @@ namespace EMSManager {
         GetEMSUserInput = true;
         ZoneThermostatActuatorsHaveBeenSetup = false;
         FinishProcessingUserInput = true;
+        EMSBindingsNeedUpdate = true;
+        ReportedSensorBindings.clear();
+        ProgramSensorBindings.clear();
+        ActuatorBindings.clear();
+        ProgramsRunAtCallingPoint.clear();
+    }
+
+    void SensorBindingsType::clear()
+    {
+        ErlVariableNum.clear();
+        Source.clear();
+        RealValue.clear();
+        IntValue.clear();
+        Type.clear();
+        Index.clear();
+    }
+
+    void ActuatorBindingsType::clear()
+    {
+        ErlVariableNum.clear();
+        Actuated.clear();
+        RealValue.clear();
+        IntValue.clear();
+        LogValue.clear();
     }
 
     void CheckIfAnyEMS()
@@ -286,14 +321,8 @@ namespace EMSManager {
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-        int ErlVariableNum;    // local index
         int ProgramManagerNum; // local index and loop
         int ErlProgramNum;     // local index
-        int ActuatorUsedLoop;  // local loop
-        int EMSActuatorVariableNum;
-
-        int tmpInteger;
-        //  INTEGER  :: ProgramNum
 
         // FLOW:
         anyProgramRan = false;
@@ -335,43 +364,19 @@ namespace EMSManager {
 
         if (!anyProgramRan) return;
 
-        // Set actuated variables with new values
-        for (ActuatorUsedLoop = 1;
-             ActuatorUsedLoop <= numActuatorsUsed + NumExternalInterfaceActuatorsUsed + NumExternalInterfaceFunctionalMockupUnitImportActuatorsUsed +
-                                     NumExternalInterfaceFunctionalMockupUnitExportActuatorsUsed;
-             ++ActuatorUsedLoop) {
-            ErlVariableNum = EMSActuatorUsed(ActuatorUsedLoop).ErlVariableNum;
-            if (!(ErlVariableNum > 0)) continue; // this can happen for good reason during sizing
-
-            EMSActuatorVariableNum = EMSActuatorUsed(ActuatorUsedLoop).ActuatorVariableNum;
-            if (!(EMSActuatorVariableNum > 0)) continue; // this can happen for good reason during sizing
-
-            if (ErlVariable(ErlVariableNum).Value.Type == ValueNull) {
-                EMSActuatorAvailable(EMSActuatorVariableNum).Actuated = false;
+        // Set actuated variables with new values, the value and the actuated flag are set remotely on the actuated object
+        for (std::size_t loop = 0, n = ActuatorBindings.ErlVariableNum.size(); loop < n; ++loop) {
+            ErlValueType const &value = ErlVariable(ActuatorBindings.ErlVariableNum[loop]).Value;
+            if (value.Type == ValueNull) {
+                *ActuatorBindings.Actuated[loop] = false;
             } else {
-                // Set the value and the actuated flag remotely on the actuated object via the pointer
-                {
-                    auto const SELECT_CASE_var(EMSActuatorAvailable(EMSActuatorVariableNum).PntrVarTypeUsed);
-
-                    if (SELECT_CASE_var == PntrReal) {
-                        EMSActuatorAvailable(EMSActuatorVariableNum).Actuated = true;
-                        EMSActuatorAvailable(EMSActuatorVariableNum).RealValue = ErlVariable(ErlVariableNum).Value.Number;
-                    } else if (SELECT_CASE_var == PntrInteger) {
-                        EMSActuatorAvailable(EMSActuatorVariableNum).Actuated = true;
-                        tmpInteger = std::floor(ErlVariable(ErlVariableNum).Value.Number);
-                        EMSActuatorAvailable(EMSActuatorVariableNum).IntValue = tmpInteger;
-                    } else if (SELECT_CASE_var == PntrLogical) {
-                        EMSActuatorAvailable(EMSActuatorVariableNum).Actuated = true;
-                        if (ErlVariable(ErlVariableNum).Value.Number == 0.0) {
-                            EMSActuatorAvailable(EMSActuatorVariableNum).LogValue = false;
-                        } else if (ErlVariable(ErlVariableNum).Value.Number == 1.0) {
-                            EMSActuatorAvailable(EMSActuatorVariableNum).LogValue = true;
-                        } else {
-                            EMSActuatorAvailable(EMSActuatorVariableNum).LogValue = false;
-                        }
-
-                    } else {
-                    }
+                *ActuatorBindings.Actuated[loop] = true;
+                if (ActuatorBindings.RealValue[loop] != nullptr) {
+                    *ActuatorBindings.RealValue[loop] = value.Number;
+                } else if (ActuatorBindings.IntValue[loop] != nullptr) {
+                    *ActuatorBindings.IntValue[loop] = std::floor(value.Number);
+                } else {
+                    *ActuatorBindings.LogValue[loop] = (value.Number == 1.0);
                 }
             }
         }
@@ -400,6 +405,7 @@ namespace EMSManager {
         // Using/Aliasing
         using DataGlobals::BeginEnvrnFlag;
         using DataGlobals::DoingSizing;
+        using DataGlobals::emsCallFromExternalInterface;
         using DataGlobals::emsCallFromSystemSizing;
         using DataGlobals::emsCallFromUserDefinedComponentModel;
         using DataGlobals::emsCallFromZoneSizing;
@@ -407,7 +413,6 @@ namespace EMSManager {
         using DataZoneControls::GetZoneAirStatsInputFlag;
         using RuntimeLanguageProcessor::InitializeRuntimeLanguage;
         using RuntimeLanguageProcessor::SetErlValueNumber;
-        using ScheduleManager::GetCurrentScheduleValue;
 
         // Locals
         // SUBROUTINE ARGUMENT DEFINITIONS:
@@ -425,7 +430,6 @@ namespace EMSManager {
 
         int InternalVarUsedNum; // local index and loop
         int InternVarAvailNum;  // local index
-        int SensorNum;          // local loop and index
         int ErlVariableNum;     // local index
         Real64 tmpReal;         // temporary local integer
 
@@ -486,21 +490,141 @@ namespace EMSManager {
             }
         }
 
-        // Update sensors with current data
-        for (SensorNum = 1; SensorNum <= NumSensors; ++SensorNum) {
-            ErlVariableNum = Sensor(SensorNum).VariableNum;
-            if ((ErlVariableNum > 0) && (Sensor(SensorNum).Index > 0)) {
-                if (Sensor(SensorNum).SchedNum == 0) { // not a schedule so get from output processor
+        if (EMSBindingsNeedUpdate) BindSensorsAndActuators();
 
-                    ErlVariable(ErlVariableNum).Value = SetErlValueNumber(GetInternalVariableValue(Sensor(SensorNum).Type, Sensor(SensorNum).Index),
-                                                                          ErlVariable(ErlVariableNum).Value);
-                } else { // schedule so use schedule service
+        // Update sensors with current data. Sensors that only Erl programs read are left alone at calling points where no
+        // program runs; a user defined component model or the external interface may run programs at any time.
+        UpdateSensors(ReportedSensorBindings);
+        if ((iCalledFrom == emsCallFromUserDefinedComponentModel) || (iCalledFrom == emsCallFromExternalInterface) ||
+            ((iCalledFrom >= 0) && (iCalledFrom < static_cast<int>(ProgramsRunAtCallingPoint.size())) && ProgramsRunAtCallingPoint[iCalledFrom])) {
+            UpdateSensors(ProgramSensorBindings);
+        }
+    }
 
-                    ErlVariable(ErlVariableNum).Value =
-                        SetErlValueNumber(GetCurrentScheduleValue(Sensor(SensorNum).SchedNum), ErlVariable(ErlVariableNum).Value);
-                }
+    void BindSensorsAndActuators()
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Resolves the EMS sensors and actuators in use to direct pointers into the values they read or override,
+        // so the per calling point updates do not go through the output processor or the actuator structures.
+
+        // METHODOLOGY EMPLOYED:
+        // Rebuilt whenever the sensor or actuator input has been (re)processed. The pointers are the same ones the
+        // output processor and the actuator references already hold, so they stay valid as long as those do.
+
+        // Using/Aliasing
+        using OutputProcessor::IVariableTypes;
+        using OutputProcessor::NumOfIVariable;
+        using OutputProcessor::NumOfRVariable;
+        using OutputProcessor::RVariableTypes;
+        using RuntimeLanguageProcessor::RuntimeReportVar;
+
+        // Erl variables read outside of Erl programs
+        std::vector<bool> reported(NumErlVariables + 1, false);
+        for (int RuntimeReportVarNum = 1; RuntimeReportVarNum <= NumEMSOutputVariables + NumEMSMeteredOutputVariables; ++RuntimeReportVarNum) {
+            int const ErlVariableNum = RuntimeReportVar(RuntimeReportVarNum).VariableNum;
+            if ((ErlVariableNum > 0) && (ErlVariableNum <= NumErlVariables)) reported[ErlVariableNum] = true;
+        }
+        for (int TrendVarNum = 1; TrendVarNum <= NumErlTrendVariables; ++TrendVarNum) {
+            int const ErlVariableNum = TrendVariable(TrendVarNum).ErlVariablePointer;
+            if ((ErlVariableNum > 0) && (ErlVariableNum <= NumErlVariables)) reported[ErlVariableNum] = true;
+        }
+
+        ReportedSensorBindings.clear();
+        ProgramSensorBindings.clear();
+        for (int SensorNum = 1; SensorNum <= NumSensors; ++SensorNum) {
+            auto const &thisSensor = Sensor(SensorNum);
+            if (!((thisSensor.VariableNum > 0) && (thisSensor.Index > 0))) continue;
+            SensorBindingsType &bindings =
+                ((thisSensor.VariableNum <= NumErlVariables) && reported[thisSensor.VariableNum]) ? ReportedSensorBindings : ProgramSensorBindings;
+            bindings.ErlVariableNum.push_back(thisSensor.VariableNum);
+            bindings.Type.push_back(thisSensor.Type);
+            if (thisSensor.SchedNum != 0) { // schedule so use schedule service
+                bindings.Source.push_back(iSensorSourceSchedule);
+                bindings.RealValue.push_back(nullptr);
+                bindings.IntValue.push_back(nullptr);
+                bindings.Index.push_back(thisSensor.SchedNum);
+            } else if ((thisSensor.Type == 2) && (thisSensor.Index <= NumOfRVariable)) {
+                bindings.Source.push_back(iSensorSourceReal);
+                bindings.RealValue.push_back(&RVariableTypes(thisSensor.Index).VarPtr().Which());
+                bindings.IntValue.push_back(nullptr);
+                bindings.Index.push_back(thisSensor.Index);
+            } else if ((thisSensor.Type == 1) && (thisSensor.Index <= NumOfIVariable)) {
+                bindings.Source.push_back(iSensorSourceInteger);
+                bindings.RealValue.push_back(nullptr);
+                bindings.IntValue.push_back(&IVariableTypes(thisSensor.Index).VarPtr().Which());
+                bindings.Index.push_back(thisSensor.Index);
+            } else { // meters, and anything the output processor has to check, go through the output processor
+                bindings.Source.push_back(iSensorSourceOther);
+                bindings.RealValue.push_back(nullptr);
+                bindings.IntValue.push_back(nullptr);
+                bindings.Index.push_back(thisSensor.Index);
             }
         }
+
+        // same order as EMSActuatorUsed, in case more than one actuator drives the same value
+        ActuatorBindings.clear();
+        for (int ActuatorUsedLoop = 1;
+             ActuatorUsedLoop <= numActuatorsUsed + NumExternalInterfaceActuatorsUsed + NumExternalInterfaceFunctionalMockupUnitImportActuatorsUsed +
+                                     NumExternalInterfaceFunctionalMockupUnitExportActuatorsUsed;
+             ++ActuatorUsedLoop) {
+            int const ErlVariableNum = EMSActuatorUsed(ActuatorUsedLoop).ErlVariableNum;
+            if (!(ErlVariableNum > 0)) continue; // this can happen for good reason during sizing
+
+            int const EMSActuatorVariableNum = EMSActuatorUsed(ActuatorUsedLoop).ActuatorVariableNum;
+            if (!(EMSActuatorVariableNum > 0)) continue; // this can happen for good reason during sizing
+
+            auto &thisActuator = EMSActuatorAvailable(EMSActuatorVariableNum);
+            int const PntrVarTypeUsed = thisActuator.PntrVarTypeUsed;
+            if ((PntrVarTypeUsed != PntrReal) && (PntrVarTypeUsed != PntrInteger) && (PntrVarTypeUsed != PntrLogical)) continue;
+            ActuatorBindings.ErlVariableNum.push_back(ErlVariableNum);
+            ActuatorBindings.Actuated.push_back(&thisActuator.Actuated());
+            ActuatorBindings.RealValue.push_back((PntrVarTypeUsed == PntrReal) ? &thisActuator.RealValue() : nullptr);
+            ActuatorBindings.IntValue.push_back((PntrVarTypeUsed == PntrInteger) ? &thisActuator.IntValue() : nullptr);
+            ActuatorBindings.LogValue.push_back((PntrVarTypeUsed == PntrLogical) ? &thisActuator.LogValue() : nullptr);
+        }
+
+        ProgramsRunAtCallingPoint.clear();
+        for (int ProgramManagerNum = 1; ProgramManagerNum <= NumProgramCallManagers; ++ProgramManagerNum) {
+            auto const &thisManager = EMSProgramCallManager(ProgramManagerNum);
+            if ((thisManager.NumErlPrograms <= 0) || (thisManager.CallingPoint < 0)) continue;
+            if (thisManager.CallingPoint >= static_cast<int>(ProgramsRunAtCallingPoint.size())) {
+                ProgramsRunAtCallingPoint.resize(thisManager.CallingPoint + 1, false);
+            }
+            ProgramsRunAtCallingPoint[thisManager.CallingPoint] = true;
+        }
+
+        EMSBindingsNeedUpdate = false;
+    }
+
+    void UpdateSensors(SensorBindingsType const &sensors)
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Copies the current value of each bound sensor into its Erl variable.
+
+        // METHODOLOGY EMPLOYED:
+        // Only the number and the initialized flag change, as with SetErlValueNumber(value, original value),
+        // but without copying the rest of the Erl value.
+
+        using ScheduleManager::GetCurrentScheduleValue;
+
+        for (std::size_t loop = 0, n = sensors.ErlVariableNum.size(); loop < n; ++loop) {
+            Real64 sensorValue;
+            int const source = sensors.Source[loop];
+            if (source == iSensorSourceReal) {
+                sensorValue = *sensors.RealValue[loop];
+            } else if (source == iSensorSourceInteger) {
+                sensorValue = double(*sensors.IntValue[loop]);
+            } else if (source == iSensorSourceSchedule) {
+                sensorValue = GetCurrentScheduleValue(sensors.Index[loop]);
+            } else {
+                sensorValue = GetInternalVariableValue(sensors.Type[loop], sensors.Index[loop]);
+            }
+            ErlValueType &value = ErlVariable(sensors.ErlVariableNum[loop]).Value;
+            value.Number = sensorValue;
+            value.initialized = true;
+        }
     }
 
     void ReportEMS()
@@ -610,6 +734,8 @@ namespace EMSManager {
         bool errFlag;
 
         // FLOW:
+        EMSBindingsNeedUpdate = true;
+
         cCurrentModuleObject = "EnergyManagementSystem:Sensor";
         inputProcessor->getObjectDefMaxArgs(cCurrentModuleObject, TotalArgs, NumAlphas, NumNums);
         MaxNumNumbers = NumNums;
@@ -1086,6 +1212,8 @@ namespace EMSManager {
         int InternalVarAvailNum; // local do loop index
         std::string cCurrentModuleObject;
 
+        EMSBindingsNeedUpdate = true;
+
         cCurrentModuleObject = "EnergyManagementSystem:Sensor";
         for (SensorNum = 1; SensorNum <= NumSensors; ++SensorNum) {
             if (Sensor(SensorNum).CheckedOkay) continue;
@@ -48,6 +48,9 @@
 #ifndef EMSManager_hh_INCLUDED
 #define EMSManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Optional.hh>
 
@@ -72,14 +75,52 @@ namespace EMSManager {
     extern int const iMassFlowRateMinSetPoint;  // integer for node setpoint control type
     extern int const iMassFlowRateMaxSetPoint;  // integer for node setpoint control type
 
+    extern int const iSensorSourceReal;     // sensor reads a real output variable through a direct pointer
+    extern int const iSensorSourceInteger;  // sensor reads an integer output variable through a direct pointer
+    extern int const iSensorSourceSchedule; // sensor reads a schedule value
+    extern int const iSensorSourceOther;    // sensor reads a meter (or anything else) through the output processor
+
     // DERIVED TYPE DEFINITIONS:
 
+    struct SensorBindingsType
+    {
+        // Members
+        // EMS sensors resolved to where their values live, one entry per sensor in each array
+        std::vector<int> ErlVariableNum;      // Erl variable set by the sensor
+        std::vector<int> Source;              // iSensorSourceReal, iSensorSourceInteger, iSensorSourceSchedule or iSensorSourceOther
+        std::vector<Real64 const *> RealValue; // value of a real output variable, nullptr for other sources
+        std::vector<int const *> IntValue;    // value of an integer output variable, nullptr for other sources
+        std::vector<int> Type;                // output processor type for iSensorSourceOther
+        std::vector<int> Index;               // schedule index, or output processor index for iSensorSourceOther
+
+        void clear();
+    };
+
+    struct ActuatorBindingsType
+    {
+        // Members
+        // EMS actuators resolved to the flags and values they override, one entry per actuator in each array, in actuator order
+        std::vector<int> ErlVariableNum; // Erl variable holding the actuator value
+        std::vector<bool *> Actuated;    // override flag on the actuated object
+        std::vector<Real64 *> RealValue; // real value being actuated, nullptr for other types
+        std::vector<int *> IntValue;     // integer value being actuated, nullptr for other types
+        std::vector<bool *> LogValue;    // logical value being actuated, nullptr for other types
+
+        void clear();
+    };
+
     // MODULE VARIABLE TYPE DECLARATIONS:
 
     // MODULE VARIABLE DECLARATIONS:
     extern bool GetEMSUserInput; // Flag to prevent input from being read multiple times
     extern bool ZoneThermostatActuatorsHaveBeenSetup;
     extern bool FinishProcessingUserInput; // Flag to indicate still need to process input
+    extern bool EMSBindingsNeedUpdate;     // Flag to indicate sensors or actuators changed since they were last bound
+
+    extern SensorBindingsType ReportedSensorBindings; // sensors also read by EMS output or trend variables, refreshed at every calling point
+    extern SensorBindingsType ProgramSensorBindings;  // sensors only read by Erl programs, refreshed where programs run
+    extern ActuatorBindingsType ActuatorBindings;
+    extern std::vector<bool> ProgramsRunAtCallingPoint; // true if a program calling manager has programs for the calling point
 
     // SUBROUTINE SPECIFICATIONS:
 
@@ -97,6 +138,10 @@ namespace EMSManager {
 
     void InitEMS(int const iCalledFrom); // indicates where subroutine was called from, parameters in DataGlobals.
 
+    void BindSensorsAndActuators();
+
+    void UpdateSensors(SensorBindingsType const &sensors);
+
     void ReportEMS();
 
     void GetEMSInput();
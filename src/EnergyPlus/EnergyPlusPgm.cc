@@ -326,6 +326,9 @@ int RunEnergyPlus(std::string const & filepath)
     get_environment_variable(DisableGLHECachingEnvVar, cEnvValue);
     DisableGLHECaching = env_var_on(cEnvValue); // Yes or True
 
+    get_environment_variable(DisableGroundTempCachingEnvVar, cEnvValue);
+    DisableGroundTempCaching = env_var_on(cEnvValue); // Yes or True
+
     get_environment_variable(FullAnnualSimulation, cEnvValue);
     FullAnnualRun = env_var_on(cEnvValue); // Yes or True
     if (AnnualSimulation) FullAnnualRun = true;
@@ -405,6 +408,25 @@ int RunEnergyPlus(std::string const & filepath)
     get_environment_variable(TraceHVACControllerEnvVar, cEnvValue);
     if (!cEnvValue.empty()) TraceHVACControllerEnvFlag = env_var_on(cEnvValue); // Yes or True
 
+    get_environment_variable(CoupledAirLoopControllersEnvVar, cEnvValue);
+    if (!cEnvValue.empty()) CoupledAirLoopControllersEnvFlag = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(TrackHeatRejectionMemoEnvVar, cEnvValue);
+    if (!cEnvValue.empty()) TrackHeatRejectionMemoEnvFlag = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(FastPsychrometricsEnvVar, cEnvValue);
+    if (!cEnvValue.empty()) Psychrometrics::UseFastPsychrometrics = env_var_on(cEnvValue); // Yes or True
+
+    get_environment_variable(FastPsyNewtonStepsEnvVar, cEnvValue);
+    if (!cEnvValue.empty()) {
+        if (cEnvValue.size() == 1u && cEnvValue[0] >= '0' && cEnvValue[0] <= '3') {
+            Psychrometrics::FastPsyNewtonSteps = cEnvValue[0] - '0';
+        } else {
+            DisplayString("Warning: " + FastPsyNewtonStepsEnvVar + "=\"" + cEnvValue + "\" is not 0, 1, 2 or 3; using " +
+                          std::to_string(Psychrometrics::FastPsyNewtonSteps) + " Newton refinement step(s).");
+        }
+    }
+
     get_environment_variable(cDisplayInputInAuditEnvVar, cEnvValue);
     if (!cEnvValue.empty()) DisplayInputInAudit = env_var_on(cEnvValue); // Yes or True
 
@@ -549,8 +571,11 @@ int RunEnergyPlus(std::string const & filepath)
             std::string const readVarsMviCommand = "\"" + readVarsPath + "\" \"" + MVIfile + "\" unlimited";
 
             // systemCall will be responsible to handle to above command on Windows versus Unix
-            systemCall(readVarsRviCommand);
-            systemCall(readVarsMviCommand);
+            // Both runs write readvars.audit in the working directory, so they are not run concurrently
+            TimeOutputSink("ReadVarsESO csv files", [&]() {
+                systemCall(readVarsRviCommand);
+                systemCall(readVarsMviCommand);
+            });
 
             if (!rviFileExists) removeFile(RVIfile.c_str());
 
@@ -1443,6 +1443,7 @@ namespace EvaporativeFluidCoolers {
                                SimpleEvapFluidCooler(EvapFluidCoolerNum).LoopSideNum,
                                SimpleEvapFluidCooler(EvapFluidCoolerNum).BranchNum,
                                SimpleEvapFluidCooler(EvapFluidCoolerNum).CompNum);
+            SimpleEvapFluidCooler(EvapFluidCoolerNum).MerkelModelMemo.clear(); // Sized and design values may change between environments
             MyEnvrnFlag(EvapFluidCoolerNum) = false;
         }
 
@@ -2688,6 +2689,7 @@ namespace EvaporativeFluidCoolers {
 
         // METHODOLOGY EMPLOYED:
         // See methodology for single speed or two speed evaporative fluid cooler model
+        // Results are kept in MerkelModelMemo and reused when the cooler is evaluated again at the same conditions.
 
         // REFERENCES:
         // Based on SimTower subroutine by Dan Fisher Sept. 1998
@@ -2756,6 +2758,20 @@ namespace EvaporativeFluidCoolers {
 
         if (UAdesign == 0.0) return;
 
+        HeatRejectionMemo::MemoKey const MemoKey{{InletWaterTemp,
+                                                  WaterMassFlowRate,
+                                                  AirFlowRate,
+                                                  UAdesign,
+                                                  InletAirTemp,
+                                                  InletAirWetBulb,
+                                                  SimpleEvapFluidCoolerInlet(EvapFluidCoolerNum).AirPress,
+                                                  SimpleEvapFluidCoolerInlet(EvapFluidCoolerNum).AirHumRat}};
+        HeatRejectionMemo::MemoResult MemoResult;
+        if (SimpleEvapFluidCooler(EvapFluidCoolerNum).MerkelModelMemo.lookup(MemoKey, MemoResult)) {
+            OutletWaterTemp = MemoResult[0];
+            return;
+        }
+
         // set water and air properties
         AirDensity = PsyRhoAirFnPbTdbW(
             SimpleEvapFluidCoolerInlet(EvapFluidCoolerNum).AirPress, InletAirTemp, SimpleEvapFluidCoolerInlet(EvapFluidCoolerNum).AirHumRat);
@@ -2810,6 +2826,7 @@ namespace EvaporativeFluidCoolers {
         } else {
             OutletWaterTemp = InletWaterTemp;
         }
+        SimpleEvapFluidCooler(EvapFluidCoolerNum).MerkelModelMemo.store(MemoKey, {{OutletWaterTemp, 0.0, 0.0}});
     }
 
     Real64 SimpleEvapFluidCoolerUAResidual(Real64 const UA,          // UA of evaporative fluid cooler
@@ -54,6 +54,7 @@
 // EnergyPlus Headers
 #include <DataGlobals.hh>
 #include <EnergyPlus.hh>
+#include <HeatRejectionMemo.hh>
 
 namespace EnergyPlus {
 
@@ -209,6 +210,7 @@ namespace EvaporativeFluidCoolers {
         int LoopSideNum;
         int BranchNum;
         int CompNum;
+        HeatRejectionMemo::ModelMemo MerkelModelMemo; // recent results of SimSimpleEvapFluidCooler
 
         // Default Constructor
         EvapFluidCoolerspecs()
@@ -733,6 +733,7 @@ namespace FluidCoolers {
                                                this->LoopSideNum,
                                                this->BranchNum,
                                                this->CompNum);
+            this->OutletTempMemo.clear(); // Sized and design values may change between environments
             this->beginEnvrnInit = false;
         }
 
@@ -1631,6 +1632,7 @@ namespace FluidCoolers {
 
         // METHODOLOGY EMPLOYED:
         // See methodology for Single Speed or Two Speed Fluid Cooler model
+        // Results are kept in OutletTempMemo and reused when the fluid cooler is evaluated again at the same conditions.
 
         // Locals
         Real64 _InletWaterTemp; // Water inlet temperature
@@ -1646,6 +1648,20 @@ namespace FluidCoolers {
         _OutletWaterTemp = _InletWaterTemp;
         Real64 InletAirTemp = SimpleFluidCooler(FluidCoolerNum).AirTemp;
 
+        HeatRejectionMemo::MemoKey const MemoKey{{_InletWaterTemp,
+                                                  _WaterMassFlowRate,
+                                                  AirFlowRate,
+                                                  UAdesign,
+                                                  InletAirTemp,
+                                                  SimpleFluidCooler(FluidCoolerNum).AirPress,
+                                                  SimpleFluidCooler(FluidCoolerNum).AirHumRat,
+                                                  0.0}};
+        HeatRejectionMemo::MemoResult MemoResult;
+        if (SimpleFluidCooler(FluidCoolerNum).OutletTempMemo.lookup(MemoKey, MemoResult)) {
+            _OutletWaterTemp = MemoResult[0];
+            return;
+        }
+
         // set water and air properties
         Real64 AirDensity =
             Psychrometrics::PsyRhoAirFnPbTdbW(SimpleFluidCooler(FluidCoolerNum).AirPress, InletAirTemp, SimpleFluidCooler(FluidCoolerNum).AirHumRat);
@@ -1679,6 +1695,7 @@ namespace FluidCoolers {
         } else {
             _OutletWaterTemp = _InletWaterTemp;
         }
+        SimpleFluidCooler(FluidCoolerNum).OutletTempMemo.store(MemoKey, {{_OutletWaterTemp, 0.0, 0.0}});
     }
 
     Real64 SimpleFluidCoolerUAResidual(Real64 const UA,          // UA of fluid cooler
@@ -54,6 +54,7 @@
 // EnergyPlus Headers
 #include <DataGlobals.hh>
 #include <EnergyPlus.hh>
+#include <HeatRejectionMemo.hh>
 #include <PlantComponent.hh>
 
 namespace EnergyPlus {
@@ -146,6 +147,7 @@ namespace FluidCoolers {
 
         // additional stuff
         int indexInArray;
+        HeatRejectionMemo::ModelMemo OutletTempMemo; // recent results of CalcFluidCoolerOutlet
 
         // Default Constructor
         FluidCoolerspecs()
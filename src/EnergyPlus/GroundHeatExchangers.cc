@@ -3369,11 +3369,11 @@ namespace GroundHeatExchangers {
 
         tempGround = 0;
 
-        tempGround += this->groundTempModel->getGroundTempAtTimeInSeconds(minDepth, currTime);
-        tempGround += this->groundTempModel->getGroundTempAtTimeInSeconds(maxDepth, currTime);
-        tempGround += this->groundTempModel->getGroundTempAtTimeInSeconds(oneQuarterDepth, currTime);
-        tempGround += this->groundTempModel->getGroundTempAtTimeInSeconds(halfDepth, currTime);
-        tempGround += this->groundTempModel->getGroundTempAtTimeInSeconds(threeQuarterDepth, currTime);
+        tempGround += this->groundTempModel->getGroundTempAtTimeInSecondsTabulated(minDepth, currTime);
+        tempGround += this->groundTempModel->getGroundTempAtTimeInSecondsTabulated(maxDepth, currTime);
+        tempGround += this->groundTempModel->getGroundTempAtTimeInSecondsTabulated(oneQuarterDepth, currTime);
+        tempGround += this->groundTempModel->getGroundTempAtTimeInSecondsTabulated(halfDepth, currTime);
+        tempGround += this->groundTempModel->getGroundTempAtTimeInSecondsTabulated(threeQuarterDepth, currTime);
 
         tempGround /= 5;
 
@@ -3453,8 +3453,8 @@ namespace GroundHeatExchangers {
             InitComponentNodes(0.0, designMassFlow, inletNodeNum, outletNodeNum, loopNum, loopSideNum, branchNum, compNum);
 
             lastQnSubHr = 0.0;
-            Node(inletNodeNum).Temp = this->groundTempModel->getGroundTempAtTimeInSeconds(coilDepth, CurTime);
-            Node(outletNodeNum).Temp = this->groundTempModel->getGroundTempAtTimeInSeconds(coilDepth, CurTime);
+            Node(inletNodeNum).Temp = this->groundTempModel->getGroundTempAtTimeInSecondsTabulated(coilDepth, CurTime);
+            Node(outletNodeNum).Temp = this->groundTempModel->getGroundTempAtTimeInSecondsTabulated(coilDepth, CurTime);
 
             // zero out all history arrays
 
@@ -3468,7 +3468,7 @@ namespace GroundHeatExchangers {
             prevHour = 1;
         }
 
-        tempGround = this->groundTempModel->getGroundTempAtTimeInSeconds(coilDepth, CurTime);
+        tempGround = this->groundTempModel->getGroundTempAtTimeInSecondsTabulated(coilDepth, CurTime);
 
         massFlowRate = RegulateCondenserCompFlowReqOp(loopNum, loopSideNum, branchNum, compNum, designMassFlow);
 
@@ -48,6 +48,10 @@
 #ifndef BaseGroundTemperatureModel_hh_INCLUDED
 #define BaseGroundTemperatureModel_hh_INCLUDED
 
+// C++ Headers
+#include <map>
+#include <utility>
+
 // EnergyPlus Headers
 #include <DataGlobals.hh>
 #include <EnergyPlus.hh>
@@ -80,6 +84,27 @@ public:
     virtual Real64 getGroundTempAtTimeInSeconds(Real64 const, Real64 const) = 0;
 
     virtual Real64 getGroundTempAtTimeInMonths(Real64 const, int const) = 0;
+
+    // Ground temperature at a depth and time in seconds, reusing the values already evaluated for that time and depth.
+    // Ground-coupled components ask for the same depths many times per timestep, and the models do not change once
+    // their input has been read. Consumers do not share a time base (e.g. start of day vs. current simulation time),
+    // so values are kept per (time, depth) and the oldest times are dropped once the table is full.
+    Real64 getGroundTempAtTimeInSecondsTabulated(Real64 const depth, Real64 const seconds)
+    {
+        auto const key = std::make_pair(seconds, depth);
+        auto const found = tabulatedTemps.find(key);
+        if (found != tabulatedTemps.end()) return found->second;
+        Real64 const groundTemp = getGroundTempAtTimeInSeconds(depth, seconds);
+        while (tabulatedTemps.size() >= maxTabulatedTemps) {
+            tabulatedTemps.erase(tabulatedTemps.begin());
+        }
+        tabulatedTemps.emplace(key, groundTemp);
+        return groundTemp;
+    }
+
+private:
+    static constexpr std::size_t maxTabulatedTemps = 1024;      // Bound on the number of tabulated temperatures
+    std::map<std::pair<Real64, Real64>, Real64> tabulatedTemps; // Ground temperatures keyed by (time, depth)
 };
 
 } // namespace EnergyPlus
@@ -47,17 +47,27 @@
 
 // C++ Headers
 #include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iomanip>
 #include <memory>
+#include <sstream>
+
+// Third-party Headers
+#include <nlohmann/json.hpp>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Fmath.hh>
 #include <ObjexxFCL/Optional.hh>
+#include <ObjexxFCL/gio.hh>
 
 // EnergyPlus Headers
 #include <DataEnvironment.hh>
 #include <DataGlobals.hh>
 #include <DataIPShortCuts.hh>
 #include <DataReportingFlags.hh>
+#include <DataStringGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <General.hh>
 #include <GroundTemperatureModeling/FiniteDifferenceGroundTemperatureModel.hh>
 #include <GroundTemperatureModeling/GroundTemperatureModelManager.hh>
@@ -74,7 +84,6 @@ int simDay = 0;
 int numIterYears = 0;
 int const maxYearsToIterate = 10;
 Real64 finalTempConvergenceCriteria = 0.05;
-Real64 iterationTempConvergenceCriteria = 0.00001;
 
 //******************************************************************************
 
@@ -157,11 +166,178 @@ void FiniteDiffGroundTempsModel::initAndSim()
     // PURPOSE OF THIS SUBROUTINE:
     // Initalizes and simulated finite difference ground temps model
 
+    // METHODOLOGY EMPLOYED:
+    // The converged annual ground temperatures only depend on the soil properties and the weather file, so they are
+    // read back from the cache file when a previous run has already simulated the same case.
+
+    bool const useCache = !DataSystemVariables::DisableGroundTempCaching && WeatherManager::WeatherFileExists;
+
+    if (useCache) {
+        makeThisGroundTempCacheStruct();
+        if (readCacheFileAndCompareWithThisGroundTempCache()) return;
+    }
+
     FiniteDiffGroundTempsModel::getWeatherData();
 
     FiniteDiffGroundTempsModel::developMesh();
 
     FiniteDiffGroundTempsModel::performSimulation();
+
+    if (useCache) {
+        writeGroundTempCacheToFile();
+    }
+}
+
+//******************************************************************************
+
+void FiniteDiffGroundTempsModel::makeThisGroundTempCacheStruct()
+{
+    // PURPOSE OF THIS SUBROUTINE:
+    // Sets up the data that identify this model in the ground temperature cache file
+
+    // For convenience
+    auto &d = myCacheData["Phys Data"];
+
+    d["Soil k"] = baseConductivity;
+    d["Soil Density"] = baseDensity;
+    d["Soil Specific Heat"] = baseSpecificHeat;
+    d["Water Content"] = waterContent;
+    d["Saturated Water Content"] = saturatedWaterContent;
+    d["Evapotranspiration Coeff"] = evapotransCoeff;
+
+    // Hash of the weather file contents. std::hash is only required to be consistent within a build, which is enough here.
+    std::ifstream ifs(DataStringGlobals::inputWeatherFileName, std::ios::binary);
+    std::stringstream weatherFileContents;
+    weatherFileContents << ifs.rdbuf();
+    d["Weather File Hash"] = std::to_string(std::hash<std::string>()(weatherFileContents.str()));
+}
+
+//******************************************************************************
+
+bool FiniteDiffGroundTempsModel::readCacheFileAndCompareWithThisGroundTempCache()
+{
+    // PURPOSE OF THIS SUBROUTINE:
+    // Loads the converged ground temperatures from the cache file if it holds a case matching this model.
+    // Returns true if the ground temperatures were loaded.
+
+    // For convenience
+    using json = nlohmann::json;
+
+    if (!ObjexxFCL::gio::file_exists(DataStringGlobals::outputFDGroundTempFileName)) {
+        // if the file doesn't exist, there are no data to read
+        return false;
+    }
+
+    // open file
+    std::ifstream ifs(DataStringGlobals::outputFDGroundTempFileName);
+
+    // create empty json object
+    json json_in;
+
+    // read json_in data
+    try {
+        ifs >> json_in;
+        ifs.close();
+    } catch (...) {
+        if (!json_in.empty()) {
+            // file exists, is not empty, but failed for some other reason
+            ShowWarningError(DataStringGlobals::outputFDGroundTempFileName + " contains invalid file format");
+        }
+        ifs.close();
+        return false;
+    }
+
+    for (auto &existing_data : json_in) {
+        if (myCacheData["Phys Data"] != existing_data["Phys Data"]) continue;
+
+        auto const &j_depths = existing_data["Ground Temps"]["Cell Depths"];
+        auto const &j_temps = existing_data["Ground Temps"]["Temperatures"];
+        if (j_depths.empty() || j_temps.size() != std::size_t(NumDaysInYear)) continue;
+
+        totalNumCells = j_depths.size();
+        cellDepths.dimension(totalNumCells, 0.0);
+        groundTemps.dimension({1, NumDaysInYear}, {1, totalNumCells}, 0.0);
+
+        for (int cell = 1; cell <= totalNumCells; ++cell) {
+            cellDepths(cell) = j_depths[cell - 1];
+        }
+        for (int day = 1; day <= NumDaysInYear; ++day) {
+            auto const &j_dayTemps = j_temps[day - 1];
+            for (int cell = 1; cell <= totalNumCells; ++cell) {
+                groundTemps(day, cell) = j_dayTemps[cell - 1];
+            }
+        }
+        return true;
+    }
+
+    return false;
+}
+
+//******************************************************************************
+
+void FiniteDiffGroundTempsModel::writeGroundTempCacheToFile()
+{
+    // PURPOSE OF THIS SUBROUTINE:
+    // Adds the converged ground temperatures of this model to the cache file
+
+    // For convenience
+    using json = nlohmann::json;
+
+    auto &j_temps = myCacheData["Ground Temps"];
+    j_temps["Cell Depths"] = std::vector<Real64>(cellDepths.begin(), cellDepths.end());
+    j_temps["Temperatures"] = json::array();
+    for (int day = 1; day <= NumDaysInYear; ++day) {
+        std::vector<Real64> dayTemps(totalNumCells);
+        for (int cell = 1; cell <= totalNumCells; ++cell) {
+            dayTemps[cell - 1] = groundTemps(day, cell);
+        }
+        j_temps["Temperatures"].push_back(dayTemps);
+    }
+
+    // empty json object for output writing
+    json json_out;
+
+    int i = 0;
+    if (ObjexxFCL::gio::file_exists(DataStringGlobals::outputFDGroundTempFileName)) {
+        // file exists -- keep existing data
+
+        // open file
+        std::ifstream ifs(DataStringGlobals::outputFDGroundTempFileName);
+
+        // create empty json object
+        json json_in;
+
+        // read json_in data
+        try {
+            ifs >> json_in;
+            ifs.close();
+        } catch (...) {
+            if (!json_in.empty()) {
+                // file exists, is not empty, but failed for some other reason
+                ShowWarningError("Error reading from " + DataStringGlobals::outputFDGroundTempFileName);
+                ShowWarningError("Data from previous " + DataStringGlobals::outputFDGroundTempFileName + " not saved");
+            }
+            ifs.close();
+        }
+
+        // add existing data to json_out
+        for (auto &existing_data : json_in) {
+            ++i;
+            json_out["FDGT " + std::to_string(i)] = existing_data;
+        }
+    }
+
+    // add current data
+    json_out["FDGT " + std::to_string(i + 1)] = myCacheData;
+
+    // open output file
+    std::ofstream ofs(DataStringGlobals::outputFDGroundTempFileName);
+
+    // write data to file, set spacing at 2
+    ofs << std::setw(2) << json_out;
+
+    // don't forget to close
+    ofs.close();
 }
 
 //******************************************************************************
@@ -467,7 +643,7 @@ void FiniteDiffGroundTempsModel::performSimulation()
     // SUBROUTINE INFORMATION:
     //       AUTHOR         Matt Mitchell
     //       DATE WRITTEN   Summer 2015
-    //       MODIFIED       na
+    //       MODIFIED       Direct solution of the implicit cell equations in place of iterating to convergence
     //       RE-ENGINEERED  na
 
     // PURPOSE OF THIS SUBROUTINE:
@@ -486,34 +662,22 @@ void FiniteDiffGroundTempsModel::performSimulation()
         // loop over all days
         for (simDay = 1; simDay <= NumDaysInYear; ++simDay) {
 
-            bool iterationConverged = false;
-
             doStartOfTimeStepInits();
 
-            // Loop until iteration temperature converges
-            do {
+            // Set up the fully implicit heat balance of each cell
+            for (int cell = 1; cell <= totalNumCells; ++cell) {
 
-                // For all cells
-                for (int cell = 1; cell <= totalNumCells; ++cell) {
-
-                    if (cell == 1) {
-                        updateSurfaceCellTemperature();
-                    } else if (cell > 1 && cell < totalNumCells) {
-                        updateGeneralDomainCellTemperature(cell);
-                    } else if (cell == totalNumCells) {
-                        updateBottomCellTemperature();
-                    }
-                }
-
-                // Check iteration temperature convergence
-                iterationConverged = checkIterationTemperatureConvergence();
-
-                if (!iterationConverged) {
-                    // Shift temperatures for next iteration
-                    updateIterationTemperatures();
+                if (cell == 1) {
+                    updateSurfaceCellCoefficients();
+                } else if (cell > 1 && cell < totalNumCells) {
+                    updateGeneralDomainCellCoefficients(cell);
+                } else if (cell == totalNumCells) {
+                    updateBottomCellCoefficients();
                 }
+            }
 
-            } while (!iterationConverged);
+            // Solve for this day's cell temperatures
+            solveCellTemperatures();
 
             // Shift temperatures for next timestep
             updateTimeStepTemperatures();
@@ -527,16 +691,16 @@ void FiniteDiffGroundTempsModel::performSimulation()
 
 //******************************************************************************
 
-void FiniteDiffGroundTempsModel::updateSurfaceCellTemperature()
+void FiniteDiffGroundTempsModel::updateSurfaceCellCoefficients()
 {
     // SUBROUTINE INFORMATION:
     //       AUTHOR         Matt Mitchell
     //       DATE WRITTEN   Summer 2015
-    //       MODIFIED       na
+    //       MODIFIED       Sets up the cell heat balance for solveCellTemperatures instead of updating the temperature
     //       RE-ENGINEERED  na
 
     // PURPOSE OF THIS SUBROUTINE:
-    // Determines heat transfer to surface. Updates surface cell temperature.
+    // Determines heat transfer to surface. Sets up the surface cell heat balance.
 
     // FUNCTION LOCAL VARIABLE DECLARATIONS:
     Real64 numerator(0.0);
@@ -581,7 +745,7 @@ void FiniteDiffGroundTempsModel::updateSurfaceCellTemperature()
     // Conduction to lower cell
     resistance = (thisCell.thickness / 2.0) / (thisCell.props.conductivity * thisCell.conductionArea) +
                  (cellBelow_thisCell.thickness / 2.0) / (cellBelow_thisCell.props.conductivity * cellBelow_thisCell.conductionArea);
-    numerator += (thisCell.beta / resistance) * cellBelow_thisCell.temperature;
+    thisCell.coeffBelow = thisCell.beta / resistance;
     denominator += (thisCell.beta / resistance);
 
     // Convection to atmosphere
@@ -665,22 +829,23 @@ void FiniteDiffGroundTempsModel::updateSurfaceCellTemperature()
     // Add any solar/evapotranspiration heat gain here
     numerator += thisCell.beta * incidentHeatGain;
 
-    // Calculate the return temperature and leave
-    cellArray(1).temperature = numerator / denominator;
+    thisCell.coeffAbove = 0.0;
+    thisCell.numerator = numerator;
+    thisCell.denominator = denominator;
 }
 
 //******************************************************************************
 
-void FiniteDiffGroundTempsModel::updateGeneralDomainCellTemperature(int const cell)
+void FiniteDiffGroundTempsModel::updateGeneralDomainCellCoefficients(int const cell)
 {
     // SUBROUTINE INFORMATION:
     //       AUTHOR         Matt Mitchell
     //       DATE WRITTEN   Summer 2015
-    //       MODIFIED       na
+    //       MODIFIED       Sets up the cell heat balance for solveCellTemperatures instead of updating the temperature
     //       RE-ENGINEERED  na
 
     // PURPOSE OF THIS SUBROUTINE:
-    // Update cell temperature based on HT from cells above and below
+    // Set up cell heat balance based on HT from cells above and below
 
     // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
     Real64 numerator(0.0);
@@ -699,32 +864,32 @@ void FiniteDiffGroundTempsModel::updateGeneralDomainCellTemperature(int const ce
     resistance = ((thisCell.thickness / 2.0) / (thisCell.conductionArea * thisCell.props.conductivity)) +
                  ((cellAbove_thisCell.thickness / 2.0) / (cellAbove_thisCell.conductionArea * cellAbove_thisCell.props.conductivity));
 
-    numerator += (thisCell.beta / resistance) * cellAbove_thisCell.temperature;
+    thisCell.coeffAbove = thisCell.beta / resistance;
     denominator += thisCell.beta / resistance;
 
     // Conduction resitance between this cell and below cell
     resistance = ((thisCell.thickness / 2.0) / (thisCell.conductionArea * thisCell.props.conductivity)) +
                  ((cellBelow_thisCell.thickness / 2.0) / (cellBelow_thisCell.conductionArea * cellBelow_thisCell.props.conductivity));
 
-    numerator += (thisCell.beta / resistance) * cellBelow_thisCell.temperature;
+    thisCell.coeffBelow = thisCell.beta / resistance;
     denominator += thisCell.beta / resistance;
 
-    //'now that we have passed all directions, update the temperature
-    thisCell.temperature = numerator / denominator;
+    thisCell.numerator = numerator;
+    thisCell.denominator = denominator;
 }
 
 //******************************************************************************
 
-void FiniteDiffGroundTempsModel::updateBottomCellTemperature()
+void FiniteDiffGroundTempsModel::updateBottomCellCoefficients()
 {
     // SUBROUTINE INFORMATION:
     //       AUTHOR         Matt Mitchell
     //       DATE WRITTEN   Summer 2015
-    //       MODIFIED       na
+    //       MODIFIED       Sets up the cell heat balance for solveCellTemperatures instead of updating the temperature
     //       RE-ENGINEERED  na
 
     // PURPOSE OF THIS SUBROUTINE:
-    // Updates bottom cell temperature based on earth heat flux HT from cell above
+    // Sets up bottom cell heat balance based on earth heat flux HT from cell above
 
     // REFERENCES:
     // Fridleifsson, I.B., R. Bertani, E.Huenges, J.W. Lund, A. Ragnarsson, L. Rybach. 2008
@@ -749,7 +914,7 @@ void FiniteDiffGroundTempsModel::updateBottomCellTemperature()
     resistance = ((thisCell.thickness / 2.0) / (thisCell.conductionArea * thisCell.props.conductivity)) +
                  ((cellAbove_thisCell.thickness / 2.0) / (cellAbove_thisCell.conductionArea * cellAbove_thisCell.props.conductivity));
 
-    numerator += (thisCell.beta / resistance) * cellAbove_thisCell.temperature;
+    thisCell.coeffAbove = thisCell.beta / resistance;
     denominator += thisCell.beta / resistance;
 
     // Geothermal gradient heat transfer
@@ -757,46 +922,47 @@ void FiniteDiffGroundTempsModel::updateBottomCellTemperature()
 
     numerator += thisCell.beta * HTBottom;
 
-    cellArray(totalNumCells).temperature = numerator / denominator;
+    thisCell.coeffBelow = 0.0;
+    thisCell.numerator = numerator;
+    thisCell.denominator = denominator;
 }
 
 //******************************************************************************
 
-bool FiniteDiffGroundTempsModel::checkFinalTemperatureConvergence()
+void FiniteDiffGroundTempsModel::solveCellTemperatures()
 {
-    // SUBROUTINE INFORMATION:
-    //       AUTHOR         Matt Mitchell
-    //       DATE WRITTEN   Summer 2015
-    //       MODIFIED       na
-    //       RE-ENGINEERED  na
-
     // PURPOSE OF THIS SUBROUTINE:
-    // Checks final temperature convergence
-
-    // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-    bool converged = true;
+    // Solves the cell heat balances for this time step's cell temperatures
 
-    if (numIterYears == maxYearsToIterate) return converged;
+    // METHODOLOGY EMPLOYED:
+    // Each cell balance reads denominator * T(i) = numerator + coeffAbove * T(i-1) + coeffBelow * T(i+1), so the fully
+    // implicit system is tridiagonal and is solved directly with the Thomas algorithm.
 
+    // Forward elimination
     for (int cell = 1; cell <= totalNumCells; ++cell) {
-
         auto &thisCell = cellArray(cell);
-
-        if (std::abs(thisCell.temperature - thisCell.temperature_finalConvergence) >= finalTempConvergenceCriteria) {
-            converged = false;
+        if (cell == 1) {
+            thisCell.elimCoeff = thisCell.coeffBelow / thisCell.denominator;
+            thisCell.elimTemp = thisCell.numerator / thisCell.denominator;
+        } else {
+            auto const &cellAbove_thisCell = cellArray(cell - 1);
+            Real64 const pivot = thisCell.denominator - thisCell.coeffAbove * cellAbove_thisCell.elimCoeff;
+            thisCell.elimCoeff = thisCell.coeffBelow / pivot;
+            thisCell.elimTemp = (thisCell.numerator + thisCell.coeffAbove * cellAbove_thisCell.elimTemp) / pivot;
         }
-
-        thisCell.temperature_finalConvergence = thisCell.temperature;
     }
 
-    ++numIterYears;
-
-    return converged;
+    // Back substitution
+    cellArray(totalNumCells).temperature = cellArray(totalNumCells).elimTemp;
+    for (int cell = totalNumCells - 1; cell >= 1; --cell) {
+        auto &thisCell = cellArray(cell);
+        thisCell.temperature = thisCell.elimTemp + thisCell.elimCoeff * cellArray(cell + 1).temperature;
+    }
 }
 
 //******************************************************************************
 
-bool FiniteDiffGroundTempsModel::checkIterationTemperatureConvergence()
+bool FiniteDiffGroundTempsModel::checkFinalTemperatureConvergence()
 {
     // SUBROUTINE INFORMATION:
     //       AUTHOR         Matt Mitchell
@@ -805,19 +971,26 @@ bool FiniteDiffGroundTempsModel::checkIterationTemperatureConvergence()
     //       RE-ENGINEERED  na
 
     // PURPOSE OF THIS SUBROUTINE:
-    // Checks iteration temperature convergence
+    // Checks final temperature convergence
 
     // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
     bool converged = true;
 
+    if (numIterYears == maxYearsToIterate) return converged;
+
     for (int cell = 1; cell <= totalNumCells; ++cell) {
 
-        if (std::abs(cellArray(cell).temperature - cellArray(cell).temperature_prevIteration) >= iterationTempConvergenceCriteria) {
+        auto &thisCell = cellArray(cell);
+
+        if (std::abs(thisCell.temperature - thisCell.temperature_finalConvergence) >= finalTempConvergenceCriteria) {
             converged = false;
-            break;
         }
+
+        thisCell.temperature_finalConvergence = thisCell.temperature;
     }
 
+    ++numIterYears;
+
     return converged;
 }
 
@@ -863,7 +1036,6 @@ void FiniteDiffGroundTempsModel::initDomain()
             thisCell.temperature = tempModel->getGroundTempAtTimeInSeconds(depth, 0.0); // Initialized at first day of year
         }
         thisCell.temperature_finalConvergence = thisCell.temperature;
-        thisCell.temperature_prevIteration = thisCell.temperature;
         thisCell.temperature_prevTimeStep = thisCell.temperature;
 
         // Set cell volume
@@ -881,24 +1053,6 @@ void FiniteDiffGroundTempsModel::initDomain()
 
 //******************************************************************************
 
-void FiniteDiffGroundTempsModel::updateIterationTemperatures()
-{
-    // SUBROUTINE INFORMATION:
-    //       AUTHOR         Matt Mitchell
-    //       DATE WRITTEN   Summer 2015
-    //       MODIFIED       na
-    //       RE-ENGINEERED  na
-
-    // PURPOSE OF THIS SUBROUTINE:
-    // Updates iteration temperatures for convergence checks
-
-    for (int cell = 1; cell <= totalNumCells; ++cell) {
-        cellArray(cell).temperature_prevIteration = cellArray(cell).temperature;
-    }
-}
-
-//******************************************************************************
-
 void FiniteDiffGroundTempsModel::updateTimeStepTemperatures()
 {
     // SUBROUTINE INFORMATION:
@@ -51,6 +51,9 @@
 // C++ Headers
 #include <memory>
 
+// Third-party Headers
+#include <nlohmann/json.hpp>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array2D.hh>
@@ -107,10 +110,15 @@ public:
         Real64 minZValue;
         Real64 maxZValue;
         Real64 temperature;
-        Real64 temperature_prevIteration;
         Real64 temperature_prevTimeStep;
         Real64 temperature_finalConvergence;
         Real64 beta;
+        Real64 numerator;   // Heat balance terms not depending on this time step's temperatures
+        Real64 denominator; // Heat balance coefficient of this cell's temperature
+        Real64 coeffAbove;  // Heat balance coefficient of the temperature of the cell above
+        Real64 coeffBelow;  // Heat balance coefficient of the temperature of the cell below
+        Real64 elimCoeff;   // Forward elimination coefficient used in solveCellTemperatures
+        Real64 elimTemp;    // Forward elimination temperature used in solveCellTemperatures
         Real64 volume;
         Real64 conductionArea = 1.0; // Assumes 1 m2
     };
@@ -134,24 +142,28 @@ public:
 
     void initAndSim();
 
+    void makeThisGroundTempCacheStruct();
+
+    bool readCacheFileAndCompareWithThisGroundTempCache();
+
+    void writeGroundTempCacheToFile();
+
     void developMesh();
 
     void performSimulation();
 
-    void updateSurfaceCellTemperature();
+    void updateSurfaceCellCoefficients();
 
-    void updateGeneralDomainCellTemperature(int const cell);
+    void updateGeneralDomainCellCoefficients(int const cell);
 
-    void updateBottomCellTemperature();
+    void updateBottomCellCoefficients();
+
+    void solveCellTemperatures();
 
     void initDomain();
 
     bool checkFinalTemperatureConvergence();
 
-    bool checkIterationTemperatureConvergence();
-
-    void updateIterationTemperatures();
-
     void updateTimeStepTemperatures();
 
     void doStartOfTimeStepInits();
@@ -170,6 +182,8 @@ public:
 
     Array1D<Real64> cellDepths;
 
+    nlohmann::json myCacheData;
+
     enum surfaceTypes
     {
         surfaceCoverType_bareSoil = 1,
@@ -2406,6 +2406,23 @@ namespace HVACControllers {
         }
     }
 
+    void TrackCoupledAirLoopControllers(int const AirLoopNum, bool const IsConvergedFlag, int const NumIterations)
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Updates runtime statistics for the coupled Newton predictor used on the specified air loop
+        // (see SimAirServingZones::SolveAirLoopControllersCoupled).
+
+        // To avoid tracking statistics in case of no air loop or no HVAC controllers are defined
+        if (NumAirLoopStats == 0) return;
+
+        auto &thisAirLoopStats(AirLoopStats(AirLoopNum));
+        ++thisAirLoopStats.NumCoupledSolves;
+        if (IsConvergedFlag) ++thisAirLoopStats.NumCoupledConverged;
+        thisAirLoopStats.TotCoupledIterations += NumIterations;
+        thisAirLoopStats.MaxCoupledIterations = max(thisAirLoopStats.MaxCoupledIterations, NumIterations);
+    }
+
     void TrackAirLoopController(int const AirLoopNum,       // Air loop index
                                 int const AirLoopControlNum // Controller index on this air loop
     )
@@ -2636,6 +2653,14 @@ namespace HVACControllers {
 
         ObjexxFCL::gio::write(FileUnit, fmtAAA) << "AvgIterations" << ',' << TrimSigDigits(AvgIterations, 10);
 
+        // Coupled Newton predictor, only used with COUPLED_AIRLOOP_CONTROLLERS=YES
+        if (ThisAirLoopStats.NumCoupledSolves > 0) {
+            ObjexxFCL::gio::write(FileUnit, fmtAAA) << "NumCoupledSolves" << ',' << TrimSigDigits(ThisAirLoopStats.NumCoupledSolves);
+            ObjexxFCL::gio::write(FileUnit, fmtAAA) << "NumCoupledConverged" << ',' << TrimSigDigits(ThisAirLoopStats.NumCoupledConverged);
+            ObjexxFCL::gio::write(FileUnit, fmtAAA) << "TotCoupledIterations" << ',' << TrimSigDigits(ThisAirLoopStats.TotCoupledIterations);
+            ObjexxFCL::gio::write(FileUnit, fmtAAA) << "MaxCoupledIterations" << ',' << TrimSigDigits(ThisAirLoopStats.MaxCoupledIterations);
+        }
+
         // Dump statistics for each controller on this air loop
         for (AirLoopControlNum = 1; AirLoopControlNum <= ThisPrimaryAirSystem.NumControllers; ++AirLoopControlNum) {
 
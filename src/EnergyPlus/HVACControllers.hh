@@ -276,13 +276,18 @@ namespace HVACControllers {
         int MaxSimAirLoopComponents;                  // Maximum number of times the SimAirLoopComponents() routine has been invoked
         int TotIterations;                            // Total number of iterations required to solve the controllers on this air loop
         int MaxIterations;                            // Maximum number of iterations required to solve the controllers on this air loop
+        int NumCoupledSolves;                         // Number of times the coupled Newton predictor was used on this air loop
+        int NumCoupledConverged;                      // Number of times the coupled Newton predictor met all controller tolerances
+        int TotCoupledIterations;                     // Total number of Newton iterations performed by the coupled predictor
+        int MaxCoupledIterations;                     // Maximum number of Newton iterations performed by the coupled predictor
         Array1D<ControllerStatsType> ControllerStats; // Array of statistics for each controller
         // on this air loop
 
         // Default Constructor
         AirLoopStatsType()
             : FirstTraceFlag(true), NumCalls(0), NumFailedWarmRestarts(0), NumSuccessfulWarmRestarts(0), TotSimAirLoopComponents(0),
-              MaxSimAirLoopComponents(0), TotIterations(0), MaxIterations(0)
+              MaxSimAirLoopComponents(0), TotIterations(0), MaxIterations(0), NumCoupledSolves(0), NumCoupledConverged(0), TotCoupledIterations(0),
+              MaxCoupledIterations(0)
         {
         }
     };
@@ -378,6 +383,8 @@ namespace HVACControllers {
                                 int const AirLoopControlNum // Controller index on this air loop
     );
 
+    void TrackCoupledAirLoopControllers(int const AirLoopNum, bool const IsConvergedFlag, int const NumIterations);
+
     void DumpAirLoopStatistics();
 
     void WriteAirLoopStatistics(int const FileUnit, DefinePrimaryAirSystem const &ThisPrimaryAirSystem, AirLoopStatsType const &ThisAirLoopStats);
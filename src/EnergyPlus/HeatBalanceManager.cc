@@ -278,6 +278,7 @@ namespace HeatBalanceManager {
         WarmupConvergenceValues.deallocate();
         UniqueMaterialNames.clear();
         UniqueConstructNames.clear();
+        surfaceOctree.clear();
     }
 
     void ManageHeatBalance()
@@ -338,9 +339,10 @@ namespace HeatBalanceManager {
             // Surface octree setup
             //  The surface octree holds live references to surfaces so it must be updated
             //   if in the future surfaces are altered after this point
-            if (TotSurfaces >= DaylightingManager::octreeCrossover) {                 // Octree can be active
-                if (inputProcessor->getNumObjectsFound("Daylighting:Controls") > 0) { // Daylighting is active
-                    surfaceOctree.init(DataSurfaces::Surface);                        // Set up surface octree
+            if (TotSurfaces >= DaylightingManager::octreeCrossover) { // Octree can be active
+                if (inputProcessor->getNumObjectsFound("Daylighting:Controls") > 0 ||
+                    DataSurfaces::CalcSolRefl) {               // Daylighting or exterior solar reflection ray tracing is active
+                    surfaceOctree.init(DataSurfaces::Surface); // Set up surface octree
                 }
             }
 
@@ -116,6 +116,7 @@
 #include <SurfaceGeometry.hh>
 #include <SwimmingPool.hh>
 #include <ThermalComfort.hh>
+#include <TimestepCheckpoint.hh>
 #include <UtilityRoutines.hh>
 #include <WCECommon.hpp>
 #include <WCEMultiLayerOptics.hpp>
@@ -193,6 +194,7 @@ namespace HeatBalanceSurfaceManager {
         bool UpdateThermalHistoriesFirstTimeFlag(true);
         bool CalculateZoneMRTfirstTime(true);          // Flag for first time calculations
         bool calcHeatBalanceInsideSurfFirstTime(true);
+        int InitSurfaceCheckpointNum(0); // Checkpoint of InitSurfaceHeatBalance results reused during demand resimulation
     }
 
     // These are now external subroutines
@@ -207,6 +209,7 @@ namespace HeatBalanceSurfaceManager {
         UpdateThermalHistoriesFirstTimeFlag = true;
         CalculateZoneMRTfirstTime = true;
         calcHeatBalanceInsideSurfFirstTime = true;
+        InitSurfaceCheckpointNum = 0;
     }
 
     void ManageSurfaceHeatBalance()
@@ -492,12 +495,19 @@ namespace HeatBalanceSurfaceManager {
         // complex fenestration needs to be initialized for additional states
         TimestepInitComplexFenestration();
 
+        // When the demand manager resimulates this timestep, the sky radiance multipliers and the history
+        // part of the CTF fluxes are copied back from the first pass: they depend only on the weather and on
+        // the surface histories, neither of which changes until the timestep is complete.
+        bool const RestoredFromCheckpoint(TimestepCheckpoint::Resimulating && TimestepCheckpoint::RestoreCheckpoint(InitSurfaceCheckpointNum));
+
         // Calculate exterior-surface multipliers that account for anisotropy of
         // sky radiance
-        if (SunIsUp && DifSolarRad > 0.0) {
-            AnisoSkyViewFactors();
-        } else {
-            AnisoSkyMult = 0.0;
+        if (!RestoredFromCheckpoint) {
+            if (SunIsUp && DifSolarRad > 0.0) {
+                AnisoSkyViewFactors();
+            } else {
+                AnisoSkyMult = 0.0;
+            }
         }
 
         // Set shading flag for exterior windows (except flags related to daylighting) and
@@ -749,85 +759,102 @@ namespace HeatBalanceSurfaceManager {
             InitHeatBalFiniteDiff();
         }
 
-        CTFConstOutPart = 0.0;
-        CTFConstInPart = 0.0;
-        if (AnyConstructInternalSourceInInput) {
-            CTFTsrcConstPart = 0.0;
-            CTFTuserConstPart = 0.0;
-        }
-        for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) { // Loop through all surfaces...
-            auto const &surface(Surface(SurfNum));
+        if (!RestoredFromCheckpoint) {
+            CTFConstOutPart = 0.0;
+            CTFConstInPart = 0.0;
+            if (AnyConstructInternalSourceInInput) {
+                CTFTsrcConstPart = 0.0;
+                CTFTuserConstPart = 0.0;
+            }
+            for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) { // Loop through all surfaces...
+                auto const &surface(Surface(SurfNum));
 
-            if (!surface.HeatTransSurf) continue; // Skip non-heat transfer surfaces
-            if (surface.HeatTransferAlgorithm != HeatTransferModel_CTF && surface.HeatTransferAlgorithm != HeatTransferModel_EMPD) continue;
-            if (surface.Class == SurfaceClass_Window) continue;
-            // Outside surface temp of "normal" windows not needed in Window5 calculation approach
-            // Window layer temperatures are calculated in CalcHeatBalanceInsideSurf
+                if (!surface.HeatTransSurf) continue; // Skip non-heat transfer surfaces
+                if (surface.HeatTransferAlgorithm != HeatTransferModel_CTF && surface.HeatTransferAlgorithm != HeatTransferModel_EMPD) continue;
+                if (surface.Class == SurfaceClass_Window) continue;
+                // Outside surface temp of "normal" windows not needed in Window5 calculation approach
+                // Window layer temperatures are calculated in CalcHeatBalanceInsideSurf
 
-            ConstrNum = surface.Construction;
-            auto const &construct(Construct(ConstrNum));
-            if (construct.NumCTFTerms > 1) { // COMPUTE CONSTANT PORTION OF CONDUCTIVE FLUXES.
+                ConstrNum = surface.Construction;
+                auto const &construct(Construct(ConstrNum));
+                if (construct.NumCTFTerms > 1) { // COMPUTE CONSTANT PORTION OF CONDUCTIVE FLUXES.
 
-                QIC = 0.0;
-                QOC = 0.0;
-                if (construct.SourceSinkPresent) {
-                    TSC = 0.0;
-                    TUC = 0.0;
-                }
-                auto l11(TH.index(1, 2, SurfNum));
-                auto l12(TH.index(2, 2, SurfNum));
-                auto const s3(TH.size3());
-                for (Term = 1; Term <= construct.NumCTFTerms;
-                     ++Term, l11 += s3, l12 += s3) { // [ l11 ] == ( 1, Term + 1, SurfNum ), [ l12 ] == ( 1, Term + 1, SurfNum )
+                    QIC = 0.0;
+                    QOC = 0.0;
+                    if (construct.SourceSinkPresent) {
+                        TSC = 0.0;
+                        TUC = 0.0;
+                    }
+                    auto l11(TH.index(1, 2, SurfNum));
+                    auto l12(TH.index(2, 2, SurfNum));
+                    auto const s3(TH.size3());
+                    for (Term = 1; Term <= construct.NumCTFTerms;
+                         ++Term, l11 += s3, l12 += s3) { // [ l11 ] == ( 1, Term + 1, SurfNum ), [ l12 ] == ( 1, Term + 1, SurfNum )
 
-                    // Sign convention for the various terms in the following two equations
-                    // is based on the form of the Conduction Transfer Function equation
-                    // given by:
-                    // Qin,now  = (Sum of)(Y Tout) - (Sum of)(Z Tin) + (Sum of)(F Qin,old)
-                    // Qout,now = (Sum of)(X Tout) - (Sum of)(Y Tin) + (Sum of)(F Qout,old)
-                    // In both equations, flux is positive from outside to inside.
+                        // Sign convention for the various terms in the following two equations
+                        // is based on the form of the Conduction Transfer Function equation
+                        // given by:
+                        // Qin,now  = (Sum of)(Y Tout) - (Sum of)(Z Tin) + (Sum of)(F Qin,old)
+                        // Qout,now = (Sum of)(X Tout) - (Sum of)(Y Tin) + (Sum of)(F Qout,old)
+                        // In both equations, flux is positive from outside to inside.
 
-                    // Tuned Aliases and linear indexing
-                    Real64 const ctf_cross(construct.CTFCross(Term));
-                    Real64 const TH11(TH[l11]);
-                    Real64 const TH12(TH[l12]);
+                        // Tuned Aliases and linear indexing
+                        Real64 const ctf_cross(construct.CTFCross(Term));
+                        Real64 const TH11(TH[l11]);
+                        Real64 const TH12(TH[l12]);
 
-                    QIC += ctf_cross * TH11 - construct.CTFInside(Term) * TH12 + construct.CTFFlux(Term) * QH[l12];
+                        QIC += ctf_cross * TH11 - construct.CTFInside(Term) * TH12 + construct.CTFFlux(Term) * QH[l12];
 
-                    QOC += construct.CTFOutside(Term) * TH11 - ctf_cross * TH12 + construct.CTFFlux(Term) * QH[l11];
+                        QOC += construct.CTFOutside(Term) * TH11 - ctf_cross * TH12 + construct.CTFFlux(Term) * QH[l11];
 
-                    if (construct.SourceSinkPresent) {
-                        Real64 const QsrcHist1(QsrcHist(SurfNum, Term + 1));
+                        if (construct.SourceSinkPresent) {
+                            Real64 const QsrcHist1(QsrcHist(SurfNum, Term + 1));
 
-                        QIC += construct.CTFSourceIn(Term) * QsrcHist1;
+                            QIC += construct.CTFSourceIn(Term) * QsrcHist1;
 
-                        QOC += construct.CTFSourceOut(Term) * QsrcHist1;
+                            QOC += construct.CTFSourceOut(Term) * QsrcHist1;
 
-                        TSC += construct.CTFTSourceOut(Term) * TH11 + construct.CTFTSourceIn(Term) * TH12 + construct.CTFTSourceQ(Term) * QsrcHist1 +
-                               construct.CTFFlux(Term) * TsrcHist(SurfNum, Term + 1);
+                            TSC += construct.CTFTSourceOut(Term) * TH11 + construct.CTFTSourceIn(Term) * TH12 +
+                                   construct.CTFTSourceQ(Term) * QsrcHist1 + construct.CTFFlux(Term) * TsrcHist(SurfNum, Term + 1);
 
-                        TUC += construct.CTFTUserOut(Term) * TH11 + construct.CTFTUserIn(Term) * TH12 + construct.CTFTUserSource(Term) * QsrcHist1 +
-                               construct.CTFFlux(Term) * TuserHist(SurfNum, Term + 1);
+                            TUC += construct.CTFTUserOut(Term) * TH11 + construct.CTFTUserIn(Term) * TH12 +
+                                   construct.CTFTUserSource(Term) * QsrcHist1 + construct.CTFFlux(Term) * TuserHist(SurfNum, Term + 1);
+                        }
                     }
-                }
 
-                CTFConstOutPart(SurfNum) = QOC;
-                CTFConstInPart(SurfNum) = QIC;
-                if (construct.SourceSinkPresent) {
-                    CTFTsrcConstPart(SurfNum) = TSC;
-                    CTFTuserConstPart(SurfNum) = TUC;
+                    CTFConstOutPart(SurfNum) = QOC;
+                    CTFConstInPart(SurfNum) = QIC;
+                    if (construct.SourceSinkPresent) {
+                        CTFTsrcConstPart(SurfNum) = TSC;
+                        CTFTuserConstPart(SurfNum) = TUC;
+                    }
+                } else { // Number of CTF Terms = 1-->Resistance only constructions have no history terms.
+
+                    CTFConstOutPart(SurfNum) = 0.0;
+                    CTFConstInPart(SurfNum) = 0.0;
+                    if (construct.SourceSinkPresent) {
+                        CTFTsrcConstPart(SurfNum) = 0.0;
+                        CTFTuserConstPart(SurfNum) = 0.0;
+                    }
                 }
-            } else { // Number of CTF Terms = 1-->Resistance only constructions have no history terms.
 
-                CTFConstOutPart(SurfNum) = 0.0;
-                CTFConstInPart(SurfNum) = 0.0;
-                if (construct.SourceSinkPresent) {
-                    CTFTsrcConstPart(SurfNum) = 0.0;
-                    CTFTuserConstPart(SurfNum) = 0.0;
+            } // ...end of surfaces DO loop for initializing temperature history terms for the surface heat balances
+
+            if (TimestepCheckpoint::CheckpointingActive) {
+                if (InitSurfaceCheckpointNum == 0) {
+                    InitSurfaceCheckpointNum = TimestepCheckpoint::RegisterCheckpoint("InitSurfaceHeatBalance");
+                    TimestepCheckpoint::RegisterBuffer(InitSurfaceCheckpointNum, AnisoSkyMult);
+                    TimestepCheckpoint::RegisterBuffer(InitSurfaceCheckpointNum, MultIsoSky);
+                    TimestepCheckpoint::RegisterBuffer(InitSurfaceCheckpointNum, MultCircumSolar);
+                    TimestepCheckpoint::RegisterBuffer(InitSurfaceCheckpointNum, MultHorizonZenith);
+                    TimestepCheckpoint::RegisterBuffer(InitSurfaceCheckpointNum, CTFConstOutPart);
+                    TimestepCheckpoint::RegisterBuffer(InitSurfaceCheckpointNum, CTFConstInPart);
+                    TimestepCheckpoint::RegisterBuffer(InitSurfaceCheckpointNum, CTFTsrcConstPart);
+                    TimestepCheckpoint::RegisterBuffer(InitSurfaceCheckpointNum, CTFTuserConstPart);
                 }
+                TimestepCheckpoint::SaveCheckpoint(InitSurfaceCheckpointNum);
             }
-
-        } // ...end of surfaces DO loop for initializing temperature history terms for the surface heat balances
+        }
 
         // Zero out all of the radiant system heat balance coefficient arrays
         RadSysTiHBConstCoef = 0.0;
@@ -6052,6 +6079,10 @@ namespace HeatBalanceSurfaceManager {
                 }
             }
 
+            if (DataHeatBalance::AnyEMPD) {
+                MoistureBalanceEMPDManager::CalcMoistureBalanceEMPDSurfaces(HTNonWindowSurfs, TempSurfInTmp);
+            }
+
             for (int SurfNum : HTNonWindowSurfs) {
                 // Perform heat balance on the inside face of the surface ...
                 // The following are possibilities here:
@@ -6082,7 +6113,7 @@ namespace HeatBalanceSurfaceManager {
                         surface.HeatTransferAlgorithm == HeatTransferModel_EMPD) { // Regular CTF Surface and/or EMPD surface
 
                         if (surface.HeatTransferAlgorithm == HeatTransferModel_EMPD) {
-                            MoistureBalanceEMPDManager::CalcMoistureBalanceEMPD(SurfNum, TempSurfInTmp(SurfNum), MAT_zone, TempSurfInSat);
+                            TempSurfInSat = DataMoistureBalanceEMPD::TempSurfSat(SurfNum); // Adiabatic surfaces are in the EMPD batch
                         }
                         // Pre-calculate a few terms
                         //
@@ -6180,7 +6211,11 @@ namespace HeatBalanceSurfaceManager {
                             surface.HeatTransferAlgorithm == HeatTransferModel_EMPD) { // Regular CTF Surface and/or EMPD surface
 
                             if (surface.HeatTransferAlgorithm == HeatTransferModel_EMPD) {
-                                MoistureBalanceEMPDManager::CalcMoistureBalanceEMPD(SurfNum, TempSurfInTmp(SurfNum), MAT_zone, TempSurfInSat);
+                                if (MoistureBalanceEMPDManager::IsBatchedEMPDSurface(SurfNum)) {
+                                    TempSurfInSat = DataMoistureBalanceEMPD::TempSurfSat(SurfNum);
+                                } else {
+                                    MoistureBalanceEMPDManager::CalcMoistureBalanceEMPD(SurfNum, TempSurfInTmp(SurfNum), MAT_zone, TempSurfInSat);
+                                }
                             }
                             // Pre-calculate a few terms
                             Real64 const TempTerm(CTFConstInPart(SurfNum) + QRadThermInAbs(SurfNum) + QRadSWInAbs(SurfNum) +
@@ -0,0 +1,170 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// C++ Headers
+#include <cmath>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/gio.hh>
+
+// EnergyPlus Headers
+#include <CondenserLoopTowers.hh>
+#include <DataGlobals.hh>
+#include <DataSystemVariables.hh>
+#include <EvaporativeFluidCoolers.hh>
+#include <FluidCoolers.hh>
+#include <General.hh>
+#include <HeatRejectionMemo.hh>
+
+namespace EnergyPlus {
+
+namespace HeatRejectionMemo {
+
+    // PURPOSE OF THIS MODULE:
+    // This module keeps the recent results of the cooling tower, evaporative fluid cooler and fluid cooler
+    // heat transfer models so that repeated evaluations at the same conditions are not recomputed.
+
+    // METHODOLOGY EMPLOYED:
+    // The heat rejection models are evaluated several times per plant iteration by the root solvers that
+    // find fan speed, range or UA, and the plant loop solver repeats the same evaluations on every pass
+    // through the loop within a timestep.  Each unit owns a small ring of its most recent evaluations
+    // keyed on every input that affects the model result (inlet water temperature, water and air flow,
+    // inlet air state and UA).  An evaluation whose inputs all match a stored entry to within
+    // MemoTolerance (relative) reuses the stored result.  The number of lookups and reused results of each
+    // unit are written to the eio file at the end of the run.
+
+    // Functions
+
+    bool ModelMemo::lookup(MemoKey const &InKey, MemoResult &OutResult)
+    {
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns true and the stored result when a stored evaluation matches the model inputs.
+
+        ++this->NumCalls;
+        for (int Entry = 0; Entry < this->NumEntries; ++Entry) {
+            MemoKey const &EntryKey(this->Key[Entry]);
+            bool Match(true);
+            for (int i = 0; i < MemoNumKeys; ++i) {
+                if (std::abs(EntryKey[i] - InKey[i]) > MemoTolerance * std::abs(InKey[i])) {
+                    Match = false;
+                    break;
+                }
+            }
+            if (Match) {
+                OutResult = this->Result[Entry];
+                ++this->NumHits;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void ModelMemo::store(MemoKey const &InKey, MemoResult const &InResult)
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Stores a model evaluation, replacing the oldest one once the memo is full.
+
+        this->Key[this->NextEntry] = InKey;
+        this->Result[this->NextEntry] = InResult;
+        this->NextEntry = (this->NextEntry + 1) % MemoSize;
+        if (this->NumEntries < MemoSize) ++this->NumEntries;
+    }
+
+    void ModelMemo::clear()
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Discards the stored evaluations at the start of each environment.  The lookup and reuse counts
+        // are kept so that the eio report covers the whole run.
+
+        this->NumEntries = 0;
+        this->NextEntry = 0;
+    }
+
+    void ReportMemoStatistics()
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Writes the number of model evaluations and reused results of each heat rejection unit to the eio file
+        // when requested with the TRACK_HEAT_REJECTION_MEMO environment variable.
+
+        static ObjexxFCL::gio::Fmt fmtA("(A)");
+        bool HeaderWritten(false);
+
+        if (!DataSystemVariables::TrackHeatRejectionMemoEnvFlag) {
+            return;
+        }
+
+        auto writeMemo = [&](std::string const &CompType, std::string const &CompName, std::string const &ModelName, ModelMemo const &Memo) {
+            if (Memo.NumCalls == 0) return;
+            if (!HeaderWritten) {
+                ObjexxFCL::gio::write(DataGlobals::OutputFileInits, fmtA)
+                    << "! <Heat Rejection Model Memo>, Component Type, Component Name, Model, Evaluations, Reused Results, Hit Rate {%}";
+                HeaderWritten = true;
+            }
+            ObjexxFCL::gio::write(DataGlobals::OutputFileInits, fmtA)
+                << "Heat Rejection Model Memo, " + CompType + ", " + CompName + ", " + ModelName + ", " + std::to_string(Memo.NumCalls) + ", " +
+                       std::to_string(Memo.NumHits) + ", " + General::RoundSigDigits(100.0 * Memo.NumHits / Memo.NumCalls, 1);
+        };
+
+        for (auto const &tower : CondenserLoopTowers::towers) {
+            writeMemo(tower.TowerType, tower.Name, "Merkel", tower.MerkelModelMemo);
+            writeMemo(tower.TowerType, tower.Name, "Variable Speed Range", tower.VSRangeMemo);
+        }
+        for (auto const &cooler : EvaporativeFluidCoolers::SimpleEvapFluidCooler) {
+            writeMemo(cooler.EvapFluidCoolerType, cooler.Name, "Merkel", cooler.MerkelModelMemo);
+        }
+        for (auto const &cooler : FluidCoolers::SimpleFluidCooler) {
+            writeMemo(cooler.FluidCoolerType, cooler.Name, "Effectiveness-NTU", cooler.OutletTempMemo);
+        }
+    }
+
+} // namespace HeatRejectionMemo
+
+} // namespace EnergyPlus
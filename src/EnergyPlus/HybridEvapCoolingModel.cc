@@ -125,7 +125,7 @@ namespace HybridEvapCoolingModel {
     CMode::CMode()
         : ModeID(0.0), Max_Msa(0.0), Min_Msa(0.0), Min_OAF(0.0), Max_OAF(0.0), Minimum_Outdoor_Air_Temperature(0.0),
           Maximum_Outdoor_Air_Temperature(0.0), Minimum_Outdoor_Air_Humidity_Ratio(0.0), Maximum_Outdoor_Air_Humidity_Ratio(0.0),
-          NormalizationReference(0.0), Correction(0.0)
+          NormalizationReference(0.0), Correction(0.0), CacheTosa(0.0), CacheWosa(0.0), CacheTra(0.0), CacheWra(0.0), CacheMsaReference(0.0)
     {
         MODE_BLOCK_OFFSET_Alpha = 9;
         BLOCK_HEADER_OFFSET_Alpha = 19;
@@ -322,6 +322,75 @@ namespace HybridEvapCoolingModel {
 
         return Y_val;
     }
+    void CMode::SetCurveCacheConditions(Real64 Tosa, Real64 Wosa, Real64 Tra, Real64 Wra, Real64 MsaReference)
+    {
+        // PURPOSE OF THIS SUBROUTINE:
+        // Invalidates the cached curve results at each solution space point unless the inlet conditions and supply air mass flow
+        // reference they were evaluated at are unchanged.
+
+        std::size_t const CacheSize = sol.PointX.size() * (WATER_USE + 1);
+        if (CurveValCache.size() == CacheSize && Tosa == CacheTosa && Wosa == CacheWosa && Tra == CacheTra && Wra == CacheWra &&
+            MsaReference == CacheMsaReference) {
+            return;
+        }
+        CurveValCache.assign(CacheSize, 0.0);
+        CurveValCacheValid.assign(CacheSize, false);
+        CacheTosa = Tosa;
+        CacheWosa = Wosa;
+        CacheTra = Tra;
+        CacheWra = Wra;
+        CacheMsaReference = MsaReference;
+    }
+
+    Real64 CMode::CachedCurveVal(int point_number, Real64 Tosa, Real64 Wosa, Real64 Tra, Real64 Wra, Real64 UnscaledMsa, Real64 OSAF, int curveType)
+    {
+        // PURPOSE OF THIS SUBROUTINE:
+        // Returns CalculateCurveVal for the solution space point point_number, reusing the result from an earlier call at the same
+        // conditions (set by SetCurveCacheConditions) when there is one.
+
+        // METHODOLOGY EMPLOYED:
+        // Results of curves under EMS override are never cached.
+
+        int CurvePointer = -1;
+        switch (curveType) {
+        case TEMP_CURVE:
+            CurvePointer = Tsa_curve_pointer;
+            break;
+        case W_CURVE:
+            CurvePointer = HRsa_curve_pointer;
+            break;
+        case POWER_CURVE:
+            CurvePointer = Psa_curve_pointer;
+            break;
+        case SUPPLY_FAN_POWER:
+            CurvePointer = SFPsa_curve_pointer;
+            break;
+        case EXTERNAL_STATIC_PRESSURE:
+            CurvePointer = ESPsa_curve_pointer;
+            break;
+        case SECOND_FUEL_USE:
+            CurvePointer = SFUsa_curve_pointer;
+            break;
+        case THIRD_FUEL_USE:
+            CurvePointer = TFUsa_curve_pointer;
+            break;
+        case WATER_USE:
+            CurvePointer = WUsa_curve_pointer;
+            break;
+        default:
+            break;
+        }
+        std::size_t const CacheIndex = std::size_t(point_number) * (WATER_USE + 1) + curveType;
+        if (CacheIndex >= CurveValCache.size() || (ValidPointer(CurvePointer) && CurveManager::PerfCurve(CurvePointer).EMSOverrideOn)) {
+            return CalculateCurveVal(Tosa, Wosa, Tra, Wra, UnscaledMsa, OSAF, curveType);
+        }
+        if (!CurveValCacheValid[CacheIndex]) {
+            CurveValCache[CacheIndex] = CalculateCurveVal(Tosa, Wosa, Tra, Wra, UnscaledMsa, OSAF, curveType);
+            CurveValCacheValid[CacheIndex] = true;
+        }
+        return CurveValCache[CacheIndex];
+    }
+
     void CMode::InitializeCurve(int curveType, int curve_ID)
     {
         // SUBROUTINE INFORMATION:
@@ -1062,7 +1131,7 @@ namespace HybridEvapCoolingModel {
         }
         return T;
     }
-    bool Model::SetStandByMode(CMode Mode0, Real64 Tosa, Real64 Wosa, Real64 Tra, Real64 Wra)
+    bool Model::SetStandByMode(CMode &Mode0, Real64 Tosa, Real64 Wosa, Real64 Tra, Real64 Wra)
     {
         // SUBROUTINE INFORMATION:
         //       AUTHOR         Spencer Maxwell Dutton
@@ -1083,7 +1152,7 @@ namespace HybridEvapCoolingModel {
         // Using/Aliasing
         // using the pointer to the first of the operating modes (which is always the standby mode by definition.
         // Get a handel to the map of possible solutions (valid combinations of OSA fraction and Msa)
-        CModeSolutionSpace solutionspace = Mode0.sol;
+        CModeSolutionSpace const &solutionspace = Mode0.sol;
         // assess the sixe of the solution space to make sure it holds at least 1 combination
         int solution_map_sizeX = solutionspace.PointX.size();
         // Check the normalization reference is set if not set a default
@@ -1433,14 +1502,14 @@ namespace HybridEvapCoolingModel {
 
         MinOA_Msa = StepIns.MinimumOA; // Set object version of minimum VR Kg/s
 
-        std::vector<CMode>::const_iterator iterator;
+        std::vector<CMode>::iterator iterator;
         iterator = OperatingModes.begin();
         // skip the first one becuase that is standby
         ++iterator;
         for (; iterator != OperatingModes.end(); ++iterator) // iterate though the modes.
         {
-            CMode Mode = *iterator;
-            CModeSolutionSpace solutionspace = Mode.sol;
+            CMode &Mode = *iterator;
+            CModeSolutionSpace const &solutionspace = Mode.sol;
             bool SAHR_OC_MetinMode = false;
             bool SAT_OC_MetinMode = false;
             int solution_map_sizeX = solutionspace.PointX.size() - 1;
@@ -1463,6 +1532,9 @@ namespace HybridEvapCoolingModel {
                 if (ModelNormalizationReference == 0) {
                     ModelNormalizationReference = 1; // this should never happen because it calls the SetStandBy mode first.
                 }
+                // Curve results only depend on the inlet conditions and the point in the solution space, so reuse them when the inlet
+                // conditions repeat (e.g. across HVAC iterations within a timestep)
+                Mode.SetCurveCacheConditions(StepIns.Tosa, Wosa, StepIns.Tra, Wra, ModelNormalizationReference);
                 for (point_number = 0; point_number != solution_map_sizeX;
                      point_number++) // within each mode go though all the combinations of solution spaces.
                 {
@@ -1492,9 +1564,8 @@ namespace HybridEvapCoolingModel {
 
                     if (MinVRMet) {
                         // all these points meet the minimum VR requirement
-                        solutionspace.PointMeta[point_number] = 1;
                         // Calculate prospective supply air temperature
-                        Tsa = Mode.CalculateCurveVal(StepIns.Tosa, Wosa, StepIns.Tra, Wra, UnscaledMsa, OSAF, TEMP_CURVE);
+                        Tsa = Mode.CachedCurveVal(point_number, StepIns.Tosa, Wosa, StepIns.Tra, Wra, UnscaledMsa, OSAF, TEMP_CURVE);
                         // Check it meets constraints
                         if (MeetsSupplyAirTOC(Tsa)) {
                             SAT_OC_Met = SAT_OC_MetOnce = SAT_OC_MetinMode = true;
@@ -1502,7 +1573,7 @@ namespace HybridEvapCoolingModel {
                             SAT_OC_Met = false;
                         }
                         // Calculate prospective supply air Humidity Ratio
-                        Wsa = Mode.CalculateCurveVal(StepIns.Tosa, Wosa, StepIns.Tra, Wra, UnscaledMsa, OSAF, W_CURVE);
+                        Wsa = Mode.CachedCurveVal(point_number, StepIns.Tosa, Wosa, StepIns.Tra, Wra, UnscaledMsa, OSAF, W_CURVE);
                         // Return Air Relative Humidity(0 - 100 % ) //Return Air Humidity Ratio(g / g)
                         if (MeetsSupplyAirRHOC(Wsa)) {
                             SARH_OC_Met = SAHR_OC_MetOnce = SAHR_OC_MetinMode = true;
@@ -1521,7 +1592,7 @@ namespace HybridEvapCoolingModel {
                                 MsaRatio *
                                 ScaledSystemMaximumSupplyAirMassFlowRate; // spencer is this the same as Correction if so make them the same.
                             CandidateSetting.ScaledSupply_Air_Ventilation_Volume = MsaRatio * ScaledSystemMaximumSupplyAirMassFlowRate / StdRhoAir;
-                            CandidateSetting.oMode = Mode;
+                            CandidateSetting.SolutionPoint = point_number;
                             CandidateSetting.SupplyAirTemperature = Tsa;
                             CandidateSetting.SupplyAirW = CheckVal_W(Wsa, Tsa, OutletPressure);
                             CandidateSetting.Mode = Mode.ModeID;
@@ -1628,21 +1699,24 @@ namespace HybridEvapCoolingModel {
                 Humidification_load_met = true;
             }
 
+            CMode &SettingMode = OperatingModes[modenumber];
+            SettingMode.SetCurveCacheConditions(StepIns.Tosa, Wosa, StepIns.Tra, Wra, ModelNormalizationReference);
             Real64 Y_val =
-                thisSetting.oMode.CalculateCurveVal(StepIns.Tosa, Wosa, StepIns.Tra, Wra, UnscaledMsa, OSAF, POWER_CURVE); // fix modenumber not set
+                SettingMode.CachedCurveVal(thisSetting.SolutionPoint, StepIns.Tosa, Wosa, StepIns.Tra, Wra, UnscaledMsa, OSAF, POWER_CURVE);
             ElectricalPower = Y_val; // [Kw] calculations for fuel in Kw
             thisSetting.ElectricalPower = ElectricalPower;
 
             thisSetting.SupplyFanElectricPower =
-                thisSetting.oMode.CalculateCurveVal(StepIns.Tosa, Wosa, StepIns.Tra, Wra, UnscaledMsa, OSAF, SUPPLY_FAN_POWER);
+                SettingMode.CachedCurveVal(thisSetting.SolutionPoint, StepIns.Tosa, Wosa, StepIns.Tra, Wra, UnscaledMsa, OSAF, SUPPLY_FAN_POWER);
             thisSetting.ExternalStaticPressure =
-                thisSetting.oMode.CalculateCurveVal(StepIns.Tosa, Wosa, StepIns.Tra, Wra, UnscaledMsa, OSAF, EXTERNAL_STATIC_PRESSURE);
+                SettingMode.CachedCurveVal(
+                    thisSetting.SolutionPoint, StepIns.Tosa, Wosa, StepIns.Tra, Wra, UnscaledMsa, OSAF, EXTERNAL_STATIC_PRESSURE);
             thisSetting.SecondaryFuelConsumptionRate =
-                thisSetting.oMode.CalculateCurveVal(StepIns.Tosa, Wosa, StepIns.Tra, Wra, UnscaledMsa, OSAF, SECOND_FUEL_USE);
+                SettingMode.CachedCurveVal(thisSetting.SolutionPoint, StepIns.Tosa, Wosa, StepIns.Tra, Wra, UnscaledMsa, OSAF, SECOND_FUEL_USE);
             thisSetting.ThirdFuelConsumptionRate =
-                thisSetting.oMode.CalculateCurveVal(StepIns.Tosa, Wosa, StepIns.Tra, Wra, UnscaledMsa, OSAF, THIRD_FUEL_USE);
+                SettingMode.CachedCurveVal(thisSetting.SolutionPoint, StepIns.Tosa, Wosa, StepIns.Tra, Wra, UnscaledMsa, OSAF, THIRD_FUEL_USE);
             thisSetting.WaterConsumptionRate =
-                thisSetting.oMode.CalculateCurveVal(StepIns.Tosa, Wosa, StepIns.Tra, Wra, UnscaledMsa, OSAF, WATER_USE);
+                SettingMode.CachedCurveVal(thisSetting.SolutionPoint, StepIns.Tosa, Wosa, StepIns.Tra, Wra, UnscaledMsa, OSAF, WATER_USE);
 
             // Calculate EIR
             EIR = ElectricalPower / TotalSystem;
@@ -1954,7 +2028,7 @@ namespace HybridEvapCoolingModel {
         // Take the first operating mode which is always standby and calculate the NormalizationReference
         // and then use curves to determine performance metrics for the standby mode including energy use and other outputs
 
-        CMode Mode = *(OperatingModes.begin());
+        CMode &Mode = *(OperatingModes.begin());
         //
         if (SetStandByMode(Mode, StepIns.Tosa, Wosa, StepIns.Tra, Wra)) {
             std::string ObjectID = Name.c_str();
@@ -165,8 +165,18 @@ namespace HybridEvapCoolingModel {
         bool GenerateSolutionSpace(Real64 ResolutionMsa, Real64 ResolutionOSA);
         bool MeetsOAEnvConstraints(Real64 Tosa, Real64 Wosa, Real64 RHos);
         bool CheckNormalizationReference(int CurveID, std::string cCurrentModuleObject);
+        void SetCurveCacheConditions(Real64 Tosa, Real64 Wosa, Real64 Tra, Real64 Wra, Real64 MsaReference);
+        Real64 CachedCurveVal(int point_number, Real64 Tosa, Real64 Wosa, Real64 Tra, Real64 Wra, Real64 UnscaledMsa, Real64 OSAF, int curveType);
 
     private:
+        // Curve results at each solution space point, valid for the conditions below
+        std::vector<Real64> CurveValCache;
+        std::vector<bool> CurveValCacheValid;
+        Real64 CacheTosa;
+        Real64 CacheWosa;
+        Real64 CacheTra;
+        Real64 CacheWra;
+        Real64 CacheMsaReference;
     };
 
     class CSetting
@@ -177,7 +187,7 @@ namespace HybridEvapCoolingModel {
               Supply_Air_Ventilation_Volume(0), ScaledSupply_Air_Ventilation_Volume(0), Supply_Air_Mass_Flow_Rate_Ratio(0), SupplyAirTemperature(0),
               Mixed_Air_Temperature(0), SupplyAirW(0), Mixed_Air_W(0), TotalSystem(0), SensibleSystem(0), LatentSystem(0), TotalZone(0),
               SensibleZone(0), LatentZone(0), ElectricalPower(IMPLAUSIBLE_POWER), SupplyFanElectricPower(0), SecondaryFuelConsumptionRate(0),
-              ThirdFuelConsumptionRate(0), WaterConsumptionRate(0), ExternalStaticPressure(0)
+              ThirdFuelConsumptionRate(0), WaterConsumptionRate(0), ExternalStaticPressure(0), SolutionPoint(0)
         {
         }
         Real64 Runtime_Fraction;
@@ -204,8 +214,7 @@ namespace HybridEvapCoolingModel {
         Real64 ThirdFuelConsumptionRate;
         Real64 WaterConsumptionRate;
         Real64 ExternalStaticPressure;
-
-        CMode oMode;
+        int SolutionPoint; // index of this setting in the solution space of OperatingModes[Mode]
     };
 
     class CStepInputs
@@ -386,7 +395,7 @@ namespace HybridEvapCoolingModel {
         bool MeetsSupplyAirRHOC(Real64 Wosa);
         Real64 CheckVal_T(Real64 T);
         Real64 CheckVal_W(Real64 W, Real64 T, Real64 P); // pascals
-        bool SetStandByMode(CMode Mode0, Real64 Tosa, Real64 Wosa, Real64 Tra, Real64 Wra);
+        bool SetStandByMode(CMode &Mode0, Real64 Tosa, Real64 Wosa, Real64 Tra, Real64 Wra);
         Real64 CalculateTimeStepAverage(SYSTEMOUTPUTS val);
         int SetOperatingSetting(CStepInputs StepIns);
         void DetermineCoolingVentilationOrHumidificationNeeds(CStepInputs &StepIns);
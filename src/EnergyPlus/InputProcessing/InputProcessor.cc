@@ -562,6 +562,123 @@ const json& InputProcessor::getObjectInstances(std::string const &ObjType)
     return epJSON.find(ObjType).value();
 }
 
+std::vector<InputObjectView> InputProcessor::getObjectViews(std::string const &objectType)
+{
+    std::vector<InputObjectView> views;
+
+    auto find_iterators = objectCacheMap.find(objectType);
+    if (find_iterators == objectCacheMap.end()) {
+        auto const tmp_umit = caseInsensitiveObjectMap.find(convertToUpper(objectType));
+        if (tmp_umit == caseInsensitiveObjectMap.end() || epJSON.find(tmp_umit->second) == epJSON.end()) {
+            return views;
+        }
+        find_iterators = objectCacheMap.find(tmp_umit->second);
+        if (find_iterators == objectCacheMap.end()) return views;
+    }
+
+    auto const &canonicalObjectType = find_iterators->first;
+    auto const &epJSON_schema_it_val = find_iterators->second.schemaIterator.value();
+    auto const &schema_obj_props = getPatternProperties(epJSON_schema_it_val);
+    std::string extension_key;
+    auto const &legacy_idd = epJSON_schema_it_val.find("legacy_idd");
+    if (legacy_idd != epJSON_schema_it_val.end()) {
+        auto const key = legacy_idd.value().find("extension");
+        if (key != legacy_idd.value().end()) {
+            extension_key = key.value();
+        }
+    }
+
+    // Same order as getObjectItem, but the idf order is sorted once instead of once per object (see getJSONObjNum)
+    std::vector<json::const_iterator> objects(find_iterators->second.inputObjectIterators);
+    if (!DataGlobals::isEpJSON && DataGlobals::preserveIDFOrder) {
+        std::stable_sort(objects.begin(), objects.end(), [](json::const_iterator const &a, json::const_iterator const &b) {
+            return a.value().at("idf_order").get<int>() < b.value().at("idf_order").get<int>();
+        });
+    }
+
+    views.reserve(objects.size());
+    for (auto const &obj : objects) {
+        markObjectAsUsed(canonicalObjectType, obj.key());
+        views.emplace_back(obj, schema_obj_props, extension_key);
+    }
+    return views;
+}
+
+InputObjectView::InputObjectView(json::const_iterator const &object, json const &schemaProperties, std::string const &extensionKey)
+    : InputFieldsView(object.value(), schemaProperties), object(object), extensibles(nullptr), extensibleSchemaProperties(nullptr)
+{
+    if (extensionKey.empty()) return;
+    auto const found_extensibles = object.value().find(extensionKey);
+    auto const found_schema = schemaProperties.find(extensionKey);
+    if (found_extensibles == object.value().end() || found_schema == schemaProperties.end()) return;
+    extensibles = &found_extensibles.value();
+    extensibleSchemaProperties = &found_schema.value().at("items").at("properties");
+}
+
+json const *InputFieldsView::fieldDefault(std::string const &fieldName) const
+{
+    auto const found_schema_field = schemaProperties->find(fieldName);
+    if (found_schema_field == schemaProperties->end()) return nullptr;
+    auto const found_default = found_schema_field.value().find("default");
+    if (found_default == found_schema_field.value().end()) return nullptr;
+    return &found_default.value();
+}
+
+bool InputFieldsView::isBlank(std::string const &fieldName) const
+{
+    auto const found_field = fields->find(fieldName);
+    if (found_field == fields->end()) return true;
+    return found_field.value().is_string() && found_field.value().get_ref<std::string const &>().empty();
+}
+
+std::string const &InputFieldsView::alpha(std::string const &fieldName) const
+{
+    static std::string const blank;
+    json const *value = nullptr;
+    auto const found_field = fields->find(fieldName);
+    if (found_field != fields->end() && !(found_field.value().is_string() && found_field.value().get_ref<std::string const &>().empty())) {
+        value = &found_field.value();
+    } else {
+        value = fieldDefault(fieldName);
+    }
+    if (value == nullptr) return blank;
+    if (value->is_string()) return value->get_ref<std::string const &>();
+    char s[129] = {0};
+    if (value->is_number_integer()) {
+        i64toa(value->get<std::int64_t>(), s);
+    } else {
+        dtoa(value->get<double>(), s);
+    }
+    numericAlpha = s;
+    return numericAlpha;
+}
+
+Real64 InputFieldsView::number(std::string const &fieldName) const
+{
+    json const *value = nullptr;
+    auto const found_field = fields->find(fieldName);
+    if (found_field != fields->end() && !(found_field.value().is_string() && found_field.value().get_ref<std::string const &>().empty())) {
+        value = &found_field.value();
+    } else {
+        value = fieldDefault(fieldName);
+    }
+    if (value == nullptr) return 0.0;
+    if (value->is_number_integer()) return value->get<std::int64_t>();
+    if (value->is_number()) return value->get<double>();
+    return value->get_ref<std::string const &>().empty() ? 0.0 : -99999; // autosize and autocalculate
+}
+
+bool InputFieldsView::isAutosizeOrAutocalculate(std::string const &fieldName) const
+{
+    auto const found_field = fields->find(fieldName);
+    if (found_field != fields->end() && found_field.value().is_string() && !found_field.value().get_ref<std::string const &>().empty()) {
+        return true;
+    }
+    if (found_field != fields->end() && found_field.value().is_number()) return false;
+    json const *value = fieldDefault(fieldName);
+    return value != nullptr && value->is_string() && !value->get_ref<std::string const &>().empty();
+}
+
 void InputProcessor::getObjectItem(std::string const &Object,
                                    int const Number,
                                    Array1S_string Alphas,
@@ -74,6 +74,68 @@ namespace EnergyPlus {
 
 void cleanEPJSON(nlohmann::json &epjson);
 
+// Read-only view of the fields of one stored input object, or of one of its extensible groups.
+// Fields are looked up by their epJSON field name and string values are returned by reference into the
+// stored input (or the schema default), so nothing is copied. Unlike getObjectItem, alpha values keep the
+// case they were entered with; compare them with UtilityRoutines::SameString.
+class InputFieldsView
+{
+public:
+    using json = nlohmann::json;
+
+    InputFieldsView(json const &fields, json const &schemaProperties) : fields(&fields), schemaProperties(&schemaProperties)
+    {
+    }
+
+    // true if the field was not entered or was entered as an empty string
+    bool isBlank(std::string const &fieldName) const;
+
+    // entered value, else the schema default, else an empty string
+    std::string const &alpha(std::string const &fieldName) const;
+
+    // entered value, else the schema default, else zero; autosize and autocalculate are returned as -99999 like getObjectItem
+    Real64 number(std::string const &fieldName) const;
+
+    // true if the field was entered, or defaults, as Autosize or Autocalculate
+    bool isAutosizeOrAutocalculate(std::string const &fieldName) const;
+
+protected:
+    json const *fieldDefault(std::string const &fieldName) const;
+
+    json const *fields;
+    json const *schemaProperties;
+    mutable std::string numericAlpha; // alpha fields that were entered as a number
+};
+
+// Read-only view of one stored input object
+class InputObjectView : public InputFieldsView
+{
+public:
+    InputObjectView(json::const_iterator const &object, json const &schemaProperties, std::string const &extensionKey);
+
+    // object name as entered
+    std::string const &name() const
+    {
+        return object.key();
+    }
+
+    std::size_t numExtensibleGroups() const
+    {
+        return (extensibles != nullptr) ? extensibles->size() : 0u;
+    }
+
+    // extensible group by position, 1-based like the legacy field numbering
+    InputFieldsView extensibleGroup(std::size_t const groupNum) const
+    {
+        return InputFieldsView((*extensibles)[groupNum - 1], *extensibleSchemaProperties);
+    }
+
+private:
+    json::const_iterator object;
+    json const *extensibles;                // array of extensible groups, nullptr if none were entered
+    json const *extensibleSchemaProperties; // schema of the fields of one extensible group
+};
+
 class InputProcessor
 {
 public:
@@ -181,6 +243,9 @@ public:
 
     const json& getObjectInstances(std::string const &ObjType);
 
+    // views of all objects of a type, in the same order as getObjectItem numbers them; the objects are marked as used
+    std::vector<InputObjectView> getObjectViews(std::string const &objectType);
+
 private:
     struct ObjectInfo
     {
@@ -126,6 +126,7 @@ namespace MoistureBalanceEMPDManager {
     // Data
     // MODULE VARIABLE and Function DECLARATIONs
     Array1D<EMPDReportVarsData> EMPDReportVars; // Array of structs that hold the empd report vars data, one for each surface.
+    Array1D<EMPDSurfaceCoeffsData> EMPDSurfaceCoeffs; // Inside layer material terms, one for each surface
     bool InitEnvrnFlag(true);
 
     // SUBROUTINE SPECIFICATION FOR MODULE MoistureBalanceEMPDManager
@@ -136,6 +137,7 @@ namespace MoistureBalanceEMPDManager {
     void clear_state()
     {
         EMPDReportVars.deallocate();
+        EMPDSurfaceCoeffs.deallocate();
         InitEnvrnFlag = true;
     }
 
@@ -391,6 +393,8 @@ namespace MoistureBalanceEMPDManager {
             RVDeepLayer.allocate(TotSurfaces);
             RVdeepOld.allocate(TotSurfaces);
             RVwall.allocate(TotSurfaces);
+            TempSurfSat.dimension(TotSurfaces, -KelvinConv); // no dew point limit until a surface is evaluated
+            EMPDSurfaceCoeffs.allocate(TotSurfaces);
         }
 
         for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
@@ -439,6 +443,68 @@ namespace MoistureBalanceEMPDManager {
         if (InitEnvrnFlag) InitEnvrnFlag = false;
     }
 
+    void SetEMPDSurfaceCoeffs(int const SurfNum)
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Collect the inside layer material terms used by the EMPD balance of a surface. They are refreshed
+        // whenever the surface construction changes, e.g. through an EMS construction override.
+
+        auto &coeffs(EMPDSurfaceCoeffs(SurfNum));
+        int const ConstrNum = Surface(SurfNum).Construction;
+        int const MatNum = Construct(ConstrNum).LayerPoint(Construct(ConstrNum).TotLayers);
+        auto const &material(Material(MatNum));
+
+        coeffs.ConstrNum = ConstrNum;
+        coeffs.MatNum = MatNum;
+        coeffs.ABCoeff = material.MoistACoeff * material.MoistBCoeff;
+        coeffs.BCoeffLessOne = material.MoistBCoeff - 1;
+        coeffs.CDCoeff = material.MoistCCoeff * material.MoistDCoeff;
+        coeffs.DCoeffLessOne = material.MoistDCoeff - 1;
+        coeffs.DensitySurfaceDepth = material.Density * material.EMPDSurfaceDepth;
+        coeffs.DensityDeepDepth = material.EMPDDeepDepth * material.Density;
+        coeffs.CoatingThicknessMu = material.EMPDCoatingThickness * material.EMPDmuCoating;
+    }
+
+    bool IsBatchedEMPDSurface(int const SurfNum)
+    {
+
+        // PURPOSE OF THIS FUNCTION:
+        // True for EMPD surfaces whose inside heat balance always evaluates the EMPD model, i.e. adiabatic
+        // surfaces and surfaces without inside movable insulation. These are evaluated together by
+        // CalcMoistureBalanceEMPDSurfaces; surfaces with movable insulation are evaluated by the heat balance
+        // only when the insulation is not deployed.
+
+        auto const &surface(Surface(SurfNum));
+        return (surface.HeatTransferAlgorithm == DataSurfaces::HeatTransferModel_EMPD) &&
+               ((surface.ExtBoundCond == SurfNum) || (surface.MaterialMovInsulInt <= 0));
+    }
+
+    void CalcMoistureBalanceEMPDSurfaces(std::vector<int> const &SurfNums, // Surfaces in the current inside heat balance
+                                         Array1D<Real64> const &TempSurfIn  // Inside surface temperatures from the last iteration
+    )
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Evaluate the EMPD model for all batched EMPD surfaces once per inside heat balance iteration.
+        // The dew point temperatures are left in TempSurfSat for the surface heat balance.
+
+        // METHODOLOGY EMPLOYED:
+        // Each surface only depends on its own inside temperature from the previous iteration and on the zone
+        // air state, neither of which changes while the heat balance sweeps the surfaces, so evaluating them
+        // ahead of the sweep gives the same results as evaluating them one at a time within it.
+
+        using DataHeatBalFanSys::MAT;
+
+        for (int const SurfNum : SurfNums) {
+            if (!IsBatchedEMPDSurface(SurfNum)) continue;
+            // TempSurfSat is only allocated once the first call has initialized the module
+            Real64 TempSat(TempSurfSat.allocated() ? TempSurfSat(SurfNum) : -KelvinConv);
+            CalcMoistureBalanceEMPD(SurfNum, TempSurfIn(SurfNum), MAT(Surface(SurfNum).Zone), TempSat);
+            TempSurfSat(SurfNum) = TempSat;
+        }
+    }
+
     void CalcMoistureBalanceEMPD(int const SurfNum,
                                  Real64 const TempSurfIn, // INSIDE SURFACE TEMPERATURE at current time step
                                  Real64 const TempZone,   // Zone temperature at current time step.
@@ -461,7 +527,6 @@ namespace MoistureBalanceEMPDManager {
         // Using/Aliasing
         using DataMoistureBalanceEMPD::Lam;
         using Psychrometrics::PsyCpAirFnWTdb;
-        using Psychrometrics::PsyPsatFnTemp;
         using Psychrometrics::PsyRhFnTdbRhov;
         using Psychrometrics::PsyRhFnTdbRhovLBnd0C;
         using Psychrometrics::PsyRhFnTdbWPb;
@@ -476,7 +541,6 @@ namespace MoistureBalanceEMPDManager {
 
         // SUBROUTINE PARAMETER DEFINITIONS:
         // Real64 const Lam( 2500000.0 ); // Heat of vaporization (J/kg)
-        static std::string const RoutineName("CalcMoistureEMPD");
 
         // INTERFACE BLOCK SPECIFICATIONS
         // na
@@ -486,8 +550,6 @@ namespace MoistureBalanceEMPDManager {
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
         int NOFITR;           // Number of iterations
-        int MatNum;           // Material number at interior layer
-        int ConstrNum;        // Construction number
         Real64 hm_deep_layer; // Overall deep-layer transfer coefficient
         Real64 RSurfaceLayer; // Mass transfer resistance between actual surface and surface layer node
         Real64 Taver;         // Average zone temperature between current time and previous time
@@ -500,7 +562,6 @@ namespace MoistureBalanceEMPDManager {
         Real64 PVsurf;        // Surface vapor pressure
         Real64 PV_surf_layer; // Vapor pressure of surface layer
         Real64 PV_deep_layer;
-        Real64 PVsat; // saturation vapor pressure at the surface
         Real64 RH_surf_layer_old;
         Real64 RH_deep_layer_old;
         Real64 EMPDdiffusivity;
@@ -544,10 +605,10 @@ namespace MoistureBalanceEMPDManager {
         if (!surface.HeatTransSurf) {
             return;
         }
-        ConstrNum = surface.Construction;
-        MatNum = Construct(ConstrNum).LayerPoint(Construct(ConstrNum).TotLayers); // Then find the material pointer
+        auto &coeffs(EMPDSurfaceCoeffs(SurfNum));
+        if (coeffs.ConstrNum != surface.Construction) SetEMPDSurfaceCoeffs(SurfNum);
 
-        auto const &material(Material(MatNum));
+        auto const &material(Material(coeffs.MatNum));
         if (material.EMPDmu <= 0.0) {
             rv_surface = PsyRhovFnTdbWPb(TempZone, ZoneAirHumRat(surface.Zone), OutBaroPress);
             return;
@@ -558,20 +619,20 @@ namespace MoistureBalanceEMPDManager {
         RVaver = rv_surface_old;
         RHaver = RVaver * 461.52 * (Taver + KelvinConv) * std::exp(-23.7093 + 4111.0 / (Taver + 237.7));
 
-        // Calculate the saturated vapor pressure, surface vapor pressure and dewpoint. Used to check for condensation in HeatBalanceSurfaceManager
-        PVsat = PsyPsatFnTemp(Taver, RoutineName);
-        PVsurf = RHaver * std::exp(23.7093 - 4111.0 / (Taver + 237.7));
+        // Calculate the surface vapor pressure and dewpoint. Used to check for condensation in HeatBalanceSurfaceManager
+        Real64 const PsatTaver = std::exp(23.7093 - 4111.0 / (Taver + 237.7)); // Saturation vapor pressure at the surface [Pa]
+        PVsurf = RHaver * PsatTaver;
         TempSat = 4111.0 / (23.7093 - std::log(PVsurf)) + 35.45 - KelvinConv;
 
         // Convert vapor resistance factor (user input) to diffusivity. Evaluate at local surface temperature.
         // 2e-7*T^0.81/P = vapor diffusivity in air. [kg/m-s-Pa]
         // 461.52 = universal gas constant for water [J/kg-K]
         // EMPDdiffusivity = [m^2/s]
-        EMPDdiffusivity = (2.0e-7 * pow(Taver + KelvinConv, 0.81) / OutBaroPress) / material.EMPDmu * 461.52 * (Taver + KelvinConv);
+        Real64 const TaverKPow = pow(Taver + KelvinConv, 0.81);
+        EMPDdiffusivity = (2.0e-7 * TaverKPow / OutBaroPress) / material.EMPDmu * 461.52 * (Taver + KelvinConv);
 
         // Calculate slope of moisture sorption curve at current RH. [kg/kg-RH]
-        dU_dRH = material.MoistACoeff * material.MoistBCoeff * pow(RHaver, material.MoistBCoeff - 1) +
-                 material.MoistCCoeff * material.MoistDCoeff * pow(RHaver, material.MoistDCoeff - 1);
+        dU_dRH = coeffs.ABCoeff * pow(RHaver, coeffs.BCoeffLessOne) + coeffs.CDCoeff * pow(RHaver, coeffs.DCoeffLessOne);
 
         // Convert vapor density and temperature of zone air to RH
         RHZone = rho_vapor_air_in * 461.52 * (TempZone + KelvinConv) * std::exp(-23.7093 + 4111.0 / ((TempZone + KelvinConv) - 35.45));
@@ -585,8 +646,7 @@ namespace MoistureBalanceEMPDManager {
         if (material.EMPDmuCoating <= 0.0) {
             Rcoating = 0;
         } else {
-            Rcoating = material.EMPDCoatingThickness * material.EMPDmuCoating * OutBaroPress /
-                       (2.0e-7 * pow(Taver + KelvinConv, 0.81) * 461.52 * (Taver + KelvinConv));
+            Rcoating = coeffs.CoatingThicknessMu * OutBaroPress / (2.0e-7 * TaverKPow * 461.52 * (Taver + KelvinConv));
         }
 
         // Calculate mass-transfer coefficient between zone air and center of surface layer. [m/s]
@@ -603,14 +663,13 @@ namespace MoistureBalanceEMPDManager {
         RSurfaceLayer = 1.0 / hm_surf_layer - 1.0 / h_mass_conv_in_fd;
 
         // Calculate vapor flux leaving surface layer, entering deep layer, and entering zone.
-        mass_flux_surf_deep_max =
-            material.EMPDDeepDepth * material.Density * dU_dRH * (RH_surf_layer_old - RH_deep_layer_old) / (TimeStepZone * 3600.0);
+        mass_flux_surf_deep_max = coeffs.DensityDeepDepth * dU_dRH * (RH_surf_layer_old - RH_deep_layer_old) / (TimeStepZone * 3600.0);
         mass_flux_surf_deep = hm_deep_layer * (rv_surf_layer_old - rv_deep_old);
         if (std::abs(mass_flux_surf_deep_max) < std::abs(mass_flux_surf_deep)) {
             mass_flux_surf_deep = mass_flux_surf_deep_max;
         }
 
-        mass_flux_zone_surf_max = material.EMPDSurfaceDepth * material.Density * dU_dRH * (RHZone - RH_surf_layer_old) / (TimeStepZone * 3600.0);
+        mass_flux_zone_surf_max = coeffs.DensitySurfaceDepth * dU_dRH * (RHZone - RH_surf_layer_old) / (TimeStepZone * 3600.0);
         mass_flux_zone_surf = hm_surf_layer * (rho_vapor_air_in - rv_surf_layer_old);
         if (std::abs(mass_flux_zone_surf_max) < std::abs(mass_flux_zone_surf)) {
             mass_flux_zone_surf = mass_flux_zone_surf_max;
@@ -626,7 +685,7 @@ namespace MoistureBalanceEMPDManager {
 
         // Calculate new surface layer RH using mass balance on surface layer
         RH_surf_layer_tmp =
-            RH_surf_layer_old + TimeStepZone * 3600.0 * (-mass_flux_surf_layer / (material.Density * material.EMPDSurfaceDepth * dU_dRH));
+            RH_surf_layer_old + TimeStepZone * 3600.0 * (-mass_flux_surf_layer / (coeffs.DensitySurfaceDepth * dU_dRH));
 
         //	RH_surf_layer = RH_surf_layer_tmp;
 
@@ -674,15 +733,15 @@ namespace MoistureBalanceEMPDManager {
         if (material.EMPDDeepDepth <= 0.0) {
             RH_deep_layer = RH_deep_layer_old;
         } else {
-            RH_deep_layer = RH_deep_layer_old + TimeStepZone * 3600.0 * mass_flux_deep_layer / (material.Density * material.EMPDDeepDepth * dU_dRH);
+            RH_deep_layer = RH_deep_layer_old + TimeStepZone * 3600.0 * mass_flux_deep_layer / (coeffs.DensityDeepDepth * dU_dRH);
         }
         // Convert calculated RH back to vapor density of surface and deep layers.
         rv_surf_layer = PsyRhovFnTdbRh(Taver, RH_surf_layer);
         rv_deep_layer = PsyRhovFnTdbRh(Taver, RH_deep_layer);
 
         // Calculate surface-layer and deep-layer vapor pressures [Pa]
-        PV_surf_layer = RH_surf_layer * std::exp(23.7093 - 4111.0 / (Taver + 237.7));
-        PV_deep_layer = RH_deep_layer * std::exp(23.7093 - 4111.0 / (Taver + 237.7));
+        PV_surf_layer = RH_surf_layer * PsatTaver;
+        PV_deep_layer = RH_deep_layer * PsatTaver;
 
         // Calculate vapor density at physical material surface (surface-layer/air interface). This is used to calculate total moisture flow terms for
         // each zone in HeatBalanceSurfaceManager
@@ -48,6 +48,9 @@
 #ifndef MoistureBalanceEMPDManager_hh_INCLUDED
 #define MoistureBalanceEMPDManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -82,7 +85,29 @@ namespace MoistureBalanceEMPDManager {
         }
     };
 
+    // Material terms of the EMPD balance for the inside layer of a surface, so they are not looked up and rebuilt every iteration
+    struct EMPDSurfaceCoeffsData
+    {
+        int ConstrNum;               // Construction the terms were taken from
+        int MatNum;                  // Inside layer material
+        Real64 ABCoeff;              // MoistACoeff * MoistBCoeff
+        Real64 BCoeffLessOne;        // MoistBCoeff - 1
+        Real64 CDCoeff;              // MoistCCoeff * MoistDCoeff
+        Real64 DCoeffLessOne;        // MoistDCoeff - 1
+        Real64 DensitySurfaceDepth;  // Density * EMPDSurfaceDepth [kg/m2]
+        Real64 DensityDeepDepth;     // Density * EMPDDeepDepth [kg/m2]
+        Real64 CoatingThicknessMu;   // EMPDCoatingThickness * EMPDmuCoating [m]
+
+        // Default constructor
+        EMPDSurfaceCoeffsData()
+            : ConstrNum(0), MatNum(0), ABCoeff(0.0), BCoeffLessOne(0.0), CDCoeff(0.0), DCoeffLessOne(0.0), DensitySurfaceDepth(0.0),
+              DensityDeepDepth(0.0), CoatingThicknessMu(0.0)
+        {
+        }
+    };
+
     extern Array1D<EMPDReportVarsData> EMPDReportVars; // Array of structs that hold the empd report vars data, one for each surface.
+    extern Array1D<EMPDSurfaceCoeffsData> EMPDSurfaceCoeffs; // Inside layer material terms, one for each surface
     extern bool InitEnvrnFlag;
 
     // SUBROUTINE SPECIFICATION FOR MODULE MoistureBalanceEMPDManager
@@ -102,6 +127,14 @@ namespace MoistureBalanceEMPDManager {
                                  Real64 &TempSat          // Satutare surface temperature.
     );
 
+    void SetEMPDSurfaceCoeffs(int const SurfNum);
+
+    bool IsBatchedEMPDSurface(int const SurfNum);
+
+    void CalcMoistureBalanceEMPDSurfaces(std::vector<int> const &SurfNums, // Surfaces in the current inside heat balance
+                                         Array1D<Real64> const &TempSurfIn  // Inside surface temperatures from the last iteration
+    );
+
     void clear_state();
 
     void UpdateMoistureBalanceEMPD(int const SurfNum); // Surface number
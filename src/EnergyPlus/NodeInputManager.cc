@@ -604,17 +604,11 @@ namespace NodeInputManager {
         int Loop1;      // Loop Variable
         int Loop2;      // Loop Variable
         int NumAlphas;  // Number of alphas in IDF item
-        int NumNumbers; // Number of numerics in IDF item
-        int IOStatus;   // IOStatus for IDF item (not checked)
         int NCount;     // Actual number of node lists
         bool flagError; // true when error node list name should be output
-        Array1D_string cAlphas;
-        Array1D<Real64> rNumbers;
+        std::string nodeListName;
 
         bool localErrorsFound(false);
-        inputProcessor->getObjectDefMaxArgs(CurrentModuleObject, NCount, NumAlphas, NumNumbers);
-        cAlphas.allocate(NumAlphas);
-        rNumbers.allocate(NumNumbers);
         NumOfNodeLists = inputProcessor->getNumObjectsFound(CurrentModuleObject);
         NodeLists.allocate(NumOfNodeLists);
         for (int i = 1; i <= NumOfNodeLists; ++i) {
@@ -623,12 +617,14 @@ namespace NodeInputManager {
         }
 
         NCount = 0;
-        for (Loop = 1; Loop <= NumOfNodeLists; ++Loop) {
-            inputProcessor->getObjectItem(CurrentModuleObject, Loop, cAlphas, NumAlphas, rNumbers, NumNumbers, IOStatus);
-            if (UtilityRoutines::IsNameEmpty(cAlphas(1), CurrentModuleObject, localErrorsFound)) continue;
+        // Node lists hold nothing but names, so read them in place instead of copying each object out with getObjectItem
+        for (auto const &nodeList : inputProcessor->getObjectViews(CurrentModuleObject)) {
+            nodeListName = UtilityRoutines::MakeUPPERCase(nodeList.name());
+            NumAlphas = 1 + nodeList.numExtensibleGroups();
+            if (UtilityRoutines::IsNameEmpty(nodeListName, CurrentModuleObject, localErrorsFound)) continue;
 
             ++NCount;
-            NodeLists(NCount).Name = cAlphas(1);
+            NodeLists(NCount).Name = nodeListName;
             NodeLists(NCount).NodeNames.allocate(NumAlphas - 1);
             NodeLists(NCount).NodeNames = "";
             NodeLists(NCount).NodeNumbers.allocate(NumAlphas - 1);
@@ -636,7 +632,7 @@ namespace NodeInputManager {
             NodeLists(NCount).NumOfNodesInList = NumAlphas - 1;
             if (NumAlphas <= 1) {
                 if (NumAlphas == 1) {
-                    ShowSevereError(RoutineName + CurrentModuleObject + "=\"" + cAlphas(1) + "\" does not have any nodes.");
+                    ShowSevereError(RoutineName + CurrentModuleObject + "=\"" + nodeListName + "\" does not have any nodes.");
                 } else {
                     ShowSevereError(RoutineName + CurrentModuleObject + "=<blank> does not have any nodes or nodelist name.");
                 }
@@ -645,12 +641,12 @@ namespace NodeInputManager {
             }
             //  Put all in, then determine unique
             for (Loop1 = 1; Loop1 <= NumAlphas - 1; ++Loop1) {
-                NodeLists(NCount).NodeNames(Loop1) = cAlphas(Loop1 + 1);
-                if (cAlphas(Loop1 + 1).empty()) {
-                    ShowWarningError(RoutineName + CurrentModuleObject + "=\"" + cAlphas(1) + "\", blank node name in list.");
+                NodeLists(NCount).NodeNames(Loop1) = UtilityRoutines::MakeUPPERCase(nodeList.extensibleGroup(Loop1).alpha("node_name"));
+                if (NodeLists(NCount).NodeNames(Loop1).empty()) {
+                    ShowWarningError(RoutineName + CurrentModuleObject + "=\"" + nodeListName + "\", blank node name in list.");
                     --NodeLists(NCount).NumOfNodesInList;
                     if (NodeLists(NCount).NumOfNodesInList <= 0) {
-                        ShowSevereError(RoutineName + CurrentModuleObject + "=\"" + cAlphas(1) + "\" does not have any nodes.");
+                        ShowSevereError(RoutineName + CurrentModuleObject + "=\"" + nodeListName + "\" does not have any nodes.");
                         localErrorsFound = true;
                         break;
                     }
@@ -658,8 +654,8 @@ namespace NodeInputManager {
                 }
                 NodeLists(NCount).NodeNumbers(Loop1) = AssignNodeNumber(NodeLists(NCount).NodeNames(Loop1), NodeType_Unknown, localErrorsFound);
                 if (UtilityRoutines::SameString(NodeLists(NCount).NodeNames(Loop1), NodeLists(NCount).Name)) {
-                    ShowSevereError(RoutineName + CurrentModuleObject + "=\"" + cAlphas(1) + "\", invalid node name in list.");
-                    ShowContinueError("... Node " + TrimSigDigits(Loop1) + " Name=\"" + cAlphas(Loop1 + 1) + "\", duplicates NodeList Name.");
+                    ShowSevereError(RoutineName + CurrentModuleObject + "=\"" + nodeListName + "\", invalid node name in list.");
+                    ShowContinueError("... Node " + TrimSigDigits(Loop1) + " Name=\"" + NodeLists(NCount).NodeNames(Loop1) + "\", duplicates NodeList Name.");
                     localErrorsFound = true;
                 }
             }
@@ -669,7 +665,7 @@ namespace NodeInputManager {
                 for (Loop2 = Loop1 + 1; Loop2 <= NodeLists(NCount).NumOfNodesInList; ++Loop2) {
                     if (NodeLists(NCount).NodeNumbers(Loop1) != NodeLists(NCount).NodeNumbers(Loop2)) continue;
                     if (flagError) { // only list nodelist name once
-                        ShowSevereError(RoutineName + CurrentModuleObject + "=\"" + cAlphas(1) + "\" has duplicate nodes:");
+                        ShowSevereError(RoutineName + CurrentModuleObject + "=\"" + nodeListName + "\" has duplicate nodes:");
                         flagError = false;
                     }
                     ShowContinueError("...list item=" + TrimSigDigits(Loop1) + ", \"" + NodeID(NodeLists(NCount).NodeNumbers(Loop1)) +
@@ -695,9 +691,6 @@ namespace NodeInputManager {
             }
         }
 
-        cAlphas.deallocate();
-        rNumbers.deallocate();
-
         if (localErrorsFound) {
             ShowFatalError(RoutineName + CurrentModuleObject + ": Error getting input - causes termination.");
             ErrorsFound = true;
@@ -7113,7 +7113,7 @@ void UpdateMeterReporting()
         }
     }
 
-    ReportMeterDetails();
+    TimeOutputSink("mtd meter details", []() { ReportMeterDetails(); });
 
     if (ErrorsLogged) {
         ShowFatalError("UpdateMeterReporting: Previous Meter Specification errors cause program termination.");
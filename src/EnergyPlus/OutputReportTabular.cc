@@ -533,6 +533,7 @@ namespace OutputReportTabular {
     Array1D<MonthlyColumnsType> MonthlyColumns;
     Array1D<TOCEntriesType> TOCEntries;
     Array1D<UnitConvType> UnitConv;
+    Array1D<std::vector<ZoneDelaySequencesType>> ZoneDelaySequences;
 
     static ObjexxFCL::gio::Fmt fmtLD("*");
     static ObjexxFCL::gio::Fmt fmtA("(A)");
@@ -720,6 +721,7 @@ namespace OutputReportTabular {
         MonthlyColumns.deallocate();
         TOCEntries.deallocate();
         UnitConv.deallocate();
+        ZoneDelaySequences.deallocate();
 
         OutputReportTabular::ResetTabularReports();
     }
@@ -12244,20 +12246,19 @@ namespace OutputReportTabular {
         // na
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        static int ZoneNum(0);
-        static int SurfNum(0);
-        static int TimeStep(0);
-        static int TimeOfPulse(0);
-        static int CoolDesSelected(0); // design day selected for cooling
-        static int HeatDesSelected(0); // design day selected for heating
-        int i;
-        Real64 diff;
+        // na
 
-        for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
-            ZoneNum = Surface(SurfNum).Zone;
+        // Each surface only writes its own column of the decay curves, so the surfaces are independent
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+            int const ZoneNum = Surface(SurfNum).Zone;
             if (ZoneNum == 0) continue;
             if (!ZoneEquipConfig(ZoneNum).IsControlled) continue;
-            CoolDesSelected = CalcFinalZoneSizing(ZoneNum).CoolDDNum;
+            int TimeOfPulse;
+            Real64 diff;
+            int const CoolDesSelected = CalcFinalZoneSizing(ZoneNum).CoolDDNum; // design day selected for cooling
             // loop over timesteps after pulse occurred
             if (CoolDesSelected != 0) {
                 TimeOfPulse = radiantPulseTimestep(CoolDesSelected, ZoneNum);
@@ -12265,13 +12266,13 @@ namespace OutputReportTabular {
                 // when the pulse occurred, need to scan back and find when
                 // the pulse occurred.
                 if (TimeOfPulse == 0) {
-                    for (i = CoolDesSelected; i >= 1; --i) {
+                    for (int i = CoolDesSelected; i >= 1; --i) {
                         TimeOfPulse = radiantPulseTimestep(i, ZoneNum);
                         if (TimeOfPulse != 0) break;
                     }
                 }
                 if (TimeOfPulse == 0) TimeOfPulse = 1;
-                for (TimeStep = TimeOfPulse; TimeStep <= NumOfTimeStepInHour * 24; ++TimeStep) {
+                for (int TimeStep = TimeOfPulse; TimeStep <= NumOfTimeStepInHour * 24; ++TimeStep) {
                     if (radiantPulseReceived(CoolDesSelected, SurfNum) != 0.0) {
                         diff = loadConvectedWithPulse(CoolDesSelected, TimeStep, SurfNum) - loadConvectedNormal(CoolDesSelected, TimeStep, SurfNum);
                         decayCurveCool(TimeStep - TimeOfPulse + 1, SurfNum) = -diff / radiantPulseReceived(CoolDesSelected, SurfNum);
@@ -12280,18 +12281,18 @@ namespace OutputReportTabular {
                     }
                 }
             }
-            HeatDesSelected = CalcFinalZoneSizing(ZoneNum).HeatDDNum;
+            int const HeatDesSelected = CalcFinalZoneSizing(ZoneNum).HeatDDNum; // design day selected for heating
             if (HeatDesSelected != 0) {
                 TimeOfPulse = radiantPulseTimestep(HeatDesSelected, ZoneNum);
                 // scan back to the day that the heating pulse occurs, if necessary
                 if (TimeOfPulse == 0) {
-                    for (i = HeatDesSelected; i >= 1; --i) {
+                    for (int i = HeatDesSelected; i >= 1; --i) {
                         TimeOfPulse = radiantPulseTimestep(i, ZoneNum);
                         if (TimeOfPulse != 0) break;
                     }
                 }
                 if (TimeOfPulse == 0) TimeOfPulse = 1;
-                for (TimeStep = TimeOfPulse; TimeStep <= NumOfTimeStepInHour * 24; ++TimeStep) {
+                for (int TimeStep = TimeOfPulse; TimeStep <= NumOfTimeStepInHour * 24; ++TimeStep) {
                     if (radiantPulseReceived(HeatDesSelected, SurfNum) != 0.0) {
                         diff = loadConvectedWithPulse(HeatDesSelected, TimeStep, SurfNum) - loadConvectedNormal(HeatDesSelected, TimeStep, SurfNum);
                         decayCurveHeat(TimeStep - TimeOfPulse + 1, SurfNum) = -diff / radiantPulseReceived(HeatDesSelected, SurfNum);
@@ -12586,6 +12587,9 @@ namespace OutputReportTabular {
         if (!((displayZoneComponentLoadSummary || displayAirLoopComponentLoadSummary || displayFacilityComponentLoadSummary) && CompLoadReportIsReq))
             return;
 
+        // the delayed loads of each zone peak are computed once for all of the reports below
+        ComputeZoneDelaySequences();
+
         int coolDesSelected;
         int timeCoolMax;
         int heatDesSelected;
@@ -13133,6 +13137,158 @@ namespace OutputReportTabular {
         feneSolarDelaySeqCool.deallocate();
         surfDelaySeqHeat.deallocate();
         surfDelaySeqCool.deallocate();
+        ZoneDelaySequences.deallocate();
+    }
+
+    // compute the delayed load sequences of every zone for the design days selected as its cooling and heating peaks
+    void ComputeZoneDelaySequences()
+    {
+        using DataSizing::CalcFinalZoneSizing;
+        using DataZoneEquipment::ZoneEquipConfig;
+
+        ZoneDelaySequences.deallocate();
+        if (!allocated(CalcFinalZoneSizing)) return;
+        ZoneDelaySequences.allocate(NumOfZones);
+
+        // Only the design days selected as peaks are kept. The zones do not share any of the results so they
+        // are processed in parallel when OpenMP is enabled.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int iZone = 1; iZone <= NumOfZones; ++iZone) {
+            if (!ZoneEquipConfig(iZone).IsControlled) continue;
+            auto &zoneDelaySeqs(ZoneDelaySequences(iZone));
+            int const coolDesSelected = CalcFinalZoneSizing(iZone).CoolDDNum;
+            if (coolDesSelected != 0) {
+                zoneDelaySeqs.emplace_back();
+                ComputeDelaySequences(coolDesSelected, true, iZone, zoneDelaySeqs.back());
+            }
+            int const heatDesSelected = CalcFinalZoneSizing(iZone).HeatDDNum;
+            if (heatDesSelected != 0) {
+                zoneDelaySeqs.emplace_back();
+                ComputeDelaySequences(heatDesSelected, false, iZone, zoneDelaySeqs.back());
+            }
+        }
+    }
+
+    // compute the delayed load sequences of one zone for one design day, only reads the gathered sequences so it may run concurrently
+    void ComputeDelaySequences(int const desDaySelected, bool const isCooling, int const zoneIndex, ZoneDelaySequencesType &delaySeqs)
+    {
+        using DataGlobals::NumOfTimeStepInHour;
+        using DataHeatBalance::Zone;
+        using DataSurfaces::Surface;
+        using DataSurfaces::SurfaceClass_Window;
+
+        int const numTimeSteps = NumOfTimeStepInHour * 24;
+        int const surfFirst = Zone(zoneIndex).SurfaceFirst;
+        int const numZoneSurfs = max(Zone(zoneIndex).SurfaceLast - surfFirst + 1, 0);
+        int const radEnclosureNum = Zone(zoneIndex).RadiantEnclosureNum;
+        Array2D<Real64> const &decayCurve(isCooling ? decayCurveCool : decayCurveHeat);
+
+        delaySeqs.desDayNum = desDaySelected;
+        delaySeqs.isCooling = isCooling;
+        delaySeqs.peopleDelaySeq.dimension(numTimeSteps, 0.0);
+        delaySeqs.equipDelaySeq.dimension(numTimeSteps, 0.0);
+        delaySeqs.hvacLossDelaySeq.dimension(numTimeSteps, 0.0);
+        delaySeqs.powerGenDelaySeq.dimension(numTimeSteps, 0.0);
+        delaySeqs.lightDelaySeq.dimension(numTimeSteps, 0.0);
+        delaySeqs.feneSolarDelaySeq.dimension(numTimeSteps, 0.0);
+        delaySeqs.feneSurfNetRadSeq.dimension(numTimeSteps, 0.0);
+        delaySeqs.surfDelaySeq.dimension(numZoneSurfs, numTimeSteps, 0.0);
+
+        // The surface arrays are stored by (design day, timestep, surface), so the decay curve and the short wave and
+        // solar sequences of the zone surfaces are first copied into contiguous rows for the convolution below.
+        Array2D<Real64> surfDecayCurve(numZoneSurfs, numTimeSteps);
+        Array2D<Real64> surfLightSWRadSeq(numZoneSurfs, numTimeSteps);
+        Array2D<Real64> surfFeneSolarRadSeq(numZoneSurfs, numTimeSteps);
+        for (int iSurf = 1; iSurf <= numZoneSurfs; ++iSurf) {
+            int const jSurf = surfFirst + iSurf - 1;
+            for (int kTimeStep = 1; kTimeStep <= numTimeSteps; ++kTimeStep) {
+                surfDecayCurve(iSurf, kTimeStep) = decayCurve(kTimeStep, jSurf);
+                surfLightSWRadSeq(iSurf, kTimeStep) = lightSWRadSeq(desDaySelected, kTimeStep, jSurf);
+                surfFeneSolarRadSeq(iSurf, kTimeStep) = feneSolarRadSeq(desDaySelected, kTimeStep, jSurf);
+            }
+        }
+
+        Array1D<Real64> peopleRadIntoSurf(numTimeSteps, 0.0);
+        Array1D<Real64> equipRadIntoSurf(numTimeSteps, 0.0);
+        Array1D<Real64> hvacLossRadIntoSurf(numTimeSteps, 0.0);
+        Array1D<Real64> powerGenRadIntoSurf(numTimeSteps, 0.0);
+        Array1D<Real64> lightLWRadIntoSurf(numTimeSteps, 0.0);
+
+        for (int kTimeStep = 1; kTimeStep <= numTimeSteps; ++kTimeStep) {
+            Real64 peopleConvIntoZone = 0.0;
+            Real64 equipConvIntoZone = 0.0;
+            Real64 hvacLossConvIntoZone = 0.0;
+            Real64 powerGenConvIntoZone = 0.0;
+            Real64 lightLWConvIntoZone = 0.0;
+            Real64 lightSWConvIntoZone = 0.0;
+            Real64 feneSolarConvIntoZone = 0.0;
+            Real64 adjFeneSurfNetRadSeq = 0.0;
+
+            // code from ComputeDelayedComponents starts
+            for (int iSurf = 1; iSurf <= numZoneSurfs; ++iSurf) {
+                int const jSurf = surfFirst + iSurf - 1;
+                if (!Surface(jSurf).HeatTransSurf) continue; // Skip non-heat transfer surfaces
+
+                // determine for each timestep the amount of radiant heat for each end use absorbed in each surface
+                Real64 QRadThermInAbsMult =
+                    TMULTseq(desDaySelected, kTimeStep, radEnclosureNum) * ITABSFseq(desDaySelected, kTimeStep, jSurf) * Surface(jSurf).Area;
+                peopleRadIntoSurf(kTimeStep) = peopleRadSeq(desDaySelected, kTimeStep, zoneIndex) * QRadThermInAbsMult;
+                equipRadIntoSurf(kTimeStep) = equipRadSeq(desDaySelected, kTimeStep, zoneIndex) * QRadThermInAbsMult;
+                hvacLossRadIntoSurf(kTimeStep) = hvacLossRadSeq(desDaySelected, kTimeStep, zoneIndex) * QRadThermInAbsMult;
+                powerGenRadIntoSurf(kTimeStep) = powerGenRadSeq(desDaySelected, kTimeStep, zoneIndex) * QRadThermInAbsMult;
+                lightLWRadIntoSurf(kTimeStep) = lightLWRadSeq(desDaySelected, kTimeStep, zoneIndex) * QRadThermInAbsMult;
+                // for each time step, step back through time and apply decay curve
+                Real64 peopleConvFromSurf = 0.0;
+                Real64 equipConvFromSurf = 0.0;
+                Real64 hvacLossConvFromSurf = 0.0;
+                Real64 powerGenConvFromSurf = 0.0;
+                Real64 lightLWConvFromSurf = 0.0;
+                Real64 lightSWConvFromSurf = 0.0;
+                Real64 feneSolarConvFromSurf = 0.0;
+                for (int mStepBack = 1; mStepBack <= kTimeStep; ++mStepBack) {
+                    int const kStep = kTimeStep - mStepBack + 1;
+                    Real64 const decay = surfDecayCurve(iSurf, mStepBack);
+                    peopleConvFromSurf += peopleRadIntoSurf(kStep) * decay;
+                    equipConvFromSurf += equipRadIntoSurf(kStep) * decay;
+                    hvacLossConvFromSurf += hvacLossRadIntoSurf(kStep) * decay;
+                    powerGenConvFromSurf += powerGenRadIntoSurf(kStep) * decay;
+                    lightLWConvFromSurf += lightLWRadIntoSurf(kStep) * decay;
+                    // short wave is already accumulated by surface
+                    lightSWConvFromSurf += surfLightSWRadSeq(iSurf, kStep) * decay;
+                    feneSolarConvFromSurf += surfFeneSolarRadSeq(iSurf, kStep) * decay;
+                } // for mStepBack
+                peopleConvIntoZone += peopleConvFromSurf;
+                equipConvIntoZone += equipConvFromSurf;
+                hvacLossConvIntoZone += hvacLossConvFromSurf;
+                powerGenConvIntoZone += powerGenConvFromSurf;
+                lightLWConvIntoZone += lightLWConvFromSurf;
+                lightSWConvIntoZone += lightSWConvFromSurf;
+                feneSolarConvIntoZone += feneSolarConvFromSurf;
+                // code from ComputeDelayedComponents ends
+                // determine the remaining convective heat from the surfaces that are not based
+                // on any of these other loads
+                // negative because heat from surface should be positive
+                delaySeqs.surfDelaySeq(iSurf, kTimeStep) =
+                    -loadConvectedNormal(desDaySelected, kTimeStep, jSurf) - netSurfRadSeq(desDaySelected, kTimeStep, jSurf) -
+                    (peopleConvFromSurf + equipConvFromSurf + hvacLossConvFromSurf + powerGenConvFromSurf + lightLWConvFromSurf +
+                     lightSWConvFromSurf +
+                     feneSolarConvFromSurf); // remove net radiant for the surface
+                                             // also remove the net radiant component on the instanteous conduction for fenestration
+                if (Surface(jSurf).Class == SurfaceClass_Window) {
+                    adjFeneSurfNetRadSeq += netSurfRadSeq(desDaySelected, kTimeStep, jSurf);
+                }
+            } // for iSurf
+            delaySeqs.peopleDelaySeq(kTimeStep) = peopleConvIntoZone;
+            delaySeqs.equipDelaySeq(kTimeStep) = equipConvIntoZone;
+            delaySeqs.hvacLossDelaySeq(kTimeStep) = hvacLossConvIntoZone;
+            delaySeqs.powerGenDelaySeq(kTimeStep) = powerGenConvIntoZone;
+            // combine short wave (visible) and long wave (thermal) impacts
+            delaySeqs.lightDelaySeq(kTimeStep) = lightLWConvIntoZone + lightSWConvIntoZone;
+            delaySeqs.feneSolarDelaySeq(kTimeStep) = feneSolarConvIntoZone;
+            delaySeqs.feneSurfNetRadSeq(kTimeStep) = adjFeneSurfNetRadSeq;
+        } // for kTimeStep
     }
 
     // populate the delay sequence arrays for the component load summary table output
@@ -13153,128 +13309,59 @@ namespace OutputReportTabular {
         using DataGlobals::NumOfTimeStepInHour;
         using DataHeatBalance::Zone;
         using DataSurfaces::Surface;
-        using DataSurfaces::SurfaceClass_Window;
 
         // static bool initAdjFenDone(false); moved to anonymous namespace for unit testing
         static Array3D_bool adjFenDone;
 
-        Array1D<Real64> peopleRadIntoSurf;
-        Array1D<Real64> equipRadIntoSurf;
-        Array1D<Real64> hvacLossRadIntoSurf;
-        Array1D<Real64> powerGenRadIntoSurf;
-        Array1D<Real64> lightLWRadIntoSurf;
-
         if (!initAdjFenDone) {
             adjFenDone.allocate(TotDesDays + TotRunDesPersDays, NumOfTimeStepInHour * 24, NumOfZones);
             adjFenDone = false;
             initAdjFenDone = true;
         }
 
-        peopleRadIntoSurf.allocate(NumOfTimeStepInHour * 24);
-        peopleRadIntoSurf = 0.;
-        equipRadIntoSurf.allocate(NumOfTimeStepInHour * 24);
-        equipRadIntoSurf = 0.;
-        hvacLossRadIntoSurf.allocate(NumOfTimeStepInHour * 24);
-        hvacLossRadIntoSurf = 0.;
-        powerGenRadIntoSurf.allocate(NumOfTimeStepInHour * 24);
-        powerGenRadIntoSurf = 0.;
-        lightLWRadIntoSurf.allocate(NumOfTimeStepInHour * 24);
-        lightLWRadIntoSurf = 0.;
-        int radEnclosureNum = Zone(zoneIndex).RadiantEnclosureNum;
-
         if (desDaySelected != 0) {
 
-            Array2D<Real64> decayCurve;
-            if (isCooling) {
-                decayCurve = decayCurveCool;
+            // use the sequences computed up front for the peaks of the zone, other design days are computed and kept now
+            ZoneDelaySequencesType const *delaySeqs(nullptr);
+            ZoneDelaySequencesType localDelaySeqs;
+            if (allocated(ZoneDelaySequences) && zoneIndex <= int(ZoneDelaySequences.size())) {
+                auto &zoneDelaySeqs(ZoneDelaySequences(zoneIndex));
+                for (auto const &computedSeqs : zoneDelaySeqs) {
+                    if (computedSeqs.desDayNum == desDaySelected && computedSeqs.isCooling == isCooling) {
+                        delaySeqs = &computedSeqs;
+                        break;
+                    }
+                }
+                if (delaySeqs == nullptr) {
+                    zoneDelaySeqs.emplace_back();
+                    ComputeDelaySequences(desDaySelected, isCooling, zoneIndex, zoneDelaySeqs.back());
+                    delaySeqs = &zoneDelaySeqs.back();
+                }
             } else {
-                decayCurve = decayCurveHeat;
+                ComputeDelaySequences(desDaySelected, isCooling, zoneIndex, localDelaySeqs);
+                delaySeqs = &localDelaySeqs;
             }
 
+            int const surfFirst = Zone(zoneIndex).SurfaceFirst;
             for (int kTimeStep = 1; kTimeStep <= NumOfTimeStepInHour * 24; ++kTimeStep) {
-                Real64 peopleConvIntoZone = 0.0;
-                Real64 equipConvIntoZone = 0.0;
-                Real64 hvacLossConvIntoZone = 0.0;
-                Real64 powerGenConvIntoZone = 0.0;
-                Real64 lightLWConvIntoZone = 0.0;
-                Real64 lightSWConvIntoZone = 0.0;
-                Real64 feneSolarConvIntoZone = 0.0;
-                Real64 adjFeneSurfNetRadSeq = 0.0;
-
-                // code from ComputeDelayedComponents starts
-                for (int jSurf = Zone(zoneIndex).SurfaceFirst; jSurf <= Zone(zoneIndex).SurfaceLast; ++jSurf) {
+                for (int jSurf = surfFirst; jSurf <= Zone(zoneIndex).SurfaceLast; ++jSurf) {
                     if (!Surface(jSurf).HeatTransSurf) continue; // Skip non-heat transfer surfaces
-
-                    // determine for each timestep the amount of radiant heat for each end use absorbed in each surface
-                    Real64 QRadThermInAbsMult =
-                        TMULTseq(desDaySelected, kTimeStep, radEnclosureNum) * ITABSFseq(desDaySelected, kTimeStep, jSurf) * Surface(jSurf).Area;
-                    peopleRadIntoSurf(kTimeStep) = peopleRadSeq(desDaySelected, kTimeStep, zoneIndex) * QRadThermInAbsMult;
-                    equipRadIntoSurf(kTimeStep) = equipRadSeq(desDaySelected, kTimeStep, zoneIndex) * QRadThermInAbsMult;
-                    hvacLossRadIntoSurf(kTimeStep) = hvacLossRadSeq(desDaySelected, kTimeStep, zoneIndex) * QRadThermInAbsMult;
-                    powerGenRadIntoSurf(kTimeStep) = powerGenRadSeq(desDaySelected, kTimeStep, zoneIndex) * QRadThermInAbsMult;
-                    lightLWRadIntoSurf(kTimeStep) = lightLWRadSeq(desDaySelected, kTimeStep, zoneIndex) * QRadThermInAbsMult;
-                    // for each time step, step back through time and apply decay curve
-                    Real64 peopleConvFromSurf = 0.0;
-                    Real64 equipConvFromSurf = 0.0;
-                    Real64 hvacLossConvFromSurf = 0.0;
-                    Real64 powerGenConvFromSurf = 0.0;
-                    Real64 lightLWConvFromSurf = 0.0;
-                    Real64 lightSWConvFromSurf = 0.0;
-                    Real64 feneSolarConvFromSurf = 0.0;
-                    for (int mStepBack = 1; mStepBack <= kTimeStep; ++mStepBack) {
-                        peopleConvFromSurf += peopleRadIntoSurf(kTimeStep - mStepBack + 1) * decayCurve(mStepBack, jSurf);
-                        equipConvFromSurf += equipRadIntoSurf(kTimeStep - mStepBack + 1) * decayCurve(mStepBack, jSurf);
-                        hvacLossConvFromSurf += hvacLossRadIntoSurf(kTimeStep - mStepBack + 1) * decayCurve(mStepBack, jSurf);
-                        powerGenConvFromSurf += powerGenRadIntoSurf(kTimeStep - mStepBack + 1) * decayCurve(mStepBack, jSurf);
-                        lightLWConvFromSurf += lightLWRadIntoSurf(kTimeStep - mStepBack + 1) * decayCurve(mStepBack, jSurf);
-                        // short wave is already accumulated by surface
-                        lightSWConvFromSurf += lightSWRadSeq(desDaySelected, kTimeStep - mStepBack + 1, jSurf) * decayCurve(mStepBack, jSurf);
-                        feneSolarConvFromSurf += feneSolarRadSeq(desDaySelected, kTimeStep - mStepBack + 1, jSurf) * decayCurve(mStepBack, jSurf);
-                    } // for mStepBack
-                    peopleConvIntoZone += peopleConvFromSurf;
-                    equipConvIntoZone += equipConvFromSurf;
-                    hvacLossConvIntoZone += hvacLossConvFromSurf;
-                    powerGenConvIntoZone += powerGenConvFromSurf;
-                    lightLWConvIntoZone += lightLWConvFromSurf;
-                    lightSWConvIntoZone += lightSWConvFromSurf;
-                    feneSolarConvIntoZone += feneSolarConvFromSurf;
-                    // code from ComputeDelayedComponents ends
-                    // determine the remaining convective heat from the surfaces that are not based
-                    // on any of these other loads
-                    // negative because heat from surface should be positive
-                    surfDelaySeq(kTimeStep, jSurf) =
-                        -loadConvectedNormal(desDaySelected, kTimeStep, jSurf) - netSurfRadSeq(desDaySelected, kTimeStep, jSurf) -
-                        (peopleConvFromSurf + equipConvFromSurf + hvacLossConvFromSurf + powerGenConvFromSurf + lightLWConvFromSurf +
-                         lightSWConvFromSurf +
-                         feneSolarConvFromSurf); // remove net radiant for the surface
-                                                 // also remove the net radiant component on the instanteous conduction for fenestration
-                    if (Surface(jSurf).Class == SurfaceClass_Window) {
-                        adjFeneSurfNetRadSeq += netSurfRadSeq(desDaySelected, kTimeStep, jSurf);
-                    }
-                } // for jSurf
-                peopleDelaySeq(kTimeStep) = peopleConvIntoZone;
-                equipDelaySeq(kTimeStep) = equipConvIntoZone;
-                hvacLossDelaySeq(kTimeStep) = hvacLossConvIntoZone;
-                powerGenDelaySeq(kTimeStep) = powerGenConvIntoZone;
-                // combine short wave (visible) and long wave (thermal) impacts
-                lightDelaySeq(kTimeStep) = lightLWConvIntoZone + lightSWConvIntoZone;
-                feneSolarDelaySeq(kTimeStep) = feneSolarConvIntoZone;
+                    surfDelaySeq(kTimeStep, jSurf) = delaySeqs->surfDelaySeq(jSurf - surfFirst + 1, kTimeStep);
+                }
+                peopleDelaySeq(kTimeStep) = delaySeqs->peopleDelaySeq(kTimeStep);
+                equipDelaySeq(kTimeStep) = delaySeqs->equipDelaySeq(kTimeStep);
+                hvacLossDelaySeq(kTimeStep) = delaySeqs->hvacLossDelaySeq(kTimeStep);
+                powerGenDelaySeq(kTimeStep) = delaySeqs->powerGenDelaySeq(kTimeStep);
+                lightDelaySeq(kTimeStep) = delaySeqs->lightDelaySeq(kTimeStep);
+                feneSolarDelaySeq(kTimeStep) = delaySeqs->feneSolarDelaySeq(kTimeStep);
                 // also remove the net radiant component on the instanteous conduction for fenestration
                 if (!adjFenDone(desDaySelected, kTimeStep, zoneIndex)) {
-                    feneCondInstantSeq(desDaySelected, kTimeStep, zoneIndex) -= adjFeneSurfNetRadSeq;
+                    feneCondInstantSeq(desDaySelected, kTimeStep, zoneIndex) -= delaySeqs->feneSurfNetRadSeq(kTimeStep);
                     adjFenDone(desDaySelected, kTimeStep, zoneIndex) = true;
                 }
             } // for kTimeStep
 
-            decayCurve.deallocate();
-
         } // if desDaySelected != 0
-
-        peopleRadIntoSurf.deallocate();
-        equipRadIntoSurf.deallocate();
-        hvacLossRadIntoSurf.deallocate();
-        powerGenRadIntoSurf.deallocate();
-        lightLWRadIntoSurf.deallocate();
     }
 
     // Used to construct the tabular output for a single cell in the component load summary reports based on moving average
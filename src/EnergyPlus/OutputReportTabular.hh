@@ -51,6 +51,7 @@
 // C++ Headers
 #include <fstream>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -651,6 +652,26 @@ namespace OutputReportTabular {
         }
     };
 
+    struct ZoneDelaySequencesType // delayed load sequences of one zone for one design day
+    {
+        // members
+        int desDayNum;                     // design day the sequences were computed for
+        bool isCooling;                    // true if computed with the cooling decay curve
+        Array1D<Real64> peopleDelaySeq;    // delayed people load by timestep of the design day
+        Array1D<Real64> equipDelaySeq;     // delayed equipment load
+        Array1D<Real64> hvacLossDelaySeq;  // delayed HVAC loss load
+        Array1D<Real64> powerGenDelaySeq;  // delayed power generation load
+        Array1D<Real64> lightDelaySeq;     // delayed lighting load (long and short wave)
+        Array1D<Real64> feneSolarDelaySeq; // delayed fenestration solar load
+        Array1D<Real64> feneSurfNetRadSeq; // net radiant on the fenestration of the zone, removed from the instant conduction
+        Array2D<Real64> surfDelaySeq;      // delayed load of each zone surface (zone surface, timestep)
+
+        // default constructor
+        ZoneDelaySequencesType() : desDayNum(0), isCooling(false)
+        {
+        }
+    };
+
     // Object Data
     extern Array1D<OutputTableBinnedType> OutputTableBinned;
     extern Array2D<BinResultsType> BinResults;      // table number, number of intervals
@@ -665,6 +686,7 @@ namespace OutputReportTabular {
     extern Array1D<MonthlyColumnsType> MonthlyColumns;
     extern Array1D<TOCEntriesType> TOCEntries;
     extern Array1D<UnitConvType> UnitConv;
+    extern Array1D<std::vector<ZoneDelaySequencesType>> ZoneDelaySequences; // delayed load sequences of each zone for its selected design days
 
     // Functions
     void clear_state();
@@ -811,6 +833,10 @@ namespace OutputReportTabular {
 
     void WriteLoadComponentSummaryTables();
 
+    void ComputeZoneDelaySequences();
+
+    void ComputeDelaySequences(int const desDaySelected, bool const isCooling, int const zoneIndex, ZoneDelaySequencesType &delaySeqs);
+
     void GetDelaySequences(int const &desDaySelected,
                            bool const &isCooling,
                            int const &zoneIndex,
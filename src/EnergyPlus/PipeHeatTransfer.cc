@@ -1949,7 +1949,7 @@ namespace PipeHeatTransfer {
         Real64 curSimTime = DayOfSim * SecsInDay;
         Real64 TBND;
 
-        TBND = this->groundTempModel->getGroundTempAtTimeInSeconds(z, curSimTime);
+        TBND = this->groundTempModel->getGroundTempAtTimeInSecondsTabulated(z, curSimTime);
 
         return TBND;
     }
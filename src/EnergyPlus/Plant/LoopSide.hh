@@ -126,6 +126,15 @@ namespace DataPlant {
         Real64 flowRequestFinal;
         bool hasConstSpeedBranchPumps;
         Array1D<Real64> noLoadConstantSpeedBranchFlowRateSteps;
+        // Flattened copy of the branch/component topology used by the flow resolution passes, see CompileTopology
+        bool TopologyCompiled;
+        Array1D_int BranchNodeNumIn;   // branch inlet node, by branch
+        Array1D_int BranchNodeNumOut;  // branch outlet node, by branch
+        Array1D_int BranchControlType; // branch control type, by branch
+        Array1D_int BranchFirstComp;   // first entry of each branch in the component arrays, TotalBranches + 1 entries
+        Array1D_int CompNodeNumIn;     // component inlet node, in branch order
+        Array1D_int CompNodeNumOut;    // component outlet node, in branch order
+        Array1D_int CompTypeOf;        // component TypeOf_Num, in branch order
 
         // Default Constructor
         HalfLoopData()
@@ -140,9 +149,41 @@ namespace DataPlant {
               errIndex_LoadRemains(0), LoopSideInlet_TankTemp(0.0), LoopSideInlet_MdotCpDeltaT(0.0), LoopSideInlet_McpDTdt(0.0),
               LoopSideInlet_CapExcessStorageTime(0.0), LoopSideInlet_CapExcessStorageTimeReport(0.0), LoopSideInlet_TotalTime(0.0),
               InletNode(0.0, 0.0), OutletNode(0.0, 0.0), flowRequestNeedIfOn(0.0), flowRequestNeedAndTurnOn(0.0), flowRequestFinal(0.0),
-              hasConstSpeedBranchPumps(false)
+              hasConstSpeedBranchPumps(false), TopologyCompiled(false)
         {
         }
+
+        // Copy the node numbers, control types and component types out of the Branch/Comp tree into contiguous arrays.
+        // The components of branch b are entries BranchFirstComp(b) to BranchFirstComp(b + 1) - 1.
+        void CompileTopology()
+        {
+            int NumComps = 0;
+            for (int BranchNum = 1; BranchNum <= TotalBranches; ++BranchNum) {
+                NumComps += Branch(BranchNum).TotalComponents;
+            }
+            BranchNodeNumIn.dimension(TotalBranches, 0);
+            BranchNodeNumOut.dimension(TotalBranches, 0);
+            BranchControlType.dimension(TotalBranches, 0);
+            BranchFirstComp.dimension(TotalBranches + 1, 0);
+            CompNodeNumIn.dimension(NumComps, 0);
+            CompNodeNumOut.dimension(NumComps, 0);
+            CompTypeOf.dimension(NumComps, 0);
+            int CompIndex = 1;
+            for (int BranchNum = 1; BranchNum <= TotalBranches; ++BranchNum) {
+                auto const &branch(Branch(BranchNum));
+                BranchNodeNumIn(BranchNum) = branch.NodeNumIn;
+                BranchNodeNumOut(BranchNum) = branch.NodeNumOut;
+                BranchControlType(BranchNum) = branch.ControlType;
+                BranchFirstComp(BranchNum) = CompIndex;
+                for (int CompNum = 1; CompNum <= branch.TotalComponents; ++CompNum, ++CompIndex) {
+                    CompNodeNumIn(CompIndex) = branch.Comp(CompNum).NodeNumIn;
+                    CompNodeNumOut(CompIndex) = branch.Comp(CompNum).NodeNumOut;
+                    CompTypeOf(CompIndex) = branch.Comp(CompNum).TypeOf_Num;
+                }
+            }
+            BranchFirstComp(TotalBranches + 1) = CompIndex;
+            TopologyCompiled = true;
+        }
     };
 } // namespace DataPlant
 } // namespace EnergyPlus
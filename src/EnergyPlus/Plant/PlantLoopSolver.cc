@@ -1756,6 +1756,10 @@ namespace EnergyPlus {
             int CompOutletNode;
 
             auto &this_loopside(PlantLoop(LoopNum).LoopSide(LoopSideNum));
+            if (!this_loopside.TopologyCompiled) this_loopside.CompileTopology();
+            auto const &BranchNodeNumIn(this_loopside.BranchNodeNumIn);
+            auto const &BranchNodeNumOut(this_loopside.BranchNodeNumOut);
+            auto const &BranchControlType(this_loopside.BranchControlType);
 
             // If there is no splitter then there is no continuity to enforce.
             if (!this_loopside.SplitterExists) {
@@ -1804,15 +1808,12 @@ namespace EnergyPlus {
                 for (iBranch = 1; iBranch <= NumSplitOutlets; ++iBranch) {
 
                     BranchNum = this_loopside.Splitter.BranchNumOut(iBranch);
-                    auto &this_branch(this_loopside.Branch(BranchNum));
-                    SplitterBranchOut = this_loopside.Splitter.BranchNumOut(iBranch);
-                    auto &this_splitter_outlet_branch(this_loopside.Branch(SplitterBranchOut));
-                    LastNodeOnBranch = this_branch.NodeNumOut;
-                    FirstNodeOnBranch = this_branch.NodeNumIn;
+                    LastNodeOnBranch = BranchNodeNumOut(BranchNum);
+                    FirstNodeOnBranch = BranchNodeNumIn(BranchNum);
                     BranchFlowReq = DataPlant::PlantLoop(LoopNum).loopSolver.DetermineBranchFlowRequest(LoopNum,
                                                                                                         LoopSideNum,
                                                                                                         BranchNum);
-                    this_branch.RequestedMassFlow = BranchFlowReq; // store this for later use in logic for remaining flow allocations
+                    this_loopside.Branch(BranchNum).RequestedMassFlow = BranchFlowReq; // store this for later use in logic for remaining flow allocations
                     // now, if we are have branch pumps, here is the situation:
                     // constant speed pumps lock in a flow request on the inlet node
                     // variable speed pumps which have other components on the branch do not log a request themselves
@@ -1824,8 +1825,8 @@ namespace EnergyPlus {
                     BranchMinAvail = Node(LastNodeOnBranch).MassFlowRateMinAvail;
                     BranchMaxAvail = Node(LastNodeOnBranch).MassFlowRateMaxAvail;
                     //            !sum the branch flow requests to a total parallel branch flow request
-                    bool activeBranch = this_splitter_outlet_branch.ControlType == ControlType_Active;
-                    bool isSeriesActiveAndRequesting = (this_splitter_outlet_branch.ControlType == ControlType_SeriesActive) && (BranchFlowReq > 0.0);
+                    bool activeBranch = BranchControlType(BranchNum) == ControlType_Active;
+                    bool isSeriesActiveAndRequesting = (BranchControlType(BranchNum) == ControlType_SeriesActive) && (BranchFlowReq > 0.0);
                     if (activeBranch || isSeriesActiveAndRequesting ) { // revised logic for series active
                         TotParallelBranchFlowReq += BranchFlowReq;
                         ++NumActiveBranches;
@@ -1838,14 +1839,14 @@ namespace EnergyPlus {
                 }
                 //            ! Find branch number and flow rates at splitter inlet
                 SplitterBranchIn = this_loopside.Splitter.BranchNumIn;
-                LastNodeOnBranch = this_loopside.Branch(SplitterBranchIn).NodeNumOut;
-                FirstNodeOnBranchIn = this_loopside.Branch(SplitterBranchIn).NodeNumIn;
+                LastNodeOnBranch = BranchNodeNumOut(SplitterBranchIn);
+                FirstNodeOnBranchIn = BranchNodeNumIn(SplitterBranchIn);
                 InletBranchMinAvail = Node(LastNodeOnBranch).MassFlowRateMinAvail;
                 InletBranchMaxAvail = Node(LastNodeOnBranch).MassFlowRateMaxAvail;
                 //            ! Find branch number and flow rates at mixer outlet
                 MixerBranchOut = this_loopside.Mixer.BranchNumOut;
-                LastNodeOnBranch = this_loopside.Branch(MixerBranchOut).NodeNumOut;
-                FirstNodeOnBranchOut = this_loopside.Branch(MixerBranchOut).NodeNumIn;
+                LastNodeOnBranch = BranchNodeNumOut(MixerBranchOut);
+                FirstNodeOnBranchOut = BranchNodeNumIn(MixerBranchOut);
                 OutletBranchMinAvail = Node(LastNodeOnBranch).MassFlowRateMinAvail;
                 OutletBranchMaxAvail = Node(LastNodeOnBranch).MassFlowRateMaxAvail;
 
@@ -1877,9 +1878,9 @@ namespace EnergyPlus {
                 // MinAvail is not enforced
                 for (OutletNum = 1; OutletNum <= NumSplitOutlets; ++OutletNum) {
                     SplitterBranchOut = this_loopside.Splitter.BranchNumOut(OutletNum);
-                    FirstNodeOnBranch = this_loopside.Branch(SplitterBranchOut).NodeNumIn;
-                    if (this_loopside.Branch(SplitterBranchOut).ControlType != ControlType_Active &&
-                        this_loopside.Branch(SplitterBranchOut).ControlType != ControlType_SeriesActive) {
+                    FirstNodeOnBranch = BranchNodeNumIn(SplitterBranchOut);
+                    if (BranchControlType(SplitterBranchOut) != ControlType_Active &&
+                        BranchControlType(SplitterBranchOut) != ControlType_SeriesActive) {
                         Node(FirstNodeOnBranch).MassFlowRate = 0.0;
                         DataPlant::PlantLoop(LoopNum).loopSolver.PushBranchFlowCharacteristics(
                                 LoopNum, LoopSideNum, SplitterBranchOut, Node(FirstNodeOnBranch).MassFlowRate,
@@ -1891,12 +1892,11 @@ namespace EnergyPlus {
                 if (FlowRemaining < MassFlowTolerance) { // no flow available at all for splitter
                     for (OutletNum = 1; OutletNum <= NumSplitOutlets; ++OutletNum) {
                         SplitterBranchOut = this_loopside.Splitter.BranchNumOut(OutletNum);
-                        for (CompCounter = 1;
-                             CompCounter <= this_loopside.Branch(SplitterBranchOut).TotalComponents; ++CompCounter) {
+                        for (CompCounter = this_loopside.BranchFirstComp(SplitterBranchOut);
+                             CompCounter < this_loopside.BranchFirstComp(SplitterBranchOut + 1); ++CompCounter) {
 
-                            FirstNodeOnBranch = this_loopside.Branch(SplitterBranchOut).NodeNumIn;
-                            CompInletNode = this_loopside.Branch(SplitterBranchOut).Comp(CompCounter).NodeNumIn;
-                            CompOutletNode = this_loopside.Branch(SplitterBranchOut).Comp(CompCounter).NodeNumOut;
+                            CompInletNode = this_loopside.CompNodeNumIn(CompCounter);
+                            CompOutletNode = this_loopside.CompNodeNumOut(CompCounter);
                             Node(CompInletNode).MassFlowRate = 0.0;
                             Node(CompInletNode).MassFlowRateMaxAvail = 0.0;
                             Node(CompOutletNode).MassFlowRate = 0.0;
@@ -1909,9 +1909,9 @@ namespace EnergyPlus {
                     // 1) Satisfy flow demand of ACTIVE splitter outlet branches
                     for (OutletNum = 1; OutletNum <= NumSplitOutlets; ++OutletNum) {
                         SplitterBranchOut = this_loopside.Splitter.BranchNumOut(OutletNum);
-                        FirstNodeOnBranch = this_loopside.Branch(SplitterBranchOut).NodeNumIn;
-                        if (this_loopside.Branch(SplitterBranchOut).ControlType == ControlType_Active ||
-                            this_loopside.Branch(SplitterBranchOut).ControlType == ControlType_SeriesActive) {
+                        FirstNodeOnBranch = BranchNodeNumIn(SplitterBranchOut);
+                        if (BranchControlType(SplitterBranchOut) == ControlType_Active ||
+                            BranchControlType(SplitterBranchOut) == ControlType_SeriesActive) {
                             // branch flow is min of requested flow and remaining flow
                             Node(FirstNodeOnBranch).MassFlowRate = min(Node(FirstNodeOnBranch).MassFlowRate,
                                                                        FlowRemaining);
@@ -1931,8 +1931,8 @@ namespace EnergyPlus {
                     totalMax = 0.0;
                     for (OutletNum = 1; OutletNum <= NumSplitOutlets; ++OutletNum) {
                         SplitterBranchOut = this_loopside.Splitter.BranchNumOut(OutletNum);
-                        FirstNodeOnBranch = this_loopside.Branch(SplitterBranchOut).NodeNumIn;
-                        if (this_loopside.Branch(SplitterBranchOut).ControlType == ControlType_Passive) {
+                        FirstNodeOnBranch = BranchNodeNumIn(SplitterBranchOut);
+                        if (BranchControlType(SplitterBranchOut) == ControlType_Passive) {
                             // Calculate the total max available
                             totalMax += Node(FirstNodeOnBranch).MassFlowRateMaxAvail;
                         }
@@ -1941,8 +1941,8 @@ namespace EnergyPlus {
                     if (totalMax > 0) {
                         for (OutletNum = 1; OutletNum <= NumSplitOutlets; ++OutletNum) {
                             SplitterBranchOut = this_loopside.Splitter.BranchNumOut(OutletNum);
-                            FirstNodeOnBranch = this_loopside.Branch(SplitterBranchOut).NodeNumIn;
-                            if (this_loopside.Branch(SplitterBranchOut).ControlType == ControlType_Passive) {
+                            FirstNodeOnBranch = BranchNodeNumIn(SplitterBranchOut);
+                            if (BranchControlType(SplitterBranchOut) == ControlType_Passive) {
                                 FracFlow = FlowRemaining / totalMax;
                                 if (FracFlow <= 1.0) { // the passive branches will take all the flow
                                     PassiveFlowRate = FracFlow * Node(FirstNodeOnBranch).MassFlowRateMaxAvail;
@@ -1970,8 +1970,8 @@ namespace EnergyPlus {
                     // 3) Distribute remaining flow to the BYPASS
                     for (OutletNum = 1; OutletNum <= this_loopside.Splitter.TotalOutletNodes; ++OutletNum) {
                         SplitterBranchOut = this_loopside.Splitter.BranchNumOut(OutletNum);
-                        FirstNodeOnBranch = this_loopside.Branch(SplitterBranchOut).NodeNumIn;
-                        if (this_loopside.Branch(SplitterBranchOut).ControlType == ControlType_Bypass) {
+                        FirstNodeOnBranch = BranchNodeNumIn(SplitterBranchOut);
+                        if (BranchControlType(SplitterBranchOut) == ControlType_Bypass) {
                             Node(FirstNodeOnBranch).MassFlowRate = min(FlowRemaining,
                                                                        Node(FirstNodeOnBranch).MassFlowRateMaxAvail);
                             DataPlant::PlantLoop(LoopNum).loopSolver.PushBranchFlowCharacteristics(
@@ -1989,9 +1989,9 @@ namespace EnergyPlus {
                         ActiveFlowRate = FlowRemaining / NumActiveBranches;  // denominator now only includes active branches that wanted to be "on"
                         for (OutletNum = 1; OutletNum <= NumSplitOutlets; ++OutletNum) {
                             SplitterBranchOut = this_loopside.Splitter.BranchNumOut(OutletNum);
-                            FirstNodeOnBranch = this_loopside.Branch(SplitterBranchOut).NodeNumIn;
-                            bool branchIsActive = this_loopside.Branch(SplitterBranchOut).ControlType == ControlType_Active;
-                            bool branchIsSeriesActiveAndRequesting = this_loopside.Branch(SplitterBranchOut).ControlType == ControlType_SeriesActive && this_loopside.Branch(SplitterBranchOut).RequestedMassFlow > 0.0;
+                            FirstNodeOnBranch = BranchNodeNumIn(SplitterBranchOut);
+                            bool branchIsActive = BranchControlType(SplitterBranchOut) == ControlType_Active;
+                            bool branchIsSeriesActiveAndRequesting = BranchControlType(SplitterBranchOut) == ControlType_SeriesActive && this_loopside.Branch(SplitterBranchOut).RequestedMassFlow > 0.0;
                             if (branchIsActive || branchIsSeriesActiveAndRequesting) { // only series active branches that want to be "on"
                                 // check Remaining flow (should be correct!)
                                 ActiveFlowRate = min(ActiveFlowRate, FlowRemaining);
@@ -2014,9 +2014,9 @@ namespace EnergyPlus {
                         // 5)  Step 4) could have left ACTIVE branches < MaxAvail.  Check to makes sure all ACTIVE branches are at MaxAvail
                         for (OutletNum = 1; OutletNum <= NumSplitOutlets; ++OutletNum) {
                             SplitterBranchOut = this_loopside.Splitter.BranchNumOut(OutletNum);
-                            FirstNodeOnBranch = this_loopside.Branch(SplitterBranchOut).NodeNumIn;
-                            if (this_loopside.Branch(SplitterBranchOut).ControlType == ControlType_Active ||
-                                this_loopside.Branch(SplitterBranchOut).ControlType == ControlType_SeriesActive) {
+                            FirstNodeOnBranch = BranchNodeNumIn(SplitterBranchOut);
+                            if (BranchControlType(SplitterBranchOut) == ControlType_Active ||
+                                BranchControlType(SplitterBranchOut) == ControlType_SeriesActive) {
                                 StartingFlowRate = Node(FirstNodeOnBranch).MassFlowRate;
                                 ActiveFlowRate = min(FlowRemaining,
                                                      (Node(FirstNodeOnBranch).MassFlowRateMaxAvail - StartingFlowRate));
@@ -2036,19 +2036,19 @@ namespace EnergyPlus {
                     TotParallelBranchFlowReq = 0.0;
                     for (iBranch = 1; iBranch <= NumSplitOutlets; ++iBranch) {
                         BranchNum = this_loopside.Splitter.BranchNumOut(iBranch);
-                        FirstNodeOnBranch = this_loopside.Branch(BranchNum).NodeNumIn;
+                        FirstNodeOnBranch = BranchNodeNumIn(BranchNum);
                         // calculate parallel branch flow rate
                         TotParallelBranchFlowReq += Node(FirstNodeOnBranch).MassFlowRate;
                     }
                     // Reset the flow on the splitter inlet branch
                     SplitterBranchIn = this_loopside.Splitter.BranchNumIn;
-                    FirstNodeOnBranchIn = this_loopside.Branch(SplitterBranchIn).NodeNumIn;
+                    FirstNodeOnBranchIn = BranchNodeNumIn(SplitterBranchIn);
                     Node(FirstNodeOnBranchIn).MassFlowRate = TotParallelBranchFlowReq;
                     PushBranchFlowCharacteristics(LoopNum, LoopSideNum, SplitterBranchIn,
                                                   Node(FirstNodeOnBranchIn).MassFlowRate, FirstHVACIteration);
                     // Reset the flow on the Mixer outlet branch
                     MixerBranchOut = this_loopside.Mixer.BranchNumOut;
-                    FirstNodeOnBranchOut = this_loopside.Branch(MixerBranchOut).NodeNumIn;
+                    FirstNodeOnBranchOut = BranchNodeNumIn(MixerBranchOut);
                     Node(FirstNodeOnBranchOut).MassFlowRate = TotParallelBranchFlowReq;
                     PushBranchFlowCharacteristics(LoopNum, LoopSideNum, MixerBranchOut,
                                                   Node(FirstNodeOnBranchOut).MassFlowRate, FirstHVACIteration);
@@ -2063,26 +2063,23 @@ namespace EnergyPlus {
 
                         SplitterBranchOut = this_loopside.Splitter.BranchNumOut(OutletNum);
                         ThisBranchRequest = DetermineBranchFlowRequest(LoopNum, LoopSideNum, SplitterBranchOut);
-                        FirstNodeOnBranch = this_loopside.Branch(SplitterBranchOut).NodeNumIn;
-                        auto &this_splitter_outlet_branch(this_loopside.Branch(SplitterBranchOut));
+                        FirstNodeOnBranch = BranchNodeNumIn(SplitterBranchOut);
 
-                        if ((this_splitter_outlet_branch.ControlType == ControlType_Active) ||
-                            (this_splitter_outlet_branch.ControlType == ControlType_SeriesActive)) {
+                        if ((BranchControlType(SplitterBranchOut) == ControlType_Active) ||
+                            (BranchControlType(SplitterBranchOut) == ControlType_SeriesActive)) {
 
                             // since we are calculating this fraction based on the total parallel request calculated above, we must mimic the logic to
                             // make sure the math works every time that means we must make the variable speed pump correction here as well.
-                            for (CompCounter = 1;
-                                 CompCounter <= this_splitter_outlet_branch.TotalComponents; ++CompCounter) {
-
-                                auto &this_comp(this_splitter_outlet_branch.Comp(CompCounter));
+                            for (CompCounter = this_loopside.BranchFirstComp(SplitterBranchOut);
+                                 CompCounter < this_loopside.BranchFirstComp(SplitterBranchOut + 1); ++CompCounter) {
 
                                 // if this isn't a variable speed pump then just keep cycling
-                                if ((this_comp.TypeOf_Num != TypeOf_PumpVariableSpeed) &&
-                                    (this_comp.TypeOf_Num != TypeOf_PumpBankVariableSpeed)) {
+                                if ((this_loopside.CompTypeOf(CompCounter) != TypeOf_PumpVariableSpeed) &&
+                                    (this_loopside.CompTypeOf(CompCounter) != TypeOf_PumpBankVariableSpeed)) {
                                     continue;
                                 }
 
-                                CompInletNode = this_comp.NodeNumIn;
+                                CompInletNode = this_loopside.CompNodeNumIn(CompCounter);
                                 ThisBranchRequest = max(ThisBranchRequest, Node(CompInletNode).MassFlowRateRequest);
                             }
 
@@ -2110,7 +2107,7 @@ namespace EnergyPlus {
 
                     // 2)  ! Reset the flow on the Mixer outlet branch
                     MixerBranchOut = this_loopside.Mixer.BranchNumOut;
-                    FirstNodeOnBranchOut = this_loopside.Branch(MixerBranchOut).NodeNumIn;
+                    FirstNodeOnBranchOut = BranchNodeNumIn(MixerBranchOut);
                     Node(FirstNodeOnBranchOut).MassFlowRate = TotParallelBranchFlowReq;
                     DataPlant::PlantLoop(LoopNum).loopSolver.PushBranchFlowCharacteristics(
                             LoopNum, LoopSideNum, MixerBranchOut, Node(FirstNodeOnBranchOut).MassFlowRate,
@@ -2146,16 +2143,18 @@ namespace EnergyPlus {
             //     This assumes that load range based should not request flow for load-rejection purposes, and we
             //     should only "respond" to other component types.
 
-            auto &this_branch(DataPlant::PlantLoop(LoopNum).LoopSide(LoopSideNum).Branch(BranchNum));
-            int const BranchInletNodeNum = this_branch.NodeNumIn;
-            int const BranchOutletNodeNum = this_branch.NodeNumOut;
+            auto &this_loopside(DataPlant::PlantLoop(LoopNum).LoopSide(LoopSideNum));
+            if (!this_loopside.TopologyCompiled) this_loopside.CompileTopology();
+            int const BranchInletNodeNum = this_loopside.BranchNodeNumIn(BranchNum);
+            int const BranchOutletNodeNum = this_loopside.BranchNodeNumOut(BranchNum);
             Real64 OverallFlowRequest = 0.0;
 
-            if (this_branch.ControlType != DataBranchAirLoopPlant::ControlType_SeriesActive) {
+            if (this_loopside.BranchControlType(BranchNum) != DataBranchAirLoopPlant::ControlType_SeriesActive) {
                 OverallFlowRequest = DataLoopNode::Node(BranchInletNodeNum).MassFlowRateRequest;
             } else { // is series active, so take largest request of all the component inlet nodes
-                for (int CompCounter = 1; CompCounter <= this_branch.TotalComponents; ++CompCounter) {
-                    int const CompInletNode = this_branch.Comp(CompCounter).NodeNumIn;
+                for (int CompCounter = this_loopside.BranchFirstComp(BranchNum); CompCounter < this_loopside.BranchFirstComp(BranchNum + 1);
+                     ++CompCounter) {
+                    int const CompInletNode = this_loopside.CompNodeNumIn(CompCounter);
                     OverallFlowRequest = max(OverallFlowRequest, DataLoopNode::Node(CompInletNode).MassFlowRateRequest);
                 }
             }
@@ -2270,10 +2269,10 @@ namespace EnergyPlus {
             bool PlantIsRigid;
 
             auto &this_loopside(PlantLoop(LoopNum).LoopSide(LoopSideNum));
-            auto &this_branch(this_loopside.Branch(BranchNum));
+            if (!this_loopside.TopologyCompiled) this_loopside.CompileTopology();
 
-            BranchInletNode = this_branch.NodeNumIn;
-            BranchOutletNode = this_branch.NodeNumOut;
+            BranchInletNode = this_loopside.BranchNodeNumIn(BranchNum);
+            BranchOutletNode = this_loopside.BranchNodeNumOut(BranchNum);
 
             //~ Possible error handling if needed
             if (ValueToPush != Node(BranchInletNode).MassFlowRate) {
@@ -2288,15 +2287,13 @@ namespace EnergyPlus {
             PlantIsRigid = CheckPlantConvergence(LoopNum, LoopSideNum, FirstHVACIteration);
 
             //~ Loop across all component outlet nodes and update their mass flow and max avail
-            for (CompCounter = 1; CompCounter <= this_branch.TotalComponents; ++CompCounter) {
-
-                auto &this_comp(this_branch.Comp(CompCounter));
+            for (CompCounter = this_loopside.BranchFirstComp(BranchNum); CompCounter < this_loopside.BranchFirstComp(BranchNum + 1); ++CompCounter) {
 
                 //~ Pick up some values for convenience
-                ComponentInletNode = this_comp.NodeNumIn;
-                ComponentOutletNode = this_comp.NodeNumOut;
+                ComponentInletNode = this_loopside.CompNodeNumIn(CompCounter);
+                ComponentOutletNode = this_loopside.CompNodeNumOut(CompCounter);
                 MassFlowRateFound = Node(ComponentOutletNode).MassFlowRate;
-                ComponentTypeOfNum = this_comp.TypeOf_Num;
+                ComponentTypeOfNum = this_loopside.CompTypeOf(CompCounter);
 
                 //~ Push the values through
                 Node(ComponentOutletNode).MassFlowRate = MassFlow;
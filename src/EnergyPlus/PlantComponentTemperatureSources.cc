@@ -110,79 +110,55 @@ namespace PlantComponentTemperatureSources {
     // Object Data
     Array1D<WaterSourceSpecs> WaterSource; // dimension to number of machines
 
-    void SimWaterSource(std::string const &SourceName,            // user-specified name for this component
-                        int const EP_UNUSED(EquipFlowCtrl),       // Flow control mode for the equipment
-                        int &CompIndex,                           // HX number pointer
-                        bool const EP_UNUSED(RunFlag),            // simulate HX when TRUE
-                        bool const EP_UNUSED(FirstHVACIteration), // initialize variables when TRUE
-                        bool &InitLoopEquip,                      // If not zero, calculate the max load for operating conditions
-                        Real64 &MyLoad,                           // loop demand component will meet
-                        Real64 &MaxLoad,
-                        Real64 &MinLoad,
-                        Real64 &OptLoad,
-                        bool const GetSizingFactor, // TRUE when just the sizing factor is requested
-                        Real64 &SizingFactor        // sizing factor
-    )
+    PlantComponent *WaterSourceSpecs::factory(std::string const &objectName)
     {
-        // SUBROUTINE INFORMATION:
-        //       AUTHOR         Edwin Lee
-        //       DATE WRITTEN   October 2012
-        //       MODIFIED       na
-        //       RE-ENGINEERED  na
-
-        // PURPOSE OF THIS SUBROUTINE: This is the water source model driver.  It
-        //  gets the input for the models, initializes simulation variables, call
-        //  the appropriate model and sets up reporting variables.
-
-        // Using/Aliasing
-        using DataGlobals::BigNumber;
-
-        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-        int SourceNum; // HX number pointer
-
-        // GET INPUT
         if (GetInput) {
             GetWaterSource();
             GetInput = false;
         }
-
-        // Find the correct instance
-        if (CompIndex == 0) {
-            SourceNum = UtilityRoutines::FindItemInList(SourceName, WaterSource);
-            if (SourceNum == 0) {
-                ShowFatalError("SimWaterSource: Specified heat exchanger not one of Valid heat exchangers=" + SourceName); // LCOV_EXCL_LINE
-            }
-            CompIndex = SourceNum;
-        } else {
-            SourceNum = CompIndex;
-            if (SourceNum > NumSources || SourceNum < 1) {
-                ShowFatalError("SimWaterSource:  Invalid CompIndex passed=" + TrimSigDigits(SourceNum) +
-                               ", Number of Units=" + TrimSigDigits(NumSources) + ", Entered Unit name=" + SourceName); // LCOV_EXCL_LINE
-            }
-            if (WaterSource(SourceNum).CheckEquipName) {
-                if (SourceName != WaterSource(SourceNum).Name) {
-                    ShowFatalError("SimWaterSource: Invalid CompIndex passed=" + TrimSigDigits(SourceNum) + ", Unit name=" + SourceName +
-                                   ", stored Unit Name for that index=" + WaterSource(SourceNum).Name); // LCOV_EXCL_LINE
-                }
-                WaterSource(SourceNum).CheckEquipName = false;
+        // Now look for this particular temperature source in the list
+        for (auto &waterSource : WaterSource) {
+            if (waterSource.Name == objectName) {
+                return &waterSource;
             }
         }
+        // If we didn't find it, fatal
+        ShowFatalError("LocalTemperatureSourceFactory: Error getting inputs for temperature source named: " + objectName); // LCOV_EXCL_LINE
+        // Shut up the compiler
+        return nullptr; // LCOV_EXCL_LINE
+    }
 
-        if (InitLoopEquip) {
-            InitWaterSource(SourceNum, MyLoad);
-            SizeWaterSource(SourceNum);
-            if (GetSizingFactor) {
-                SizingFactor = WaterSource(SourceNum).SizFac;
-            }
-            MaxLoad = BigNumber;
-            MinLoad = 0.0;
-            OptLoad = BigNumber;
-            return;
-        }
+    void WaterSourceSpecs::simulate(const PlantLocation &EP_UNUSED(calledFromLocation),
+                                    bool const EP_UNUSED(FirstHVACIteration),
+                                    Real64 &CurLoad,
+                                    bool const EP_UNUSED(RunFlag))
+    {
+        this->initialize(CurLoad);
+        this->calculate();
+        this->update();
+    }
 
-        InitWaterSource(SourceNum, MyLoad);
-        CalcWaterSource(SourceNum);
-        UpdateWaterSource(SourceNum);
+    void WaterSourceSpecs::getDesignCapacities(const PlantLocation &EP_UNUSED(calledFromLocation), Real64 &MaxLoad, Real64 &MinLoad, Real64 &OptLoad)
+    {
+        MaxLoad = DataGlobals::BigNumber;
+        MinLoad = 0.0;
+        OptLoad = DataGlobals::BigNumber;
+    }
+
+    void WaterSourceSpecs::getSizingFactor(Real64 &_SizFac)
+    {
+        _SizFac = this->SizFac;
+    }
+
+    void WaterSourceSpecs::onInitLoopEquip(const PlantLocation &calledFromLocation)
+    {
+        Real64 myLoad = DataPlant::PlantLoop(calledFromLocation.loopNum)
+                            .LoopSide(calledFromLocation.loopSideNum)
+                            .Branch(calledFromLocation.branchNum)
+                            .Comp(calledFromLocation.compNum)
+                            .MyLoad;
+        this->initialize(myLoad);
+        this->size();
     }
 
     void GetWaterSource()
@@ -336,8 +312,7 @@ namespace PlantComponentTemperatureSources {
         }
     }
 
-    void InitWaterSource(int const SourceNum, // number of the current component being simulated
-                         Real64 const MyLoad)
+    void WaterSourceSpecs::initialize(Real64 const MyLoad)
     {
 
         // SUBROUTINE INFORMATION:
@@ -372,65 +347,65 @@ namespace PlantComponentTemperatureSources {
         bool errFlag;
 
         // Init more variables
-        if (WaterSource(SourceNum).MyFlag) {
+        if (this->MyFlag) {
             // Locate the component on the plant loops for later usage
             errFlag = false;
-            ScanPlantLoopsForObject(WaterSource(SourceNum).Name,
+            ScanPlantLoopsForObject(this->Name,
                                     TypeOf_WaterSource,
-                                    WaterSource(SourceNum).Location.loopNum,
-                                    WaterSource(SourceNum).Location.loopSideNum,
-                                    WaterSource(SourceNum).Location.branchNum,
-                                    WaterSource(SourceNum).Location.compNum,
+                                    this->Location.loopNum,
+                                    this->Location.loopSideNum,
+                                    this->Location.branchNum,
+                                    this->Location.compNum,
                                     errFlag,
                                     _,
                                     _,
                                     _,
-                                    WaterSource(SourceNum).InletNodeNum,
+                                    this->InletNodeNum,
                                     _);
             if (errFlag) {
                 ShowFatalError(RoutineName + ": Program terminated due to previous condition(s).");
             }
-            WaterSource(SourceNum).MyFlag = false;
+            this->MyFlag = false;
         }
 
         // Initialize critical Demand Side Variables at the beginning of each environment
-        if (WaterSource(SourceNum).MyEnvironFlag && BeginEnvrnFlag && (PlantFirstSizesOkayToFinalize)) {
+        if (this->MyEnvironFlag && BeginEnvrnFlag && (PlantFirstSizesOkayToFinalize)) {
 
-            rho = GetDensityGlycol(PlantLoop(WaterSource(SourceNum).Location.loopNum).FluidName,
+            rho = GetDensityGlycol(PlantLoop(this->Location.loopNum).FluidName,
                                    DataGlobals::InitConvTemp,
-                                   PlantLoop(WaterSource(SourceNum).Location.loopNum).FluidIndex,
+                                   PlantLoop(this->Location.loopNum).FluidIndex,
                                    RoutineName);
-            WaterSource(SourceNum).MassFlowRateMax = WaterSource(SourceNum).DesVolFlowRate * rho;
+            this->MassFlowRateMax = this->DesVolFlowRate * rho;
             InitComponentNodes(0.0,
-                               WaterSource(SourceNum).MassFlowRateMax,
-                               WaterSource(SourceNum).InletNodeNum,
-                               WaterSource(SourceNum).OutletNodeNum,
-                               WaterSource(SourceNum).Location.loopNum,
-                               WaterSource(SourceNum).Location.loopSideNum,
-                               WaterSource(SourceNum).Location.branchNum,
-                               WaterSource(SourceNum).Location.compNum);
-
-            WaterSource(SourceNum).MyEnvironFlag = false;
+                               this->MassFlowRateMax,
+                               this->InletNodeNum,
+                               this->OutletNodeNum,
+                               this->Location.loopNum,
+                               this->Location.loopSideNum,
+                               this->Location.branchNum,
+                               this->Location.compNum);
+
+            this->MyEnvironFlag = false;
         }
 
         if (!BeginEnvrnFlag) {
-            WaterSource(SourceNum).MyEnvironFlag = true;
+            this->MyEnvironFlag = true;
         }
 
         // OK, so we can set up the inlet and boundary temperatures now
-        WaterSource(SourceNum).InletTemp = Node(WaterSource(SourceNum).InletNodeNum).Temp;
-        if (WaterSource(SourceNum).TempSpecType == TempSpecType_Schedule) {
-            WaterSource(SourceNum).BoundaryTemp = GetCurrentScheduleValue(WaterSource(SourceNum).TempSpecScheduleNum);
+        this->InletTemp = Node(this->InletNodeNum).Temp;
+        if (this->TempSpecType == TempSpecType_Schedule) {
+            this->BoundaryTemp = GetCurrentScheduleValue(this->TempSpecScheduleNum);
         }
 
         // Calculate specific heat
-        cp = GetSpecificHeatGlycol(PlantLoop(WaterSource(SourceNum).Location.loopNum).FluidName,
-                                   WaterSource(SourceNum).BoundaryTemp,
-                                   PlantLoop(WaterSource(SourceNum).Location.loopNum).FluidIndex,
+        cp = GetSpecificHeatGlycol(PlantLoop(this->Location.loopNum).FluidName,
+                                   this->BoundaryTemp,
+                                   PlantLoop(this->Location.loopNum).FluidIndex,
                                    RoutineName);
 
         // Calculate deltaT
-        Real64 delta_temp = WaterSource(SourceNum).BoundaryTemp - WaterSource(SourceNum).InletTemp;
+        Real64 delta_temp = this->BoundaryTemp - this->InletTemp;
 
         // If deltaT is zero then we cannot calculate a flow request, but we may still want one
         //   If myload is greater than zero, then lets request full flow at the current temperature as it may still be meeting load
@@ -445,41 +420,41 @@ namespace PlantComponentTemperatureSources {
         //  If there is a deltaT, but no load, the mass flow request will go to zero anyway
         if (std::abs(delta_temp) < 0.001) {
             if (std::abs(MyLoad) < 0.001) {
-                WaterSource(SourceNum).MassFlowRate = 0.0;
+                this->MassFlowRate = 0.0;
             } else {
-                WaterSource(SourceNum).MassFlowRate = WaterSource(SourceNum).MassFlowRateMax;
+                this->MassFlowRate = this->MassFlowRateMax;
             }
         } else {
-            WaterSource(SourceNum).MassFlowRate = MyLoad / (cp * delta_temp);
+            this->MassFlowRate = MyLoad / (cp * delta_temp);
         }
 
         // If the mdot is negative it means we can't help the load so we will want to just go to zero.
         // If the mdot is already zero, then well, we still want to go to zero
         // If the mdot is positive, just make sure we constrain it to the design value
-        if (WaterSource(SourceNum).MassFlowRate < 0) {
-            WaterSource(SourceNum).MassFlowRate = 0.0;
+        if (this->MassFlowRate < 0) {
+            this->MassFlowRate = 0.0;
         } else {
-            if (!WaterSource(SourceNum).EMSOverrideOnMassFlowRateMax) {
-                WaterSource(SourceNum).MassFlowRate = min(WaterSource(SourceNum).MassFlowRate, WaterSource(SourceNum).MassFlowRateMax);
+            if (!this->EMSOverrideOnMassFlowRateMax) {
+                this->MassFlowRate = min(this->MassFlowRate, this->MassFlowRateMax);
             } else {
-                WaterSource(SourceNum).MassFlowRate =
-                    min(WaterSource(SourceNum).MassFlowRate, WaterSource(SourceNum).EMSOverrideValueMassFlowRateMax);
+                this->MassFlowRate =
+                    min(this->MassFlowRate, this->EMSOverrideValueMassFlowRateMax);
             }
         }
 
-        SetComponentFlowRate(WaterSource(SourceNum).MassFlowRate,
-                             WaterSource(SourceNum).InletNodeNum,
-                             WaterSource(SourceNum).OutletNodeNum,
-                             WaterSource(SourceNum).Location.loopNum,
-                             WaterSource(SourceNum).Location.loopSideNum,
-                             WaterSource(SourceNum).Location.branchNum,
-                             WaterSource(SourceNum).Location.compNum);
+        SetComponentFlowRate(this->MassFlowRate,
+                             this->InletNodeNum,
+                             this->OutletNodeNum,
+                             this->Location.loopNum,
+                             this->Location.loopSideNum,
+                             this->Location.branchNum,
+                             this->Location.compNum);
 
         // at this point the mass flow rate, inlet temp, and boundary temp structure vars have been updated
         // the calc routine will update the outlet temp and heat transfer rate/energies
     }
 
-    void SizeWaterSource(int const SourceNum)
+    void WaterSourceSpecs::size()
     {
 
         // SUBROUTINE INFORMATION:
@@ -512,38 +487,38 @@ namespace PlantComponentTemperatureSources {
         Real64 tmpVolFlowRate;          // local design volume flow rate
         Real64 DesVolFlowRateUser(0.0); // Hardsized design volume flow rate for reporting
 
-        tmpVolFlowRate = WaterSource(SourceNum).DesVolFlowRate;
+        tmpVolFlowRate = this->DesVolFlowRate;
 
-        PltSizNum = PlantLoop(WaterSource(SourceNum).Location.loopNum).PlantSizNum;
+        PltSizNum = PlantLoop(this->Location.loopNum).PlantSizNum;
 
         if (PltSizNum > 0) {
             if (PlantSizData(PltSizNum).DesVolFlowRate >= SmallWaterVolFlow) {
                 tmpVolFlowRate = PlantSizData(PltSizNum).DesVolFlowRate; //* WaterSource(SourceNum)%SizFac
-                if (!WaterSource(SourceNum).DesVolFlowRateWasAutoSized) tmpVolFlowRate = WaterSource(SourceNum).DesVolFlowRate;
+                if (!this->DesVolFlowRateWasAutoSized) tmpVolFlowRate = this->DesVolFlowRate;
             } else {
-                if (WaterSource(SourceNum).DesVolFlowRateWasAutoSized) tmpVolFlowRate = 0.0;
+                if (this->DesVolFlowRateWasAutoSized) tmpVolFlowRate = 0.0;
             }
             if (PlantFirstSizesOkayToFinalize) {
-                if (WaterSource(SourceNum).DesVolFlowRateWasAutoSized) {
-                    WaterSource(SourceNum).DesVolFlowRate = tmpVolFlowRate;
+                if (this->DesVolFlowRateWasAutoSized) {
+                    this->DesVolFlowRate = tmpVolFlowRate;
                     if (PlantFinalSizesOkayToReport) {
                         ReportSizingOutput("PlantComponent:TemperatureSource",
-                                           WaterSource(SourceNum).Name,
+                                           this->Name,
                                            "Design Size Design Fluid Flow Rate [m3/s]",
                                            tmpVolFlowRate);
                     }
                     if (PlantFirstSizesOkayToReport) {
                         ReportSizingOutput("PlantComponent:TemperatureSource",
-                                           WaterSource(SourceNum).Name,
+                                           this->Name,
                                            "Initial Design Size Design Fluid Flow Rate [m3/s]",
                                            tmpVolFlowRate);
                     }
                 } else {
-                    if (WaterSource(SourceNum).DesVolFlowRate > 0.0 && tmpVolFlowRate > 0.0) {
-                        DesVolFlowRateUser = WaterSource(SourceNum).DesVolFlowRate;
+                    if (this->DesVolFlowRate > 0.0 && tmpVolFlowRate > 0.0) {
+                        DesVolFlowRateUser = this->DesVolFlowRate;
                         if (PlantFinalSizesOkayToReport) {
                             ReportSizingOutput("PlantComponent:TemperatureSource",
-                                               WaterSource(SourceNum).Name,
+                                               this->Name,
                                                "Design Size Design Fluid Flow Rate [m3/s]",
                                                tmpVolFlowRate,
                                                "User-Specified Design Fluid Flow Rate [m3/s]",
@@ -551,7 +526,7 @@ namespace PlantComponentTemperatureSources {
                             if (DisplayExtraWarnings) {
                                 if ((std::abs(tmpVolFlowRate - DesVolFlowRateUser) / DesVolFlowRateUser) > AutoVsHardSizingThreshold) {
                                     ShowMessage("SizePlantComponentTemperatureSource: Potential issue with equipment sizing for " +
-                                                WaterSource(SourceNum).Name);
+                                                this->Name);
                                     ShowContinueError("User-Specified Design Fluid Flow Rate of " + RoundSigDigits(DesVolFlowRateUser, 5) +
                                                       " [m3/s]");
                                     ShowContinueError("differs from Design Size Design Fluid Flow Rate of " + RoundSigDigits(tmpVolFlowRate, 5) +
@@ -566,29 +541,29 @@ namespace PlantComponentTemperatureSources {
                 }
             }
         } else {
-            if (WaterSource(SourceNum).DesVolFlowRateWasAutoSized && PlantFirstSizesOkayToFinalize) {
+            if (this->DesVolFlowRateWasAutoSized && PlantFirstSizesOkayToFinalize) {
                 ShowSevereError("Autosizing of plant component temperature source flow rate requires a loop Sizing:Plant object");
-                ShowContinueError("Occurs in PlantComponent:TemperatureSource object=" + WaterSource(SourceNum).Name);
+                ShowContinueError("Occurs in PlantComponent:TemperatureSource object=" + this->Name);
                 ErrorsFound = true;
             }
-            if (!WaterSource(SourceNum).DesVolFlowRateWasAutoSized && PlantFinalSizesOkayToReport) {
-                if (WaterSource(SourceNum).DesVolFlowRate > 0.0) {
+            if (!this->DesVolFlowRateWasAutoSized && PlantFinalSizesOkayToReport) {
+                if (this->DesVolFlowRate > 0.0) {
                     ReportSizingOutput("PlantComponent:TemperatureSource",
-                                       WaterSource(SourceNum).Name,
+                                       this->Name,
                                        "User-Specified Design Fluid Flow Rate [m3/s]",
-                                       WaterSource(SourceNum).DesVolFlowRate);
+                                       this->DesVolFlowRate);
                 }
             }
         }
 
-        RegisterPlantCompDesignFlow(WaterSource(SourceNum).InletNodeNum, tmpVolFlowRate);
+        RegisterPlantCompDesignFlow(this->InletNodeNum, tmpVolFlowRate);
 
         if (ErrorsFound) {
             ShowFatalError("Preceding sizing errors cause program termination");
         }
     }
 
-    void CalcWaterSource(int const SourceNum)
+    void WaterSourceSpecs::calculate()
     {
 
         // SUBROUTINE INFORMATION:
@@ -606,26 +581,26 @@ namespace PlantComponentTemperatureSources {
         // SUBROUTINE PARAMETER DEFINITIONS:
         static std::string const RoutineName("CalcWaterSource");
 
-        if (WaterSource(SourceNum).MassFlowRate > 0.0) {
-            WaterSource(SourceNum).OutletTemp = WaterSource(SourceNum).BoundaryTemp;
-            Real64 Cp = GetSpecificHeatGlycol(PlantLoop(WaterSource(SourceNum).Location.loopNum).FluidName,
-                                              WaterSource(SourceNum).BoundaryTemp,
-                                              PlantLoop(WaterSource(SourceNum).Location.loopNum).FluidIndex,
+        if (this->MassFlowRate > 0.0) {
+            this->OutletTemp = this->BoundaryTemp;
+            Real64 Cp = GetSpecificHeatGlycol(PlantLoop(this->Location.loopNum).FluidName,
+                                              this->BoundaryTemp,
+                                              PlantLoop(this->Location.loopNum).FluidIndex,
                                               RoutineName);
-            WaterSource(SourceNum).HeatRate =
-                WaterSource(SourceNum).MassFlowRate * Cp * (WaterSource(SourceNum).OutletTemp - WaterSource(SourceNum).InletTemp);
-            WaterSource(SourceNum).HeatEnergy = WaterSource(SourceNum).HeatRate * TimeStepSys * SecInHour;
+            this->HeatRate =
+                this->MassFlowRate * Cp * (this->OutletTemp - this->InletTemp);
+            this->HeatEnergy = this->HeatRate * TimeStepSys * SecInHour;
         } else {
-            WaterSource(SourceNum).OutletTemp = WaterSource(SourceNum).BoundaryTemp;
-            WaterSource(SourceNum).HeatRate = 0.0;
-            WaterSource(SourceNum).HeatEnergy = 0.0;
+            this->OutletTemp = this->BoundaryTemp;
+            this->HeatRate = 0.0;
+            this->HeatEnergy = 0.0;
         }
     }
 
-    void UpdateWaterSource(int const SourceNum)
+    void WaterSourceSpecs::update()
     {
-        int OutletNode = WaterSource(SourceNum).OutletNodeNum;
-        Node(OutletNode).Temp = WaterSource(SourceNum).OutletTemp;
+        int OutletNode = this->OutletNodeNum;
+        Node(OutletNode).Temp = this->OutletTemp;
     }
 
 } // namespace PlantComponentTemperatureSources
@@ -56,6 +56,7 @@
 #include <DataPlant.hh>
 #include <EnergyPlus.hh>
 #include <Plant/PlantLocation.hh>
+#include <PlantComponent.hh>
 
 namespace EnergyPlus {
 
@@ -76,7 +77,7 @@ namespace PlantComponentTemperatureSources {
 
     // Types
 
-    struct WaterSourceSpecs
+    struct WaterSourceSpecs : PlantComponent
     {
         // Members
         std::string Name;                       // user identifier
@@ -98,7 +99,6 @@ namespace PlantComponentTemperatureSources {
         Real64 HeatEnergy;
         PlantLocation Location;
         Real64 SizFac; // sizing factor
-        bool CheckEquipName;
         bool MyFlag;
         bool MyEnvironFlag;
         bool IsThisSized; // TRUE if sizing is done
@@ -108,40 +108,35 @@ namespace PlantComponentTemperatureSources {
             : InletNodeNum(0), OutletNodeNum(0), DesVolFlowRate(0.0), DesVolFlowRateWasAutoSized(false), MassFlowRateMax(0.0),
               EMSOverrideOnMassFlowRateMax(false), EMSOverrideValueMassFlowRateMax(0.0), MassFlowRate(0.0), TempSpecType(0), TempSpecScheduleNum(0),
               BoundaryTemp(0.0), OutletTemp(0.0), InletTemp(0.0), HeatRate(0.0), HeatEnergy(0.0), Location(0, 0, 0, 0), SizFac(0.0),
-              CheckEquipName(true), MyFlag(true), MyEnvironFlag(true), IsThisSized(false)
+              MyFlag(true), MyEnvironFlag(true), IsThisSized(false)
         {
         }
-    };
 
-    // Object Data
-    extern Array1D<WaterSourceSpecs> WaterSource; // dimension to number of machines
+        void simulate(const PlantLocation &calledFromLocation, bool FirstHVACIteration, Real64 &CurLoad, bool RunFlag) override;
 
-    // Functions
+        void getDesignCapacities(const PlantLocation &EP_UNUSED(calledFromLocation), Real64 &MaxLoad, Real64 &MinLoad, Real64 &OptLoad) override;
 
-    void SimWaterSource(std::string const &SourceName, // user-specified name for this component
-                        int const EquipFlowCtrl,       // Flow control mode for the equipment
-                        int &CompIndex,                // HX number pointer
-                        bool const RunFlag,            // simulate HX when TRUE
-                        bool const FirstHVACIteration, // initialize variables when TRUE
-                        bool &InitLoopEquip,           // If not zero, calculate the max load for operating conditions
-                        Real64 &MyLoad,                // loop demand component will meet
-                        Real64 &MaxLoad,
-                        Real64 &MinLoad,
-                        Real64 &OptLoad,
-                        bool const GetSizingFactor, // TRUE when just the sizing factor is requested
-                        Real64 &SizingFactor        // sizing factor
-    );
+        void getSizingFactor(Real64 &_SizFac) override;
 
-    void GetWaterSource();
+        void onInitLoopEquip(const PlantLocation &calledFromLocation) override;
+
+        void initialize(Real64 MyLoad);
+
+        void size();
 
-    void InitWaterSource(int const SourceNum, // number of the current component being simulated
-                         Real64 const MyLoad);
+        void calculate();
 
-    void SizeWaterSource(int const SourceNum);
+        void update();
 
-    void CalcWaterSource(int const SourceNum);
+        static PlantComponent *factory(std::string const &objectName);
+    };
+
+    // Object Data
+    extern Array1D<WaterSourceSpecs> WaterSource; // dimension to number of machines
 
-    void UpdateWaterSource(int const SourceNum);
+    // Functions
+
+    void GetWaterSource();
 
     // End of Record Keeping subroutines for the Const COP Chiller Module
     // *****************************************************************************
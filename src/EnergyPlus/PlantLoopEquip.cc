@@ -75,7 +75,6 @@
 #include <Plant/PlantLocation.hh>
 #include <PlantCentralGSHP.hh>
 #include <PlantChillers.hh>
-#include <PlantComponentTemperatureSources.hh>
 #include <PlantHeatExchangerFluidToFluid.hh>
 #include <Pumps.hh>
 #include <RefrigeratedCase.hh>
@@ -204,7 +203,6 @@ namespace PlantLoopEquip {
         using PhotovoltaicThermalCollectors::CalledFromPlantLoopEquipMgr;
         using PhotovoltaicThermalCollectors::SimPVTcollectors;
         using PlantCentralGSHP::SimCentralGroundSourceHeatPump;
-        using PlantComponentTemperatureSources::SimWaterSource;
         using RefrigeratedCase::SimRefrigCondenser;
         using SolarCollectors::SimSolarCollector;
         using SteamBaseboardRadiator::UpdateSteamBaseboardPlantConnection;
@@ -265,37 +263,14 @@ namespace PlantLoopEquip {
                     return;
                 }
             }
+            // Components migrated behind the PlantComponent interface are dispatched directly, the type chain
+            // below only remains for the legacy Sim* entry points
+            sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
+            return;
         }
 
         // select equipment and call equipment simulation
-        // PIPES
-        // Pipe has no special types at the moment, so find it this way
-        if (GeneralEquipType == GenEquipTypes_Pipe) {
-            if (EquipTypeNum == TypeOf_Pipe) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else if (EquipTypeNum == TypeOf_PipeSteam) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else if (EquipTypeNum == TypeOf_PipeExterior) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else if (EquipTypeNum == TypeOf_PipeInterior) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else if (EquipTypeNum == TypeOf_PipeUnderground) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else if (EquipTypeNum == TypeOf_PipingSystemPipeCircuit) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else {
-                ShowSevereError("SimPlantEquip: Invalid Pipe Type=" + sim_component.TypeOf);
-                ShowContinueError("Occurs in Plant Loop=" + PlantLoop(LoopNum).Name);
-                ShowFatalError("Preceding condition causes termination.");
-            }
-
-        } else if (GeneralEquipType == GenEquipTypes_Pump) {
+        if (GeneralEquipType == GenEquipTypes_Pump) {
             // DSU? This is still called by the sizing routine, is that OK?
 
             //      SELECT CASE(EquipTypeNum)
@@ -541,25 +516,7 @@ namespace PlantLoopEquip {
 
             // HEAT PUMPS
         } else if (GeneralEquipType == GenEquipTypes_HeatPump) {
-            if (EquipTypeNum == TypeOf_HPWaterPECooling) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else if (EquipTypeNum == TypeOf_HPWaterPEHeating) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else if (EquipTypeNum == TypeOf_HPWaterEFCooling) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else if (EquipTypeNum == TypeOf_HPWaterEFHeating) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else if (EquipTypeNum == TypeOf_HeatPumpEIRCooling) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else if (EquipTypeNum == TypeOf_HeatPumpEIRHeating) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else if (EquipTypeNum == TypeOf_HeatPumpVRF) {
+            if (EquipTypeNum == TypeOf_HeatPumpVRF) {
 
                 SimVRFCondenserPlant(sim_component.TypeOf,
                                      EquipTypeNum,
@@ -591,29 +548,6 @@ namespace PlantLoopEquip {
                 ShowFatalError("Previous condition causes termination.");
             }
 
-            // TOWERS
-        } else if (GeneralEquipType == GenEquipTypes_CoolingTower) {
-
-            // TOWERS
-            if (EquipTypeNum == TypeOf_CoolingTower_SingleSpd) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-            } else if (EquipTypeNum == TypeOf_CoolingTower_TwoSpd) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-            } else if (EquipTypeNum == TypeOf_CoolingTower_VarSpd) { // 'CoolingTower:VariableSpeed'
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-            } else if (EquipTypeNum == TypeOf_CoolingTower_VarSpdMerkel) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-            } else {
-                ShowSevereError("SimPlantEquip: Invalid Tower Type=" + sim_component.TypeOf);
-                ShowContinueError("Occurs in Plant Loop=" + PlantLoop(LoopNum).Name);
-                ShowFatalError("Preceding condition causes termination.");
-            }
-
-            // FLUID COOLERS
-        } else if (GeneralEquipType == GenEquipTypes_FluidCooler) {
-
-            sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
         } else if (GeneralEquipType == GenEquipTypes_EvapFluidCooler) {
 
             // EvapFluidCoolers
@@ -666,26 +600,6 @@ namespace PlantLoopEquip {
                 ShowFatalError("Previous condition causes termination.");
             }
 
-            // BOILERS
-        } else if (GeneralEquipType == GenEquipTypes_Boiler) {
-            if (EquipTypeNum == TypeOf_Boiler_Simple) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else if (EquipTypeNum == TypeOf_Boiler_Steam) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else {
-                ShowSevereError("SimPlantEquip: Invalid Boiler Type=" + sim_component.TypeOf);
-                ShowContinueError("Occurs in Plant Loop=" + PlantLoop(LoopNum).Name);
-                ShowFatalError("Preceding condition causes termination.");
-            }
-
-            //            if (InitLoopEquip && EquipNum == 0) {
-            //                ShowSevereError("InitLoop did not set Equipment Index for Boiler=" + sim_component.TypeOf);
-            //                ShowContinueError("..Boiler Name=" + sim_component.Name + ", in Plant Loop=" + PlantLoop(LoopNum).Name);
-            //                ShowFatalError("Previous condition causes termination.");
-            //            }
-
             // WATER HEATER
         } else if (GeneralEquipType == GenEquipTypes_WaterThermalTank) {
 
@@ -742,20 +656,6 @@ namespace PlantLoopEquip {
                 ShowFatalError("Previous condition causes termination.");
             }
 
-            // PURCHASED
-        } else if (GeneralEquipType == GenEquipTypes_Purchased) {
-            if (EquipTypeNum == TypeOf_PurchChilledWater) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else if (EquipTypeNum == TypeOf_PurchHotWater) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else {
-                ShowSevereError("SimPlantEquip: Invalid District Energy Type=" + sim_component.TypeOf);
-                ShowContinueError("Occurs in Plant Loop=" + PlantLoop(LoopNum).Name);
-                ShowFatalError("Preceding condition causes termination.");
-            }
-
         } else if (GeneralEquipType == GenEquipTypes_HeatExchanger) {
 
             if (EquipTypeNum == TypeOf_FluidToFluidPlantHtExchg) {
@@ -783,30 +683,6 @@ namespace PlantLoopEquip {
                 ShowFatalError("Preceding condition causes termination.");
             }
 
-        } else if (GeneralEquipType == GenEquipTypes_GroundHeatExchanger) {
-
-            if (EquipTypeNum == TypeOf_GrndHtExchgSystem) { // 'GROUND HEAT EXCHANGER:SYSTEM'
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else if (EquipTypeNum == TypeOf_GrndHtExchgSurface) { // 'GROUND HEAT EXCHANGER:SURFACE'
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else if (EquipTypeNum == TypeOf_GrndHtExchgPond) { // 'GROUND HEAT EXCHANGER:POND'
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else if (EquipTypeNum == TypeOf_GrndHtExchgHorizTrench) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-                if (InitLoopEquip) {
-                    sim_component.CompNum = EquipNum;
-                }
-
-            } else if (EquipTypeNum == TypeOf_GrndHtExchgSlinky) { // 'GROUND HEAT EXCHANGER:SLINKY'
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-
-            } else if (EquipTypeNum == TypeOf_IceRink) { // 'ICE RINK'
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-            }
             // THERMAL STORAGE
         } else if (GeneralEquipType == GenEquipTypes_ThermalStorage) {
 
@@ -886,15 +762,6 @@ namespace PlantLoopEquip {
                 ShowFatalError("Previous condition causes termination.");
             }
 
-        } else if (GeneralEquipType == GenEquipTypes_Valve) {
-            if (EquipTypeNum == TypeOf_ValveTempering) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-            } else {
-                ShowSevereError("SimPlantEquip: Invalid Valve Type=" + sim_component.TypeOf);
-                ShowContinueError("Occurs in Plant Loop=" + PlantLoop(LoopNum).Name);
-                ShowFatalError("Preceding condition causes termination.");
-            }
-
         } else if (GeneralEquipType == GenEquipTypes_Generator) {
             // for heat recovery plant interactions.
 
@@ -1023,20 +890,6 @@ namespace PlantLoopEquip {
                 ShowFatalError("Previous condition causes termination.");
             }
 
-        } else if (GeneralEquipType == GenEquipTypes_LoadProfile) { // DSU2 draft out InitLoopEquip on a demand side component
-
-            if (EquipTypeNum == TypeOf_PlantLoadProfile) {
-                sim_component.compPtr->simulate(sim_component_location, FirstHVACIteration, CurLoad, RunFlag);
-                if (InitLoopEquip) {
-                    sim_component.CompNum = EquipNum;
-                }
-
-            } else {
-                ShowSevereError("SimPlantEquip: Invalid Load Profile Type=" + sim_component.TypeOf);
-                ShowContinueError("Occurs in Plant Loop=" + PlantLoop(LoopNum).Name);
-                ShowFatalError("Preceding condition causes termination.");
-            }
-
         } else if (GeneralEquipType == GenEquipTypes_DemandCoil) { // DSU3
             // for now these are place holders, the sim routines are called from other places, unclear if we need
             //  to call an update routine, or if air-side updates are sufficient.  this is where plant updates would be called from
@@ -1191,27 +1044,6 @@ namespace PlantLoopEquip {
                     sim_component.CompNum = EquipNum;
                 }
 
-            } else if (EquipTypeNum == TypeOf_WaterSource) {
-
-                SimWaterSource(sim_component.Name,
-                               EquipFlowCtrl,
-                               EquipNum,
-                               RunFlag,
-                               FirstHVACIteration,
-                               InitLoopEquip,
-                               CurLoad,
-                               MaxLoad,
-                               MinLoad,
-                               OptLoad,
-                               GetCompSizFac,
-                               SizingFac); // DSU
-                if (InitLoopEquip) {
-                    sim_component.MaxLoad = MaxLoad;
-                    sim_component.MinLoad = MinLoad;
-                    sim_component.OptLoad = OptLoad;
-                    sim_component.CompNum = EquipNum;
-                }
-
             } else {
                 //        CALL ShowSevereError('SimPlantEquip: Invalid Component Equipment Type='//TRIM(EquipType))
                 //        CALL ShowContinueError('Occurs in Plant Loop='//TRIM(PlantLoop(LoopNum)%Name))
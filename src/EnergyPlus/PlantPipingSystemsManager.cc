@@ -4982,7 +4982,7 @@ namespace EnergyPlus {
 
             Real64 CurTime = this->Cur.CurSimTimeSeconds;
             Real64 z = this->Extents.yMax - cell.Centroid.Y;
-            return this->groundTempModel->getGroundTempAtTimeInSeconds(z, CurTime);
+            return this->groundTempModel->getGroundTempAtTimeInSecondsTabulated(z, CurTime);
         }
 
         void Domain::PreparePipeCircuitSimulation(Circuit * thisCircuit) {
@@ -206,6 +206,12 @@ namespace Psychrometrics {
     std::string String;
     bool ReportErrors(true);
     Array1D_int iPsyErrIndex(NumPsychMonitors, 0); // Number of times error occurred
+#ifdef EP_fast_Psychrometrics
+    bool UseFastPsychrometrics(true);
+#else
+    bool UseFastPsychrometrics(false);
+#endif
+    int FastPsyNewtonSteps(1);
 #ifdef EP_psych_stats
     Array1D<Int64> NumTimesCalled(NumPsychMonitors, 0);
     Array1D_int NumIterations(NumPsychMonitors, 0);
@@ -228,6 +234,12 @@ namespace Psychrometrics {
         String = "";
         ReportErrors = true;
         iPsyErrIndex = Array1D_int(NumPsychMonitors, 0);
+#ifdef EP_fast_Psychrometrics
+        UseFastPsychrometrics = true;
+#else
+        UseFastPsychrometrics = false;
+#endif
+        FastPsyNewtonSteps = 1;
 #ifdef EP_psych_stats
         NumTimesCalled = Array1D<Int64>(NumPsychMonitors, 0);
         NumIterations = Array1D_int(NumPsychMonitors, 0);
@@ -473,6 +485,7 @@ namespace Psychrometrics {
         Int64 W_tag;
         Int64 Pb_tag;
         Int64 hash;
+        int Mode_tag;
         Real64 Tdb_tag_r;
         Real64 W_tag_r;
         Real64 Pb_tag_r;
@@ -489,11 +502,14 @@ namespace Psychrometrics {
         W_tag = bit_shift(W_tag, -Grid_Shift);
         Pb_tag = bit_shift(Pb_tag, -Grid_Shift);
         hash = bit_and(bit_xor(Tdb_tag, bit_xor(W_tag, Pb_tag)), Int64(twbcache_size - 1));
+        Mode_tag = (UseFastPsychrometrics ? 1 + FastPsyNewtonSteps : 0); // Results of the two methods must not be mixed
 
-        if (cached_Twb(hash).iTdb != Tdb_tag || cached_Twb(hash).iW != W_tag || cached_Twb(hash).iPb != Pb_tag) {
+        if (cached_Twb(hash).iTdb != Tdb_tag || cached_Twb(hash).iW != W_tag || cached_Twb(hash).iPb != Pb_tag ||
+            cached_Twb(hash).iMode != Mode_tag) {
             cached_Twb(hash).iTdb = Tdb_tag;
             cached_Twb(hash).iW = W_tag;
             cached_Twb(hash).iPb = Pb_tag;
+            cached_Twb(hash).iMode = Mode_tag;
 
             Tdb_tag_r = bit_transfer(bit_shift(Tdb_tag, Grid_Shift), Tdb_tag_r);
             W_tag_r = bit_transfer(bit_shift(W_tag, Grid_Shift), W_tag_r);
@@ -631,6 +647,16 @@ namespace Psychrometrics {
             W = 1.0e-5;
         }
 
+        if (UseFastPsychrometrics) {
+            TWB = PsyTwbFnTdbWPb_fast(TDB, W, Patm);
+#ifdef EP_psych_errors
+            if (FlagError) {
+                ShowContinueError(" Resultant Temperature= " + TrimSigDigits(TWB, 2));
+            }
+#endif
+            return TWB;
+        }
+
         // Initial temperature guess at atmospheric pressure
         if (Patm != last_Patm) {
             tBoil = PsyTsatFnPb(Patm, (CalledFrom.empty() ? RoutineName : CalledFrom));
@@ -1444,6 +1470,9 @@ namespace Psychrometrics {
         } else if ((Press > 611.000) && (Press < 611.25)) {
             tSat = 0.0;
 
+        } else if (UseFastPsychrometrics) {
+            tSat = PsyTsatFnPb_fast(Press);
+
         } else {
             // Iterate to find the saturation temperature
             // of water given the total pressure
@@ -1513,6 +1542,121 @@ namespace Psychrometrics {
         return Temp;
     }
 
+    namespace {
+        // Closed-form inverse of the saturation pressure curve in PsyPsatFnTemp, fitted as
+        // 1/T = C0 + C1 ln(P) + C2 ln(P)^2 + C3 ln(P)^3 separately over ice (-100C to 0C) and liquid water (0C to 200C).
+        // Max error is 0.005 K over ice and 0.048 K over water.
+        inline Real64 PsyTsatFnLogPb_approx(Real64 const LogP) // natural log of the saturation pressure {Pascals}
+        {
+            if (LogP < 6.415424237852311) { // ln(611.2 Pa), the triple point
+                return 1.0 / (4.704330809190739e-3 +
+                              LogP * (-1.627215921691858e-4 + LogP * (3.5124852825027525e-8 + LogP * -3.053813473936245e-9))) -
+                       KelvinConv;
+            }
+            return 1.0 / (4.813727546894542e-3 + LogP * (-1.776948689445048e-4 + LogP * (1.0536184069763066e-7 + LogP * -6.503360749196906e-8))) -
+                   KelvinConv;
+        }
+
+        // Derivative of ln(Psat) with respect to temperature for the Hyland & Wexler curve in PsyPsatFnTemp
+        inline Real64 PsyDLogPsatFnTemp(Real64 const T) // temperature {C}
+        {
+            Real64 const Tkel(T + KelvinConv);
+            if (Tkel < KelvinConv) {
+                return 5674.5359 / pow_2(Tkel) - 0.9677843e-2 + Tkel * (1.24431402e-6 + Tkel * (0.62243475e-8 - Tkel * 3.7936096e-12)) +
+                       4.1635019 / Tkel;
+            }
+            return 5800.2206 / pow_2(Tkel) - 0.048640239 + Tkel * (0.83529536e-4 - Tkel * 0.43356279e-7) + 6.5459673 / Tkel;
+        }
+    } // namespace
+
+    Real64 PsyTsatFnPb_fast(Real64 const Press) // barometric pressure {Pascals}
+    {
+
+        // PURPOSE OF THIS FUNCTION:
+        // This function provides the saturation temperature from barometric pressure without the
+        // iteration used by PsyTsatFnPb.
+
+        // METHODOLOGY EMPLOYED:
+        // A rational approximation of the inverse saturation curve (max error 0.048 K) is refined with
+        // FastPsyNewtonSteps Newton steps on ln(Psat) using PsyPsatFnTemp and its analytic derivative.
+        // Between -99.9C and 199.9C the max error against the exact inverse is 5.3E-6 K after one step
+        // and round-off after two.  The limits and the 0C special case of PsyTsatFnPb are kept.
+
+        if (Press >= 1555000.0) return 200.0;
+        if (Press <= 0.0017) return -100.0;
+        if ((Press > 611.000) && (Press < 611.25)) return 0.0;
+
+        Real64 const LogP(std::log(Press));
+        Real64 tSat(PsyTsatFnLogPb_approx(LogP));
+        for (int iter = 1; iter <= FastPsyNewtonSteps; ++iter) {
+            tSat -= (std::log(PsyPsatFnTemp(tSat)) - LogP) / PsyDLogPsatFnTemp(tSat);
+        }
+        return max(-100.0, min(200.0, tSat));
+    }
+
+    Real64 PsyTwbFnTdbWPb_fast(Real64 const TDB, // dry-bulb temperature {C}
+                               Real64 const W,   // humidity ratio
+                               Real64 const Patm // barometric pressure {Pascals}
+    )
+    {
+
+        // PURPOSE OF THIS FUNCTION:
+        // This function provides the wet-bulb temperature from dry-bulb temperature, humidity ratio
+        // and barometric pressure without the secant iteration used by PsyTwbFnTdbWPb.
+
+        // METHODOLOGY EMPLOYED:
+        // The psychrometric equation solved by PsyTwbFnTdbWPb gives, for a trial wet-bulb temperature,
+        // the humidity ratio the air must have at saturation.  Converting it to a vapor pressure and
+        // inverting the saturation curve with the rational approximation gives the fixed-point form
+        // Twb = Tsat(Wreq(Twb)), which needs no exponentials.  Newton's method on that form, started at
+        // the dry-bulb temperature, stops once the residual is below 0.1 K (about 3 steps on average),
+        // leaving a max error of 0.083 K.  FastPsyNewtonSteps Newton steps on the psychrometric equation
+        // itself, using PsyPsatFnTemp, then reduce the max error to 2.0E-4 K (one step) or 1.0E-8 K
+        // (two steps).  These errors are against the exact solution over -40C to 60C and 60 kPa to
+        // 110 kPa, and also hold from -90C to 150C and 30 kPa to 200 kPa.
+
+        // FUNCTION PARAMETER DEFINITIONS:
+        int const MaxFixedPointIter(12); // Maximum Newton steps on the fixed-point form
+        Real64 const FixedPointTol(0.1); // Residual of the fixed-point form at which the refinement takes over {C}
+
+        // FUNCTION LOCAL VARIABLE DECLARATIONS:
+        static Real64 last_Patm(-99999.0);  // barometric pressure {Pascals}  (last)
+        static Real64 last_tBoil(-99999.0); // Boiling temperature of water at given pressure (last)
+
+        Real64 const Wloc(W < 0.0 ? 1.0e-5 : W);
+        if (Patm != last_Patm) {
+            last_tBoil = PsyTsatFnPb_fast(Patm);
+            last_Patm = Patm;
+        }
+        Real64 const WBTMax(min(TDB, last_tBoil - 0.1));
+
+        Real64 WBT(WBTMax);
+        for (int iter = 1; iter <= MaxFixedPointIter; ++iter) {
+            Real64 const Numer(Wloc * (2501.0 + 1.805 * TDB - 4.186 * WBT) + (TDB - WBT));
+            Real64 const Denom(2501.0 - 2.381 * WBT);
+            Real64 const WReq(Numer / Denom);                 // Saturation humidity ratio needed at WBT
+            Real64 const PReq(Patm * WReq / (0.62198 + WReq)); // Corresponding saturation pressure
+            Real64 const TReq(PsyTsatFnLogPb_approx(std::log(PReq)));
+            Real64 const Residual(TReq - WBT);
+            if (std::abs(Residual) < FixedPointTol) break;
+            Real64 const dWReq(((-4.186 * Wloc - 1.0) * Denom + 2.381 * Numer) / pow_2(Denom));
+            Real64 const dTReq(Patm * 0.62198 / pow_2(0.62198 + WReq) * dWReq / (PReq * PsyDLogPsatFnTemp(TReq)));
+            WBT = min(WBT - Residual / (dTReq - 1.0), WBTMax);
+        }
+
+        for (int iter = 1; iter <= FastPsyNewtonSteps; ++iter) {
+            Real64 const PSatstar(PsyPsatFnTemp(WBT));
+            Real64 const Wstar(0.62198 * PSatstar / (Patm - PSatstar));
+            Real64 const dWstar(0.62198 * Patm / pow_2(Patm - PSatstar) * PSatstar * PsyDLogPsatFnTemp(WBT));
+            Real64 const Numer((2501.0 - 2.381 * WBT) * Wstar - (TDB - WBT));
+            Real64 const Denom(2501.0 + 1.805 * TDB - 4.186 * WBT);
+            Real64 const dNumer(-2.381 * Wstar + (2501.0 - 2.381 * WBT) * dWstar + 1.0);
+            WBT = min(WBT - (Numer / Denom - Wloc) * pow_2(Denom) / (dNumer * Denom + 4.186 * Numer), WBTMax);
+        }
+
+        return WBT;
+    }
+
 } // namespace Psychrometrics
 
 } // namespace EnergyPlus
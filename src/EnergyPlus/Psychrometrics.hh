@@ -136,6 +136,8 @@ namespace Psychrometrics {
     extern std::string String;
     extern bool ReportErrors;
     extern Array1D_int iPsyErrIndex; // Number of times error occurred
+    extern bool UseFastPsychrometrics; // Use the direct wet-bulb and saturation temperature approximations
+    extern int FastPsyNewtonSteps;     // Newton refinement steps applied to the direct approximations
 #ifdef EP_psych_stats
     extern Array1D<Int64> NumTimesCalled;
     extern Array1D_int NumIterations;
@@ -152,10 +154,11 @@ namespace Psychrometrics {
         Int64 iTdb;
         Int64 iW;
         Int64 iPb;
+        int iMode; // 0 for the iterative method, 1 + FastPsyNewtonSteps for the fast method
         Real64 Twb;
 
         // Default Constructor
-        cached_twb_t() : iTdb(0), iW(0), iPb(0), Twb(0.0)
+        cached_twb_t() : iTdb(0), iW(0), iPb(0), iMode(0), Twb(0.0)
         {
         }
     };
@@ -1058,6 +1061,13 @@ namespace Psychrometrics {
                        std::string const &CalledFrom = blank_string // routine this function was called from (error messages)
     );
 
+    Real64 PsyTsatFnPb_fast(Real64 const Press); // barometric pressure {Pascals}
+
+    Real64 PsyTwbFnTdbWPb_fast(Real64 const TDB, // dry-bulb temperature {C}
+                               Real64 const W,   // humidity ratio
+                               Real64 const Patm // barometric pressure {Pascals}
+    );
+
     inline Real64 PsyTdpFnWPb(Real64 const W,                              // humidity ratio
                               Real64 const PB,                             // barometric pressure (N/M**2) {Pascals}
                               std::string const &CalledFrom = blank_string // routine this function was called from (error messages)
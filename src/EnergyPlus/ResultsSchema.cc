@@ -46,8 +46,10 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 // C++ Headers
+#include <chrono>
 #include <cmath>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <random>
 #include <string>
@@ -1050,50 +1052,7 @@ namespace ResultsFramework {
         }
     }
 
-    void ResultsSchema::writeTimeSeriesReports()
-    {
-        // Output detailed Zone time series data
-        if (OutputSchema->RIDetailedZoneTSData.rDataFrameEnabled() || OutputSchema->RIDetailedZoneTSData.iDataFrameEnabled()) {
-            OutputSchema->RIDetailedZoneTSData.writeReport(outputJSON, outputCBOR, outputMsgPack);
-        }
-
-        // Output detailed HVAC time series data
-        if (OutputSchema->RIDetailedHVACTSData.iDataFrameEnabled() || OutputSchema->RIDetailedHVACTSData.rDataFrameEnabled()) {
-            OutputSchema->RIDetailedHVACTSData.writeReport(outputJSON, outputCBOR, outputMsgPack);
-        }
-
-        // Output timestep time series data
-        if (OutputSchema->RITimestepTSData.iDataFrameEnabled() || OutputSchema->RITimestepTSData.rDataFrameEnabled()) {
-            OutputSchema->RITimestepTSData.writeReport(outputJSON, outputCBOR, outputMsgPack);
-        }
-
-        // Output hourly time series data
-        if (OutputSchema->RIHourlyTSData.iDataFrameEnabled() || OutputSchema->RIHourlyTSData.rDataFrameEnabled()) {
-            OutputSchema->RIHourlyTSData.writeReport(outputJSON, outputCBOR, outputMsgPack);
-        }
-
-        // Output daily time series data
-        if (OutputSchema->RIDailyTSData.iDataFrameEnabled() || OutputSchema->RIDailyTSData.rDataFrameEnabled()) {
-            OutputSchema->RIDailyTSData.writeReport(outputJSON, outputCBOR, outputMsgPack);
-        }
-
-        // Output monthly time series data
-        if (OutputSchema->RIMonthlyTSData.iDataFrameEnabled() || OutputSchema->RIMonthlyTSData.rDataFrameEnabled()) {
-            OutputSchema->RIMonthlyTSData.writeReport(outputJSON, outputCBOR, outputMsgPack);
-        }
-
-        // Output run period time series data
-        if (OutputSchema->RIRunPeriodTSData.iDataFrameEnabled() || OutputSchema->RIRunPeriodTSData.rDataFrameEnabled()) {
-            OutputSchema->RIRunPeriodTSData.writeReport(outputJSON, outputCBOR, outputMsgPack);
-        }
-
-        // Output yearly time series data
-        if (OutputSchema->RIYearlyTSData.iDataFrameEnabled() || OutputSchema->RIYearlyTSData.rDataFrameEnabled()) {
-            OutputSchema->RIYearlyTSData.writeReport(outputJSON, outputCBOR, outputMsgPack);
-        }
-    }
-
-    void ResultsSchema::WriteReport()
+    json ResultsSchema::getReportJSON()
     {
         json root, outputVars, rdd, meterVars, meterData;
         json rddvals = json::array();
@@ -1206,22 +1165,141 @@ namespace ResultsFramework {
         root["MeterData"] = meterData;
         root["TabularReports"] = TabularReportsCollection.getJSON();
 
-        if (outputJSON && DataGlobals::jsonOutputStreams.json_stream) {
+        return root;
+    }
+
+    void ResultsSchema::writeJSONReport(json const &root)
+    {
+        if (DataGlobals::jsonOutputStreams.json_stream) {
             auto const dumped_json = root.dump(4, ' ', false, json::error_handler_t::replace);
             std::copy(dumped_json.begin(), dumped_json.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.json_stream));
         }
-        if (outputCBOR && DataGlobals::jsonOutputStreams.cbor_stream) {
+    }
+
+    void ResultsSchema::writeCBORReport(json const &root)
+    {
+        if (DataGlobals::jsonOutputStreams.cbor_stream) {
             json::to_cbor(root, *DataGlobals::jsonOutputStreams.cbor_stream);
 //            std::vector<uint8_t> v_cbor = json::to_cbor(root);
 //            std::copy(v_cbor.begin(), v_cbor.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.cbor_stream));
         }
-        if (outputMsgPack && DataGlobals::jsonOutputStreams.msgpack_stream) {
+    }
+
+    void ResultsSchema::writeMsgPackReport(json const &root)
+    {
+        if (DataGlobals::jsonOutputStreams.msgpack_stream) {
             json::to_msgpack(root, *DataGlobals::jsonOutputStreams.msgpack_stream);
 //            std::vector<uint8_t> v_msgpack = json::to_msgpack(root);
 //            std::copy(v_msgpack.begin(), v_msgpack.end(), std::ostream_iterator<uint8_t>(*DataGlobals::jsonOutputStreams.msgpack_stream));
         }
     }
 
+    std::vector<OutputSinkTiming> ResultsSchema::writeEndOfRunReports()
+    {
+        // Each time series frame and each format of the summary report goes to its own stream, and all of them only read
+        // the collected results, so they are written as independent tasks. The summary formats depend on the assembled
+        // summary, which is itself a task running alongside the time series.
+        std::vector<std::pair<DataFrame *, std::string>> timeSeries;
+        if (tsEnabled) {
+            for (auto const &frame : {std::make_pair(&RIDetailedZoneTSData, "Detailed-Zone"),
+                                      std::make_pair(&RIDetailedHVACTSData, "Detailed-HVAC"),
+                                      std::make_pair(&RITimestepTSData, "Timestep"),
+                                      std::make_pair(&RIHourlyTSData, "Hourly"),
+                                      std::make_pair(&RIDailyTSData, "Daily"),
+                                      std::make_pair(&RIMonthlyTSData, "Monthly"),
+                                      std::make_pair(&RIRunPeriodTSData, "RunPeriod"),
+                                      std::make_pair(&RIYearlyTSData, "Yearly")}) {
+                if (frame.first->iDataFrameEnabled() || frame.first->rDataFrameEnabled()) {
+                    timeSeries.emplace_back(frame.first, std::string(frame.second) + " time series");
+                }
+            }
+        }
+
+        // all sinks are listed up front so each task only ever touches its own entry
+        std::vector<OutputSinkTiming> sinks;
+        for (auto const &frame : timeSeries) {
+            sinks.emplace_back(frame.second);
+        }
+        int summarySink = -1;
+        int jsonSink = -1;
+        int cborSink = -1;
+        int msgpackSink = -1;
+        if (tsAndTabularEnabled) {
+            summarySink = static_cast<int>(sinks.size());
+            sinks.emplace_back("summary report assembly");
+            if (outputJSON && DataGlobals::jsonOutputStreams.json_stream) {
+                jsonSink = static_cast<int>(sinks.size());
+                sinks.emplace_back("summary report JSON");
+            }
+            if (outputCBOR && DataGlobals::jsonOutputStreams.cbor_stream) {
+                cborSink = static_cast<int>(sinks.size());
+                sinks.emplace_back("summary report CBOR");
+            }
+            if (outputMsgPack && DataGlobals::jsonOutputStreams.msgpack_stream) {
+                msgpackSink = static_cast<int>(sinks.size());
+                sinks.emplace_back("summary report MessagePack");
+            }
+        }
+
+        auto const runSink = [](OutputSinkTiming &sink, std::function<void()> const &write) {
+            auto const start = std::chrono::steady_clock::now();
+            try {
+                write();
+            } catch (std::exception const &e) {
+                sink.error = e.what();
+            }
+            sink.elapsedSeconds = std::chrono::duration<Real64>(std::chrono::steady_clock::now() - start).count();
+        };
+
+        json summary;
+#ifdef _OPENMP
+#pragma omp parallel
+#pragma omp single
+#endif
+        {
+            for (std::size_t i = 0; i < timeSeries.size(); ++i) {
+#ifdef _OPENMP
+#pragma omp task firstprivate(i)
+#endif
+                runSink(sinks[i], [&, i]() { timeSeries[i].first->writeReport(outputJSON, outputCBOR, outputMsgPack); });
+            }
+
+            if (summarySink >= 0) {
+#ifdef _OPENMP
+#pragma omp task
+#endif
+                {
+                    runSink(sinks[summarySink], [&]() { summary = getReportJSON(); });
+                    if (sinks[summarySink].error.empty()) {
+                        if (jsonSink >= 0) {
+#ifdef _OPENMP
+#pragma omp task
+#endif
+                            runSink(sinks[jsonSink], [&]() { writeJSONReport(summary); });
+                        }
+                        if (cborSink >= 0) {
+#ifdef _OPENMP
+#pragma omp task
+#endif
+                            runSink(sinks[cborSink], [&]() { writeCBORReport(summary); });
+                        }
+                        if (msgpackSink >= 0) {
+#ifdef _OPENMP
+#pragma omp task
+#endif
+                            runSink(sinks[msgpackSink], [&]() { writeMsgPackReport(summary); });
+                        }
+#ifdef _OPENMP
+#pragma omp taskwait
+#endif
+                    }
+                }
+            }
+        }
+
+        return sinks;
+    }
+
     void clear_state()
     {
         OutputSchema->DYMeters.setRDataFrameEnabled(false);
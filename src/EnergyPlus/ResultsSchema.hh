@@ -50,6 +50,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -273,6 +274,18 @@ namespace ResultsFramework {
         Report rpt;
     };
 
+    // One output written at the end of the run, with the wall time it took and any error raised while writing it
+    struct OutputSinkTiming
+    {
+        std::string name;
+        Real64 elapsedSeconds;
+        std::string error;
+
+        explicit OutputSinkTiming(std::string const &name) : name(name), elapsedSeconds(0.0)
+        {
+        }
+    };
+
     class ResultsSchema : public BaseResultObject
     {
     public:
@@ -312,8 +325,8 @@ namespace ResultsFramework {
         DataFrame SMMeters = DataFrame("RunPeriod");
         DataFrame YRMeters = DataFrame("Yearly");
 
-        void writeTimeSeriesReports();
-        void WriteReport();
+        // Writes the time series and summary reports (whichever are enabled) concurrently and returns the timing of each sink
+        std::vector<OutputSinkTiming> writeEndOfRunReports();
 
         SimInfo SimulationInformation;
 
@@ -322,6 +335,11 @@ namespace ResultsFramework {
         ReportsCollection TabularReportsCollection;
 
     protected:
+        json getReportJSON();
+        void writeJSONReport(json const &root);
+        void writeCBORReport(json const &root);
+        void writeMsgPackReport(json const &root);
+
         bool tsEnabled = false;
         bool tsAndTabularEnabled = false;
         bool outputJSON = false;
@@ -155,6 +155,46 @@ namespace RoomAirModelAirflowNetwork {
         RAFN.deallocate();
     }
 
+    void SetupNodeSurfaceLists(int const ZoneNum)
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Compile, for each RoomAir node in the zone, the list of heat transfer surfaces whose convection
+        // goes to that node, so the node sums do not scan every surface of the zone against every node mask.
+
+        // METHODOLOGY EMPLOYED:
+        // A surface belongs to a node when it is in the node's surface mask. Surfaces not assigned to any other
+        // node belong to the control node, matching the rule applied in CalcNodeSums and CalcSurfaceMoistureSums.
+
+        auto &ThisZoneInfo(RoomAirflowNetworkZoneInfo(ZoneNum));
+        int const SurfaceFirst = Zone(ZoneNum).SurfaceFirst;
+
+        auto NodeOwnsSurface = [&](int const RoomAirNode, int const SurfNum) {
+            int const MaskIndex = SurfNum - SurfaceFirst + 1;
+            if (ThisZoneInfo.ControlAirNodeID != RoomAirNode) return bool(ThisZoneInfo.Node(RoomAirNode).SurfMask(MaskIndex));
+            for (int Loop = 1; Loop <= ThisZoneInfo.NumOfAirNodes; ++Loop) {
+                if (Loop == RoomAirNode || !allocated(ThisZoneInfo.Node(Loop).SurfMask)) continue;
+                if (ThisZoneInfo.Node(Loop).SurfMask(MaskIndex)) return false;
+            }
+            return true;
+        };
+
+        for (int RoomAirNode = 1; RoomAirNode <= ThisZoneInfo.NumOfAirNodes; ++RoomAirNode) {
+            auto &ThisNode(ThisZoneInfo.Node(RoomAirNode));
+            ThisNode.SurfNums.deallocate();
+            if (!allocated(ThisNode.SurfMask)) continue;
+            int NumNodeSurfs = 0;
+            for (int SurfNum = SurfaceFirst; SurfNum <= Zone(ZoneNum).SurfaceLast; ++SurfNum) {
+                if (Surface(SurfNum).HeatTransSurf && NodeOwnsSurface(RoomAirNode, SurfNum)) ++NumNodeSurfs;
+            }
+            ThisNode.SurfNums.allocate(NumNodeSurfs);
+            NumNodeSurfs = 0;
+            for (int SurfNum = SurfaceFirst; SurfNum <= Zone(ZoneNum).SurfaceLast; ++SurfNum) {
+                if (Surface(SurfNum).HeatTransSurf && NodeOwnsSurface(RoomAirNode, SurfNum)) ThisNode.SurfNums(++NumNodeSurfs) = SurfNum;
+            }
+        }
+    }
+
     void SimRoomAirModelAirflowNetwork(int const ZoneNum) // index number for the specified zone
     {
 
@@ -324,6 +364,7 @@ namespace RoomAirModelAirflowNetwork {
             for (LoopZone = 1; LoopZone <= NumOfZones; ++LoopZone) {
                 if (!RoomAirflowNetworkZoneInfo(LoopZone).IsUsed) continue;
                 NumSurfs = Zone(LoopZone).SurfaceLast - Zone(LoopZone).SurfaceFirst + 1;
+                SetupNodeSurfaceLists(LoopZone);
                 for (LoopAirNode = 1; LoopAirNode <= RoomAirflowNetworkZoneInfo(LoopZone).NumOfAirNodes;
                      ++LoopAirNode) { // loop over all the modeled room air nodes
                     // calculate volume of air in node's control volume
@@ -828,6 +869,49 @@ namespace RoomAirModelAirflowNetwork {
         }
     } // UpdateRoomAirModelAirflowNetwork
 
+    void RAFNData::FindZoneAirSources()
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Find the controlled zone equipment configuration or the plenum that supplies air to this zone.
+        // The result is kept until the zone or the number of plenums changes, so the node sums do not
+        // search the equipment and plenum lists for every node on every iteration.
+
+        using DataGlobals::NumOfZones;
+        using DataHeatBalance::Zone;
+        using DataZoneEquipment::ZoneEquipConfig;
+        using ZonePlenum::NumZoneReturnPlenums;
+        using ZonePlenum::NumZoneSupplyPlenums;
+        using ZonePlenum::ZoneRetPlenCond;
+        using ZonePlenum::ZoneSupPlenCond;
+
+        if (AirSourcesZoneNum == ZoneNum && NumRetPlenumsFound == NumZoneReturnPlenums && NumSupPlenumsFound == NumZoneSupplyPlenums) return;
+
+        AirSourcesZoneNum = ZoneNum;
+        NumRetPlenumsFound = NumZoneReturnPlenums;
+        NumSupPlenumsFound = NumZoneSupplyPlenums;
+
+        ZoneEquipConfigNum = 0;
+        for (int Loop = 1; Loop <= NumOfZones; ++Loop) {
+            if (!Zone(Loop).IsControlled) continue;
+            if (ZoneEquipConfig(Loop).ActualZoneNum != ZoneNum) continue;
+            ZoneEquipConfigNum = Loop;
+            break;
+        }
+        ZoneRetPlenumNum = 0;
+        for (int Loop = 1; Loop <= NumZoneReturnPlenums; ++Loop) {
+            if (ZoneRetPlenCond(Loop).ActualZoneNum != ZoneNum) continue;
+            ZoneRetPlenumNum = Loop;
+            break;
+        }
+        ZoneSupPlenumNum = 0;
+        for (int Loop = 1; Loop <= NumZoneSupplyPlenums; ++Loop) {
+            if (ZoneSupPlenCond(Loop).ActualZoneNum != ZoneNum) continue;
+            ZoneSupPlenumNum = Loop;
+            break;
+        }
+    }
+
     void RAFNData::CalcNodeSums(int const RoomAirNodeNum)
     {
 
@@ -877,8 +961,6 @@ namespace RoomAirModelAirflowNetwork {
         using InternalHeatGains::SumReturnAirConvectionGainsByTypes;
         using Psychrometrics::PsyCpAirFnWTdb;
         using Psychrometrics::PsyRhoAirFnPbTdbW;
-        using ZonePlenum::NumZoneReturnPlenums;
-        using ZonePlenum::NumZoneSupplyPlenums;
         using ZonePlenum::ZoneRetPlenCond;
         using ZonePlenum::ZoneSupPlenCond;
 
@@ -887,10 +969,7 @@ namespace RoomAirModelAirflowNetwork {
         Real64 NodeTemp;     // System node temperature
         Real64 NodeW;        // System node humidity ratio
         Real64 MassFlowRate; // System node mass flow rate
-        int ZoneEquipConfigNum;
         bool ControlledZoneAirFlag;
-        int ZoneRetPlenumNum;
-        int ZoneSupPlenumNum;
         bool ZoneRetPlenumAirFlag;
         bool ZoneSupPlenumAirFlag;
         Real64 CpAir;      // Specific heat of air
@@ -914,8 +993,6 @@ namespace RoomAirModelAirflowNetwork {
         Real64 SumSysM;    //                !Zone sum of air system MassFlowRate
         Real64 SumSysMW;   //               !Zone sum of air system MassFlowRate*W
         int EquipLoop;     //              !Index of equipment loop
-        int Loop;          //                   !Index of RAFN node
-        bool Found;        //
         Real64 SumLinkM;   //               !Zone sum of MassFlowRate from the AirflowNetwork model
         Real64 SumLinkMW;  //             !Zone sum of MassFlowRate*W from the AirflowNetwork model
 
@@ -953,29 +1030,11 @@ namespace RoomAirModelAirflowNetwork {
             RoomAirflowNetworkZoneInfo(ZoneNum).Node(RoomAirNodeNum).SumIntSensibleGain += SumIntGain;
         }
 
-        // Check to see if this is a controlled zone
-
-        ControlledZoneAirFlag = false;
-        for (ZoneEquipConfigNum = 1; ZoneEquipConfigNum <= NumOfZones; ++ZoneEquipConfigNum) {
-            if (!Zone(ZoneEquipConfigNum).IsControlled) continue;
-            if (ZoneEquipConfig(ZoneEquipConfigNum).ActualZoneNum != ZoneNum) continue;
-            ControlledZoneAirFlag = true;
-            break; // sloppy way of finding ZoneEquipConfigNum for later use.
-        }          // ZoneEquipConfigNum
-
-        // Check to see if this is a plenum zone
-        ZoneRetPlenumAirFlag = false;
-        for (ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum) {
-            if (ZoneRetPlenCond(ZoneRetPlenumNum).ActualZoneNum != ZoneNum) continue;
-            ZoneRetPlenumAirFlag = true;
-            break;
-        } // ZoneRetPlenumNum
-        ZoneSupPlenumAirFlag = false;
-        for (ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum) {
-            if (ZoneSupPlenCond(ZoneSupPlenumNum).ActualZoneNum != ZoneNum) continue;
-            ZoneSupPlenumAirFlag = true;
-            break;
-        } // ZoneSupPlenumNum
+        // Check to see if this is a controlled zone or a plenum zone
+        FindZoneAirSources();
+        ControlledZoneAirFlag = (ZoneEquipConfigNum > 0);
+        ZoneRetPlenumAirFlag = (ZoneRetPlenumNum > 0);
+        ZoneSupPlenumAirFlag = (ZoneSupPlenumNum > 0);
 
         // Plenum and controlled zones have a different set of inlet nodes which must be calculated.
         if (ControlledZoneAirFlag) {
@@ -1047,23 +1106,10 @@ namespace RoomAirModelAirflowNetwork {
         // Modified by Gu to include assigned surfaces only shown in the surface lsit
         if (!RoomAirflowNetworkZoneInfo(ZoneNum).Node(RoomAirNodeNum).HasSurfacesAssigned) return;
 
-        for (SurfNum = Zone(ZoneNum).SurfaceFirst; SurfNum <= Zone(ZoneNum).SurfaceLast; ++SurfNum) {
-
-            if (!Surface(SurfNum).HeatTransSurf) continue; // Skip non - heat transfer surfaces
-            if (RoomAirflowNetworkZoneInfo(ZoneNum).ControlAirNodeID == RoomAirNodeNum) {
-                Found = false;
-                for (Loop = 1; Loop <= RoomAirflowNetworkZoneInfo(ZoneNum).NumOfAirNodes; ++Loop) {
-                    if (Loop != RoomAirNodeNum) {
-                        if (RoomAirflowNetworkZoneInfo(ZoneNum).Node(Loop).SurfMask(SurfNum - Zone(ZoneNum).SurfaceFirst + 1)) {
-                            Found = true;
-                            break;
-                        }
-                    }
-                }
-                if (Found) continue;
-            } else {
-                if (!RoomAirflowNetworkZoneInfo(ZoneNum).Node(RoomAirNodeNum).SurfMask(SurfNum - Zone(ZoneNum).SurfaceFirst + 1)) continue;
-            }
+        // Only the surfaces compiled for this node in SetupNodeSurfaceLists are visited
+        auto const &NodeSurfNums(RoomAirflowNetworkZoneInfo(ZoneNum).Node(RoomAirNodeNum).SurfNums);
+        for (int NodeSurfLoop = 1; NodeSurfLoop <= NodeSurfNums.isize(); ++NodeSurfLoop) {
+            SurfNum = NodeSurfNums(NodeSurfLoop);
 
             HA = 0.0;
             Area = Surface(SurfNum).Area; // For windows, this is the glazing area
@@ -1189,35 +1235,19 @@ namespace RoomAirModelAirflowNetwork {
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
         int SurfNum;
-        int Loop;
         Real64 RhoAirZone;
         Real64 Wsurf;
-        bool Found;
 
         SumHmAW = 0.0;
         SumHmARa = 0.0;
         SumHmARaW = 0.0;
 
-        for (SurfNum = Zone(ZoneNum).SurfaceFirst; SurfNum <= Zone(ZoneNum).SurfaceLast; ++SurfNum) {
-            if (!Surface(SurfNum).HeatTransSurf) continue; // Skip non - heat transfer surfaces
+        // Only the surfaces compiled for this node in SetupNodeSurfaceLists are visited
+        auto const &NodeSurfNums(RoomAirflowNetworkZoneInfo(ZoneNum).Node(RoomAirNode).SurfNums);
+        for (int NodeSurfLoop = 1; NodeSurfLoop <= NodeSurfNums.isize(); ++NodeSurfLoop) {
+            SurfNum = NodeSurfNums(NodeSurfLoop);
             if (Surface(SurfNum).Class == SurfaceClass_Window) continue;
 
-            if (RoomAirflowNetworkZoneInfo(ZoneNum).ControlAirNodeID == RoomAirNode) {
-                Found = false;
-                for (Loop = 1; Loop <= RoomAirflowNetworkZoneInfo(ZoneNum).NumOfAirNodes; ++Loop) {
-                    // None - assigned surfaces belong to the zone node
-                    if (Loop != RoomAirNode) {
-                        if (RoomAirflowNetworkZoneInfo(ZoneNum).Node(Loop).SurfMask(SurfNum - Zone(ZoneNum).SurfaceFirst + 1)) {
-                            Found = true;
-                            break;
-                        }
-                    }
-                }
-                if (Found) continue;
-            } else {
-                if (!RoomAirflowNetworkZoneInfo(ZoneNum).Node(RoomAirNode).SurfMask(SurfNum - Zone(ZoneNum).SurfaceFirst + 1)) continue;
-            }
-
             if (Surface(SurfNum).HeatTransferAlgorithm == HeatTransferModel_HAMT) {
                 UpdateHeatBalHAMT(SurfNum);
 
@@ -63,14 +63,25 @@ namespace RoomAirModelAirflowNetwork {
     public:
         int ZoneNum;
         int RoomAirNode;
+        int AirSourcesZoneNum;  // zone the air sources below were found for
+        int NumRetPlenumsFound; // number of return plenums when the air sources were found
+        int NumSupPlenumsFound; // number of supply plenums when the air sources were found
+        int ZoneEquipConfigNum; // controlled zone equipment configuration supplying the zone (0 if none)
+        int ZoneRetPlenumNum;   // return plenum whose plenum zone is the zone (0 if none)
+        int ZoneSupPlenumNum;   // supply plenum whose plenum zone is the zone (0 if none)
 
         // constructor
-        RAFNData() : ZoneNum(0), RoomAirNode(0)
+        RAFNData()
+            : ZoneNum(0), RoomAirNode(0), AirSourcesZoneNum(0), NumRetPlenumsFound(-1), NumSupPlenumsFound(-1), ZoneEquipConfigNum(0),
+              ZoneRetPlenumNum(0), ZoneSupPlenumNum(0)
         {
         }
 
         // functions
 
+        //*****************************************************************************************
+        void FindZoneAirSources();
+
         //*****************************************************************************************
         void InitRoomAirModelAirflowNetwork(int const RoomAirNode); // index number for the specified zone and room air node
 
@@ -98,6 +109,8 @@ namespace RoomAirModelAirflowNetwork {
 
     void clear_state();
 
+    void SetupNodeSurfaceLists(int const ZoneNum);
+
     void SimRoomAirModelAirflowNetwork(int const ZoneNum); // index number for the specified zone
 
     void LoadPredictionRoomAirModelAirflowNetwork(int const ZoneNum, int const RoomAirNode); // index number for the specified zone and node
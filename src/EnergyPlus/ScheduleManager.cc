@@ -490,14 +490,17 @@ namespace ScheduleManager {
         AddDaySch = 0;
         CurrentModuleObject = "Schedule:Compact";
         MaxNums1 = 0;
-        for (LoopIndex = 1; LoopIndex <= NumCptSchedules; ++LoopIndex) {
-            inputProcessor->getObjectItem(CurrentModuleObject, LoopIndex, Alphas, NumAlphas, Numbers, NumNumbers, Status);
+        // Only the data fields are needed here, so read them in place rather than copying every object out with getObjectItem
+        for (auto const &compactSchedule : inputProcessor->getObjectViews(CurrentModuleObject)) {
             // # 'THROUGH" => Number of additional week schedules
             // # 'FOR' => Number of additional day schedules
-            for (Count = 3; Count <= NumAlphas; ++Count) {
-                if (has_prefix(Alphas(Count), "THROUGH")) ++AddWeekSch;
-                if (has_prefix(Alphas(Count), "FOR")) ++AddDaySch;
-                if (has_prefix(Alphas(Count), "UNTIL")) ++MaxNums1;
+            for (std::size_t group = 1; group <= compactSchedule.numExtensibleGroups(); ++group) {
+                auto const dataField = compactSchedule.extensibleGroup(group);
+                if (dataField.isBlank("field")) continue;
+                std::string const &field = dataField.alpha("field");
+                if (has_prefixi(field, "THROUGH")) ++AddWeekSch;
+                if (has_prefixi(field, "FOR")) ++AddDaySch;
+                if (has_prefixi(field, "UNTIL")) ++MaxNums1;
             }
         }
         if (MaxNums1 > MaxNums) {
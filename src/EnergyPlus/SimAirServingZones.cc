@@ -48,6 +48,7 @@
 // C++ Headers
 #include <algorithm>
 #include <cmath>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -73,6 +74,7 @@
 #include <DataHVACGlobals.hh>
 #include <DataHeatBalance.hh>
 #include <DataLoopNode.hh>
+#include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
 #include <DataSystemVariables.hh>
@@ -105,8 +107,10 @@
 #include <OutAirNodeManager.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
+#include <PlantUtilities.hh>
 #include <Psychrometrics.hh>
 #include <ReportSizingManager.hh>
+#include <SetPointManager.hh>
 #include <SimAirServingZones.hh>
 #include <SizingManager.hh>
 #include <SplitterComponent.hh>
@@ -2979,6 +2983,14 @@ namespace SimAirServingZones {
         SimAirLoopComponents(AirLoopNum, FirstHVACIteration);
         IsUpToDateFlag = true;
 
+        if (!PrimaryAirSystem(AirLoopNum).ControllerResimCompiled) CompileControllerResimulation(AirLoopNum);
+
+        // Optionally solve the interacting controllers together first so that the loop below starts
+        // from a consistent set of actuated flows (COUPLED_AIRLOOP_CONTROLLERS=YES)
+        if (DataSystemVariables::CoupledAirLoopControllersEnvFlag) {
+            SolveAirLoopControllersCoupled(FirstHVACIteration, AirLoopNum, NumCalls);
+        }
+
         // Loop over the air sys controllers until convergence or MaxIter iterations
         for (int AirLoopControlNum = 1; AirLoopControlNum <= PrimaryAirSystem(AirLoopNum).NumControllers; ++AirLoopControlNum) {
 
@@ -3047,7 +3059,8 @@ namespace SimAirServingZones {
                     // this call to SimAirLoopComponents will simulate the OA system and set the PrimaryAirSystem( AirLoopNum ).ControlConverged(
                     // AirLoopControlNum ) flag for controllers of water coils in the OA system for controllers not in the OA system, this flag is set
                     // above in this function
-                    SimAirLoopComponents(AirLoopNum, FirstHVACIteration);
+                    // components upstream of this controller's actuated coil see unchanged inputs, so start at the coil when that is known
+                    SimAirLoopComponents(AirLoopNum, FirstHVACIteration, GetControllerResimCompNum(AirLoopNum, AirLoopControlNum));
                     // pass convergence flag from OA system water coils (i.e., SolveWaterCoilController) back to this loop
                     // for future reference, the PrimaryAirSystem().ControlConverged flag is set while managing OA system water coils.
                     // If convergence is not achieved with OA system water coils, suspect how this flag is passed back here or why OA system coils do
@@ -3094,6 +3107,275 @@ namespace SimAirServingZones {
         }
     }
 
+    void SolveAirLoopControllersCoupled(bool const FirstHVACIteration, int const AirLoopNum, int &NumCalls)
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Predictor for SolveAirLoopControllers that solves the water coil controllers of an air loop as one
+        // small nonlinear system instead of one controller at a time. Interacting controllers (e.g., cooling
+        // coil temperature control followed by a reheat coil, or a humidity ratio controller on the same coil
+        // train) otherwise need several air loop passes before they agree. Only used when the environment
+        // variable COUPLED_AIRLOOP_CONTROLLERS=YES is defined.
+
+        // METHODOLOGY EMPLOYED:
+        // The unknowns are the actuated mass flow rates of the participating controllers, bounded by their
+        // currently available min/max actuated values. The residuals are (sensed - setpoint)/offset, so a
+        // residual within +/-1 satisfies that controller's tolerance. Damped Newton steps are computed with a
+        // forward difference Jacobian (one air loop simulation per controller) and a halving line search on
+        // the residual norm. Controllers pinned at a bound with the step pointing outside are held there.
+        // The initial guess is the converged solution saved by SaveSimpleController at the previous call,
+        // or mid-range if there is none. On exit the air loop has been simulated with the best point found;
+        // the regular controller iterations then reuse it as their first iterate and still decide convergence.
+        // Controllers in the OA system, with dual temperature and humidity ratio control, with a SAT sensor
+        // fault, locked out by the economizer or sensing no air flow are left to the regular iterations.
+
+        // Using/Aliasing
+        using DataHVACControllers::iModeActive;
+        using HVACControllers::ControllerProps;
+        using PlantUtilities::SetActuatedBranchFlowRate;
+
+        // SUBROUTINE LOCAL VARIABLE DEFINITIONS
+        auto &thisPrimaryAirSys(PrimaryAirSystem(AirLoopNum));
+        std::vector<int> ControlNums; // participating controllers (index into ControllerProps)
+        std::vector<Real64> SetPoint;
+        std::vector<Real64> XMin;
+        std::vector<Real64> XMax;
+
+        for (int AirLoopControlNum = 1; AirLoopControlNum <= thisPrimaryAirSys.NumControllers; ++AirLoopControlNum) {
+            int const ControlNum = thisPrimaryAirSys.ControllerIndex(AirLoopControlNum);
+            if (ControlNum == 0) continue;
+            auto const &thisController(ControllerProps(ControlNum));
+            if (thisController.BypassControllerCalc || thisController.FaultyCoilSATFlag) continue;
+            if (thisController.ActuatorVar != HVACControllers::iFlow || thisController.Offset <= 0.0) continue;
+            if (thisController.ActuatedNodePlantLoopNum == 0) continue;
+            if (DataPlant::PlantLoop(thisController.ActuatedNodePlantLoopNum).LoopSide(thisController.ActuatedNodePlantLoopSide).FlowLock ==
+                DataPlant::FlowLocked)
+                continue;
+            if (AirLoopControlInfo(AirLoopNum).EconoActive && thisPrimaryAirSys.CanBeLockedOutByEcono(AirLoopControlNum)) continue;
+            if (Node(thisController.SensedNode).MassFlowRate == 0.0) continue;
+
+            Real64 SetPointValue;
+            if (thisController.ControlVar == HVACControllers::iTemperature) {
+                SetPointValue = Node(thisController.SensedNode).TempSetPoint;
+            } else if (thisController.ControlVar == HVACControllers::iHumidityRatio) {
+                if (thisController.HumRatCntrlType == SetPointManager::iCtrlVarType_MaxHumRat) {
+                    SetPointValue = Node(thisController.SensedNode).HumRatMax;
+                } else {
+                    SetPointValue = Node(thisController.SensedNode).HumRatSetPoint;
+                }
+            } else if (thisController.ControlVar == HVACControllers::iFlow) {
+                SetPointValue = Node(thisController.SensedNode).MassFlowRateSetPoint;
+            } else {
+                continue;
+            }
+
+            // same bounds as InitController
+            Real64 const MaxAvail = min(Node(thisController.ActuatedNode).MassFlowRateMaxAvail, thisController.MaxActuated);
+            Real64 const MinAvail = min(max(Node(thisController.ActuatedNode).MassFlowRateMinAvail, thisController.MinActuated), MaxAvail);
+            if (MaxAvail <= MinAvail) continue;
+
+            ControlNums.push_back(ControlNum);
+            SetPoint.push_back(SetPointValue);
+            XMin.push_back(MinAvail);
+            XMax.push_back(MaxAvail);
+        }
+
+        // Nothing to couple
+        int const NumCtrls = static_cast<int>(ControlNums.size());
+        if (NumCtrls < 2) return;
+
+        // Simulate the air loop at X and return the scaled residuals in R and their squared norm
+        auto Evaluate = [&](std::vector<Real64> const &X, std::vector<Real64> &R) -> Real64 {
+            for (int i = 0; i < NumCtrls; ++i) {
+                auto const &thisController(ControllerProps(ControlNums[i]));
+                Real64 ActuatedFlow = X[i];
+                SetActuatedBranchFlowRate(ActuatedFlow,
+                                          thisController.ActuatedNode,
+                                          thisController.ActuatedNodePlantLoopNum,
+                                          thisController.ActuatedNodePlantLoopSide,
+                                          thisController.ActuatedNodePlantLoopBranchNum,
+                                          false);
+            }
+            ++NumCalls;
+            SimAirLoopComponents(AirLoopNum, FirstHVACIteration);
+            Real64 Norm = 0.0;
+            for (int i = 0; i < NumCtrls; ++i) {
+                auto const &thisController(ControllerProps(ControlNums[i]));
+                Real64 SensedValue;
+                if (thisController.ControlVar == HVACControllers::iTemperature) {
+                    SensedValue = Node(thisController.SensedNode).Temp;
+                } else if (thisController.ControlVar == HVACControllers::iHumidityRatio) {
+                    SensedValue = Node(thisController.SensedNode).HumRat;
+                } else {
+                    SensedValue = Node(thisController.SensedNode).MassFlowRate;
+                }
+                R[i] = (SensedValue - SetPoint[i]) / thisController.Offset;
+                Norm += R[i] * R[i];
+            }
+            return Norm;
+        };
+
+        // Warm start from the solution saved at the previous call
+        int const PreviousSolutionIndex = FirstHVACIteration ? 1 : 2;
+        std::vector<Real64> X(NumCtrls);
+        for (int i = 0; i < NumCtrls; ++i) {
+            auto const &thisTracker(ControllerProps(ControlNums[i]).SolutionTrackers(PreviousSolutionIndex));
+            if (thisTracker.DefinedFlag && thisTracker.Mode == iModeActive) {
+                X[i] = min(max(thisTracker.ActuatedValue, XMin[i]), XMax[i]);
+            } else {
+                X[i] = 0.5 * (XMin[i] + XMax[i]);
+            }
+        }
+
+        int Iter = 0;
+        bool const ConvergedFlag = SolveCoupledControllerResiduals(Evaluate, XMin, XMax, X, Iter);
+
+        if (DataSystemVariables::TrackAirLoopEnvFlag) {
+            HVACControllers::TrackCoupledAirLoopControllers(AirLoopNum, ConvergedFlag, Iter);
+        }
+    }
+
+    bool SolveCoupledControllerResiduals(std::function<Real64(std::vector<Real64> const &, std::vector<Real64> &)> const &Evaluate,
+                                         std::vector<Real64> const &XMin,
+                                         std::vector<Real64> const &XMax,
+                                         std::vector<Real64> &X,
+                                         int &Iter)
+    {
+
+        // PURPOSE OF THIS FUNCTION:
+        // Damped Newton iteration of SolveAirLoopControllersCoupled. Evaluate sets the actuated values X,
+        // simulates and returns the scaled residuals in R and their squared norm; a residual within +/-1
+        // satisfies that controller's tolerance. X holds the initial guess on entry and the best point found on
+        // exit, which is also the point of the last evaluation. Returns true when all residuals are within
+        // tolerance, or all controllers that are not held at a bound are.
+
+        // SUBROUTINE PARAMETER DEFINITIONS:
+        int const MaxNewtonIter(5);     // Maximum number of Newton iterations
+        int const MaxLineSearch(3);     // Maximum number of step halvings per Newton iteration
+        Real64 const FDStepFrac(1.0e-3); // Forward difference step as a fraction of the actuated range
+
+        int const NumCtrls = static_cast<int>(X.size());
+        std::vector<Real64> R(NumCtrls);
+        std::vector<Real64> RTrial(NumCtrls);
+        std::vector<Real64> XTrial(NumCtrls);
+        std::vector<Real64> Jac(NumCtrls * NumCtrls); // row major, Jac[i * NumCtrls + j] = dR_i/dX_j
+        std::vector<Real64> DX(NumCtrls);
+        std::vector<bool> Free(NumCtrls);
+        Real64 Norm = Evaluate(X, R);
+        bool LoopAtX = true; // true when the last air loop simulation was done at X
+        bool ConvergedFlag = false;
+        Iter = 0;
+
+        while (true) {
+            ConvergedFlag = true;
+            for (int i = 0; i < NumCtrls; ++i) {
+                if (std::abs(R[i]) > 1.0) ConvergedFlag = false;
+            }
+            if (ConvergedFlag || Iter >= MaxNewtonIter) break;
+            ++Iter;
+
+            // Forward difference Jacobian, stepping away from the nearest bound
+            for (int j = 0; j < NumCtrls; ++j) {
+                Real64 Step = FDStepFrac * (XMax[j] - XMin[j]);
+                if (X[j] + Step > XMax[j]) Step = -Step;
+                XTrial = X;
+                XTrial[j] += Step;
+                Evaluate(XTrial, RTrial);
+                for (int i = 0; i < NumCtrls; ++i) {
+                    Jac[i * NumCtrls + j] = (RTrial[i] - R[i]) / Step;
+                }
+            }
+            LoopAtX = false;
+
+            // Hold controllers at a bound when their own correction points outside the range
+            bool AnyFree = false;
+            bool FreeConvergedFlag = true;
+            for (int i = 0; i < NumCtrls; ++i) {
+                Real64 const Diag = Jac[i * NumCtrls + i];
+                Real64 const OwnStep = (Diag != 0.0) ? -R[i] / Diag : 0.0;
+                Free[i] = !((X[i] <= XMin[i] && OwnStep <= 0.0) || (X[i] >= XMax[i] && OwnStep >= 0.0));
+                if (Free[i]) {
+                    AnyFree = true;
+                    if (std::abs(R[i]) > 1.0) FreeConvergedFlag = false;
+                }
+            }
+            if (!AnyFree || FreeConvergedFlag) {
+                ConvergedFlag = FreeConvergedFlag;
+                break;
+            }
+
+            // Solve Jac_FF * DX_F = -R_F by Gaussian elimination with partial pivoting
+            std::vector<int> Idx;
+            for (int i = 0; i < NumCtrls; ++i) {
+                if (Free[i]) Idx.push_back(i);
+            }
+            int const NumFree = static_cast<int>(Idx.size());
+            std::vector<Real64> A(NumFree * (NumFree + 1));
+            for (int r = 0; r < NumFree; ++r) {
+                for (int c = 0; c < NumFree; ++c) {
+                    A[r * (NumFree + 1) + c] = Jac[Idx[r] * NumCtrls + Idx[c]];
+                }
+                A[r * (NumFree + 1) + NumFree] = -R[Idx[r]];
+            }
+            bool SingularFlag = false;
+            for (int k = 0; k < NumFree && !SingularFlag; ++k) {
+                int Pivot = k;
+                for (int r = k + 1; r < NumFree; ++r) {
+                    if (std::abs(A[r * (NumFree + 1) + k]) > std::abs(A[Pivot * (NumFree + 1) + k])) Pivot = r;
+                }
+                if (A[Pivot * (NumFree + 1) + k] == 0.0) {
+                    SingularFlag = true;
+                    break;
+                }
+                if (Pivot != k) {
+                    for (int c = 0; c <= NumFree; ++c) {
+                        std::swap(A[k * (NumFree + 1) + c], A[Pivot * (NumFree + 1) + c]);
+                    }
+                }
+                for (int r = k + 1; r < NumFree; ++r) {
+                    Real64 const Factor = A[r * (NumFree + 1) + k] / A[k * (NumFree + 1) + k];
+                    for (int c = k; c <= NumFree; ++c) {
+                        A[r * (NumFree + 1) + c] -= Factor * A[k * (NumFree + 1) + c];
+                    }
+                }
+            }
+            if (SingularFlag) break;
+            std::fill(DX.begin(), DX.end(), 0.0);
+            for (int k = NumFree - 1; k >= 0; --k) {
+                Real64 Sum = A[k * (NumFree + 1) + NumFree];
+                for (int c = k + 1; c < NumFree; ++c) {
+                    Sum -= A[k * (NumFree + 1) + c] * DX[Idx[c]];
+                }
+                DX[Idx[k]] = Sum / A[k * (NumFree + 1) + k];
+            }
+
+            // Damped step, projected onto the bounds
+            bool AcceptedFlag = false;
+            Real64 Alpha = 1.0;
+            for (int LineSearch = 0; LineSearch <= MaxLineSearch; ++LineSearch) {
+                for (int i = 0; i < NumCtrls; ++i) {
+                    XTrial[i] = min(max(X[i] + Alpha * DX[i], XMin[i]), XMax[i]);
+                }
+                Real64 const TrialNorm = Evaluate(XTrial, RTrial);
+                if (TrialNorm < Norm) {
+                    X = XTrial;
+                    R = RTrial;
+                    Norm = TrialNorm;
+                    LoopAtX = true;
+                    AcceptedFlag = true;
+                    break;
+                }
+                Alpha *= 0.5;
+            }
+            if (!AcceptedFlag) break;
+        }
+
+        // Leave the last evaluation (the air loop simulation) at the best point found
+        if (!LoopAtX) Evaluate(X, R);
+
+        return ConvergedFlag;
+    }
+
     void SolveWaterCoilController(bool const FirstHVACIteration,
                                   int const AirLoopNum,
                                   std::string const &CompName,
@@ -3419,8 +3701,9 @@ namespace SimAirServingZones {
         } // end of controller loop
     }
 
-    void SimAirLoopComponents(int const AirLoopNum,         // Index of the air loop being currently simulated
-                              bool const FirstHVACIteration // TRUE if first full HVAC iteration in an HVAC timestep
+    void SimAirLoopComponents(int const AirLoopNum,          // Index of the air loop being currently simulated
+                              bool const FirstHVACIteration, // TRUE if first full HVAC iteration in an HVAC timestep
+                              int const FirstCompNum         // first main branch component to simulate (single branch air loops only)
     )
     {
         // SUBROUTINE INFORMATION
@@ -3442,6 +3725,8 @@ namespace SimAirServingZones {
         // Sets current branch number to CurBranchNum defined in MODULE DataSizing
         // Sets duct type of current branch to CurDuctType defined in MODULE DataSizing
         // Upon exiting, resets both counters to 0.
+        // FirstCompNum > 1 skips the leading components of a single branch air loop whose
+        // inputs are known to be unchanged since they were last simulated (see CompileControllerResimulation).
 
         // REFERENCES: None
 
@@ -3471,11 +3756,17 @@ namespace SimAirServingZones {
             CurDuctType = PrimaryAirSystem(AirLoopNum).Branch(BranchNum).DuctType;
 
             // Loop over components in branch
-            for (CompNum = 1; CompNum <= PrimaryAirSystem(AirLoopNum).Branch(BranchNum).TotalComponents; ++CompNum) {
+            for (CompNum = (BranchNum == 1) ? FirstCompNum : 1; CompNum <= PrimaryAirSystem(AirLoopNum).Branch(BranchNum).TotalComponents;
+                 ++CompNum) {
                 // CompType = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).TypeOf;
                 // CompName = PrimaryAirSystem( AirLoopNum ).Branch( BranchNum ).Comp( CompNum ).Name;
                 CompType_Num = PrimaryAirSystem(AirLoopNum).Branch(BranchNum).Comp(CompNum).CompType_Num;
 
+                // remember what the OA system saw, it is only skipped on a partial resimulation if this is unchanged
+                if (CompType_Num == OAMixer_Num) {
+                    PrimaryAirSystem(AirLoopNum).OASysHeatingActiveFlag = AirLoopControlInfo(AirLoopNum).HeatingActiveFlag;
+                }
+
                 // Simulate each component on PrimaryAirSystem(AirLoopNum)%Branch(BranchNum)%Name
                 SimAirLoopComponent(PrimaryAirSystem(AirLoopNum).Branch(BranchNum).Comp(CompNum).Name,
                                     CompType_Num,
@@ -3494,6 +3785,118 @@ namespace SimAirServingZones {
         CurDuctType = 0;
     }
 
+    void CompileControllerResimulation(int const AirLoopNum)
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // For each controller on the air loop, find the first main branch component whose inputs change
+        // when the controller moves its actuator, so that SolveAirLoopControllers only resimulates the
+        // air loop from that component onward while iterating the controller.
+
+        // METHODOLOGY EMPLOYED:
+        // Only air loops with a single branch (no splitter, mixer or return air bypass) made up of components
+        // that read nothing but their own nodes and the air loop state set before the controllers are solved
+        // (OA system, fans, ducts, water/steam coils and stand-alone heating coils) qualify. An OA system must
+        // not contain water coil controllers or components other than the mixer, fans, heating coils and heat exchangers.
+        // The actuated coil is the water coil whose inlet node, or plant branch, is the controller's actuated one;
+        // the earliest such coil on the branch is used. Anything else keeps ControllerResimCompNum = 0, which
+        // resimulates the whole air loop as before. Component indices are filled in by the first simulation
+        // so this is retried until they are all known.
+
+        auto &thisPrimaryAirSys(PrimaryAirSystem(AirLoopNum));
+
+        thisPrimaryAirSys.ControllerResimCompNum.dimension(thisPrimaryAirSys.NumControllers, 0);
+        thisPrimaryAirSys.ResimOASysCompNum = 0;
+
+        if (thisPrimaryAirSys.NumBranches != 1 || thisPrimaryAirSys.Splitter.Exists || thisPrimaryAirSys.Mixer.Exists) {
+            thisPrimaryAirSys.ControllerResimCompiled = true;
+            return;
+        }
+
+        auto const &thisBranch(thisPrimaryAirSys.Branch(1));
+        int OASysCompNum = 0;
+        for (int CompNum = 1; CompNum <= thisBranch.TotalComponents; ++CompNum) {
+            auto const &thisComp(thisBranch.Comp(CompNum));
+            int const CompType_Num = thisComp.CompType_Num;
+            if (CompType_Num == OAMixer_Num) {
+                if (thisComp.CompIndex == 0) return; // not simulated yet
+                auto const &thisOASys(OutsideAirSys(thisComp.CompIndex));
+                bool Eligible = (thisOASys.NumSimpleControllers == 0);
+                for (int OACompNum = 1; Eligible && OACompNum <= thisOASys.NumComponents; ++OACompNum) {
+                    int const OACompType_Num = thisOASys.ComponentType_Num(OACompNum);
+                    Eligible = (OACompType_Num == MixedAir::OAMixer_Num || OACompType_Num == MixedAir::Fan_Simple_CV || OACompType_Num == MixedAir::Fan_Simple_VAV ||
+                                OACompType_Num == MixedAir::Fan_System_Object || OACompType_Num == MixedAir::Fan_ComponentModel ||
+                                OACompType_Num == MixedAir::Coil_ElectricHeat || OACompType_Num == MixedAir::Coil_GasHeat ||
+                                OACompType_Num == MixedAir::HeatXchngr);
+                }
+                if (!Eligible) {
+                    thisPrimaryAirSys.ControllerResimCompiled = true;
+                    return;
+                }
+                OASysCompNum = CompNum;
+            } else if (CompType_Num == WaterCoil_SimpleCool || CompType_Num == WaterCoil_Cooling || CompType_Num == WaterCoil_SimpleHeat ||
+                       CompType_Num == WaterCoil_DetailedCool) {
+                if (thisComp.CompIndex == 0) return; // not simulated yet
+            } else if (CompType_Num != Fan_Simple_CV && CompType_Num != Fan_Simple_VAV && CompType_Num != Fan_System_Object &&
+                       CompType_Num != Fan_ComponentModel && CompType_Num != SteamCoil_AirHeat && CompType_Num != Coil_ElectricHeat &&
+                       CompType_Num != Coil_GasHeat && CompType_Num != Duct) {
+                thisPrimaryAirSys.ControllerResimCompiled = true;
+                return;
+            }
+        }
+
+        for (int AirLoopControlNum = 1; AirLoopControlNum <= thisPrimaryAirSys.NumControllers; ++AirLoopControlNum) {
+            int const ControllerIndex = thisPrimaryAirSys.ControllerIndex(AirLoopControlNum);
+            if (ControllerIndex == 0) return; // not simulated yet
+            auto const &thisController(HVACControllers::ControllerProps(ControllerIndex));
+            for (int CompNum = 1; CompNum <= thisBranch.TotalComponents; ++CompNum) {
+                int const CompType_Num = thisBranch.Comp(CompNum).CompType_Num;
+                if (CompType_Num != WaterCoil_SimpleCool && CompType_Num != WaterCoil_Cooling && CompType_Num != WaterCoil_SimpleHeat &&
+                    CompType_Num != WaterCoil_DetailedCool)
+                    continue;
+                auto const &thisCoil(WaterCoils::WaterCoil(thisBranch.Comp(CompNum).CompIndex));
+                bool const SamePlantBranch = (thisController.ActuatedNodePlantLoopNum > 0 &&
+                                              thisCoil.WaterLoopNum == thisController.ActuatedNodePlantLoopNum &&
+                                              thisCoil.WaterLoopSide == thisController.ActuatedNodePlantLoopSide &&
+                                              thisCoil.WaterLoopBranchNum == thisController.ActuatedNodePlantLoopBranchNum);
+                if (thisCoil.WaterInletNodeNum == thisController.ActuatedNode || SamePlantBranch) {
+                    thisPrimaryAirSys.ControllerResimCompNum(AirLoopControlNum) = CompNum;
+                    break;
+                }
+            }
+        }
+
+        thisPrimaryAirSys.ResimOASysCompNum = OASysCompNum;
+        thisPrimaryAirSys.ControllerResimCompiled = true;
+    }
+
+    int GetControllerResimCompNum(int const AirLoopNum, int const AirLoopControlNum)
+    {
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns the first main branch component to resimulate after the given controller has moved its
+        // actuator, or 1 when the whole air loop has to be simulated.
+
+        // METHODOLOGY EMPLOYED:
+        // Uses the positions found by CompileControllerResimulation. An upstream OA system reads the air loop
+        // HeatingActiveFlag, which downstream heating coils can set during the iteration, and its heat recovery
+        // lockout logic is not repeatable, so it is only skipped when the economizer cannot be locked out with
+        // heating and the flag is the one it saw when it was last simulated.
+
+        auto const &thisPrimaryAirSys(PrimaryAirSystem(AirLoopNum));
+        if (!thisPrimaryAirSys.ControllerResimCompiled || thisPrimaryAirSys.ControllerResimCompNum(AirLoopControlNum) == 0) return 1;
+
+        int const FirstCompNum = thisPrimaryAirSys.ControllerResimCompNum(AirLoopControlNum);
+        if (thisPrimaryAirSys.ResimOASysCompNum > 0 && thisPrimaryAirSys.ResimOASysCompNum < FirstCompNum) {
+            auto const &thisAirLoopControlInfo(AirLoopControlInfo(AirLoopNum));
+            if (thisAirLoopControlInfo.CanLockoutEconoWithHeating ||
+                thisAirLoopControlInfo.HeatingActiveFlag != thisPrimaryAirSys.OASysHeatingActiveFlag) {
+                return 1;
+            }
+        }
+        return FirstCompNum;
+    }
+
     void SimAirLoopComponent(std::string const &CompName,            // the component Name
                              int const CompType_Num,                 // numeric equivalent for component type
                              bool const FirstHVACIteration,          // TRUE if first full HVAC iteration in an HVAC timestep
@@ -49,7 +49,9 @@
 #define SimAirServingZones_hh_INCLUDED
 
 // C++ Headers
+#include <functional>
 #include <string>
+#include <vector>
 
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
@@ -150,6 +152,14 @@ namespace SimAirServingZones {
     void SolveAirLoopControllers(
         bool const FirstHVACIteration, int const AirLoopNum, bool &AirLoopConvergedFlag, int &IterMax, int &IterTot, int &NumCalls);
 
+    void SolveAirLoopControllersCoupled(bool const FirstHVACIteration, int const AirLoopNum, int &NumCalls);
+
+    bool SolveCoupledControllerResiduals(std::function<Real64(std::vector<Real64> const &, std::vector<Real64> &)> const &Evaluate,
+                                         std::vector<Real64> const &XMin,
+                                         std::vector<Real64> const &XMax,
+                                         std::vector<Real64> &X,
+                                         int &Iter);
+
     void SolveWaterCoilController(bool const FirstHVACIteration,
                                   int const AirLoopNum,
                                   std::string const &CompName,
@@ -161,10 +171,15 @@ namespace SimAirServingZones {
     void ReSolveAirLoopControllers(
         bool const FirstHVACIteration, int const AirLoopNum, bool &AirLoopConvergedFlag, int &IterMax, int &IterTot, int &NumCalls);
 
-    void SimAirLoopComponents(int const AirLoopNum,         // Index of the air loop being currently simulated
-                              bool const FirstHVACIteration // TRUE if first full HVAC iteration in an HVAC timestep
+    void SimAirLoopComponents(int const AirLoopNum,          // Index of the air loop being currently simulated
+                              bool const FirstHVACIteration, // TRUE if first full HVAC iteration in an HVAC timestep
+                              int const FirstCompNum = 1     // first main branch component to simulate (single branch air loops only)
     );
 
+    void CompileControllerResimulation(int const AirLoopNum);
+
+    int GetControllerResimCompNum(int const AirLoopNum, int const AirLoopControlNum);
+
     void SimAirLoopComponent(std::string const &CompName,   // the component Name
                              int const CompType_Num,        // numeric equivalent for component type
                              bool const FirstHVACIteration, // TRUE if first full HVAC iteration in an HVAC timestep
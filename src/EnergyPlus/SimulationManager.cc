@@ -111,6 +111,7 @@ extern "C" {
 #include <HeatBalanceAirManager.hh>
 #include <HeatBalanceManager.hh>
 #include <HeatBalanceSurfaceManager.hh>
+#include <HeatRejectionMemo.hh>
 #include <InputProcessing/InputProcessor.hh>
 #include <MixedAir.hh>
 #include <NodeInputManager.hh>
@@ -134,6 +135,7 @@ extern "C" {
 #include <SurfaceGeometry.hh>
 #include <SystemReports.hh>
 #include <Timer.h>
+#include <TimestepCheckpoint.hh>
 #include <UtilityRoutines.hh>
 #include <Vectors.hh>
 #include <WeatherManager.hh>
@@ -441,7 +443,7 @@ namespace SimulationManager {
             bool anyEMSRan;
             ManageEMS(emsCallFromSetupSimulation, anyEMSRan); // point to finish setup processing EMS, sensor ready now
 
-            ProduceRDDMDD();
+            TimeOutputSink("rdd and mdd dictionaries", []() { ProduceRDDMDD(); });
 
             if (TerminalError) {
                 ShowFatalError("Previous Conditions cause program termination.");
@@ -659,31 +661,39 @@ namespace SimulationManager {
 
         ReportForTabularReports(); // For Energy Meters (could have other things that need to be pushed to after simulation)
 
-        OpenOutputTabularFile();
+        // The remaining outputs share the gio unit table, the error reporting and the SQLite connection, so they are
+        // written one after another (each timed) rather than alongside the JSON reports in WriteEndOfRunReports
+        TimeOutputSink("tabular reports", []() {
+            OpenOutputTabularFile();
 
-        WriteTabularReports(); //     Create the tabular reports at completion of each
+            WriteTabularReports(); //     Create the tabular reports at completion of each
 
-        WriteTabularTariffReports();
+            WriteTabularTariffReports();
 
-        ComputeLifeCycleCostAndReport(); // must be after WriteTabularReports and WriteTabularTariffReports
+            ComputeLifeCycleCostAndReport(); // must be after WriteTabularReports and WriteTabularTariffReports
 
-        CloseOutputTabularFile();
+            CloseOutputTabularFile();
+        });
 
         DumpAirLoopStatistics(); // Dump runtime statistics for air loop controller simulation to csv file
 
+        HeatRejectionMemo::ReportMemoStatistics(); // Write heat rejection model memo hit rates to the eio file if requested
+
 #ifdef EP_Detailed_Timings
         epStopTime("Closeout Reporting=");
 #endif
-        CloseOutputFiles();
+        TimeOutputSink("eio, eso and mtr files", []() { CloseOutputFiles(); });
 
-        // sqlite->createZoneExtendedOutput();
-        CreateSQLiteZoneExtendedOutput();
+        TimeOutputSink("SQLite output", []() {
+            // sqlite->createZoneExtendedOutput();
+            CreateSQLiteZoneExtendedOutput();
 
-        if (sqlite) {
-            DisplayString("Writing final SQL reports");
-            sqlite->sqliteCommit();      // final transactions
-            sqlite->initializeIndexes(); // do not create indexes (SQL) until all is done.
-        }
+            if (sqlite) {
+                DisplayString("Writing final SQL reports");
+                sqlite->sqliteCommit();      // final transactions
+                sqlite->initializeIndexes(); // do not create indexes (SQL) until all is done.
+            }
+        });
 
         if (ErrorsFound) {
             ShowFatalError("Error condition occurred.  Previous Severe Errors cause termination.");
@@ -3006,7 +3016,9 @@ void Resimulate(bool &ResimExt, // Flag to resimulate the exterior energy use si
 
     if (ResimHB) {
         // Surface simulation
+        TimestepCheckpoint::Resimulating = true;
         InitSurfaceHeatBalance();
+        TimestepCheckpoint::Resimulating = false;
         HeatBalanceSurfaceManager::CalcHeatBalanceOutsideSurf();
         HeatBalanceSurfaceManager::CalcHeatBalanceInsideSurf();
 
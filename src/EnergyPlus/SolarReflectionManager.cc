@@ -46,6 +46,7 @@
 // POSSIBILITY OF SUCH DAMAGE.
 
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 
@@ -59,11 +60,13 @@
 #include <DataSurfaces.hh>
 #include <DataSystemVariables.hh>
 #include <DataVectorTypes.hh>
+#include <DaylightingManager.hh>
 #include <DisplayRoutines.hh>
 #include <General.hh>
 #include <PierceSurface.hh>
 #include <ScheduleManager.hh>
 #include <SolarReflectionManager.hh>
+#include <SurfaceOctree.hh>
 #include <Vectors.hh>
 
 namespace EnergyPlus {
@@ -105,12 +108,41 @@ namespace SolarReflectionManager {
     int TotSolReflRecSurf(0); // Total number of exterior surfaces that can receive reflected solar
     int TotPhiReflRays(0);    // Number of rays in altitude angle (-90 to 90 deg) for diffuse refl calc
     int TotThetaReflRays(0);  // Number of rays in azimuth angle (0 to 180 deg) for diffuse refl calc
+    bool UseSurfaceOctree(false); // True if ray-obstruction searches use the surface octree
+    std::vector<int> NonOctreeSurfNums; // Surfaces not held by the surface octree (always tested directly)
 
     // SUBROUTINE SPECIFICATIONS FOR MODULE ExteriorSolarReflectionManager
 
     // Object Data
     Array1D<SolReflRecSurfData> SolReflRecSurf;
 
+    // Functions
+
+    // Surface number of a surface held by the surface octree
+    inline int OctreeSurfNum(SurfaceData const &surface)
+    {
+        return static_cast<int>(&surface - &Surface(1)) + 1;
+    }
+
+    // Returns true if ObsHit is true for any surface that the ray from RayOrigin along the unit vector RayVec
+    // could intersect. All surfaces are tried in surface number order for small models; otherwise only the
+    // surfaces in octree cubes that the ray passes through (plus those the octree does not hold) are tried.
+    template <typename Predicate> bool AnyObstructionHit(Vector3<Real64> const &RayOrigin, Vector3<Real64> const &RayVec, Predicate const &ObsHit)
+    {
+        if (!UseSurfaceOctree) {
+            for (int ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum) {
+                if (ObsHit(ObsSurfNum)) return true;
+            }
+            return false;
+        }
+        for (int const ObsSurfNum : NonOctreeSurfNums) {
+            if (ObsHit(ObsSurfNum)) return true;
+        }
+        Vector3<Real64> const RayVec_inv(SurfaceOctreeCube::safe_inverse(RayVec));
+        return surfaceOctree.hasSurfaceRayIntersectsCube(
+            RayOrigin, RayVec, RayVec_inv, [&](SurfaceData const &surface) { return ObsHit(OctreeSurfNum(surface)); });
+    }
+
     // MODULE SUBROUTINES:
 
     // Functions
@@ -260,6 +292,15 @@ namespace SolarReflectionManager {
 
         SolReflRecSurf.allocate(TotSolReflRecSurf);
 
+        // Use the surface octree (set up in HeatBalanceManager for large models) to find ray-obstruction candidates
+        UseSurfaceOctree = (TotSurfaces >= DaylightingManager::octreeCrossover) && (surfaceOctree.surfaces_size() + surfaceOctree.nChildren() > 0);
+        NonOctreeSurfNums.clear();
+        if (UseSurfaceOctree) {
+            for (int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+                if (Surface(SurfNum).Vertex.size() < 3 || Surface(SurfNum).IsTransparent) NonOctreeSurfNums.push_back(SurfNum);
+            }
+        }
+
         ReflFacBmToDiffSolObs.dimension(24, TotSurfaces, 0.0);
         ReflFacBmToDiffSolGnd.dimension(24, TotSurfaces, 0.0);
         ReflFacBmToBmSolObs.dimension(24, TotSurfaces, 0.0);
@@ -308,9 +349,11 @@ namespace SolarReflectionManager {
             SolReflRecSurf(RecSurfNum).HitPtSolRefl.dimension(MaxReflRays, MaxRecPts, 0.0);
             SolReflRecSurf(RecSurfNum).RecPtHitPtDis.dimension(MaxReflRays, MaxRecPts, 0.0);
             SolReflRecSurf(RecSurfNum).HitPtNormVec.dimension(MaxReflRays, MaxRecPts, zero3);
-            SolReflRecSurf(RecSurfNum).PossibleObsSurfNums.dimension(TotSurfaces, 0);
         }
 
+        // Possible obstructions are gathered in a work array and then stored per receiving surface at their actual count
+        Array1D_int PossibleObsSurfNums(TotSurfaces, 0);
+
         for (RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum) {
             SurfNum = SolReflRecSurf(RecSurfNum).SurfNum;
             // Outward norm to receiving surface
@@ -364,7 +407,11 @@ namespace SolarReflectionManager {
 
                 // This is a possible obstructing surface for this receiving surface
                 ++SolReflRecSurf(RecSurfNum).NumPossibleObs;
-                SolReflRecSurf(RecSurfNum).PossibleObsSurfNums(SolReflRecSurf(RecSurfNum).NumPossibleObs) = ObsSurfNum;
+                PossibleObsSurfNums(SolReflRecSurf(RecSurfNum).NumPossibleObs) = ObsSurfNum;
+            }
+            SolReflRecSurf(RecSurfNum).PossibleObsSurfNums.dimension(SolReflRecSurf(RecSurfNum).NumPossibleObs);
+            for (loop = 1; loop <= SolReflRecSurf(RecSurfNum).NumPossibleObs; ++loop) {
+                SolReflRecSurf(RecSurfNum).PossibleObsSurfNums(loop) = PossibleObsSurfNums(loop);
             }
 
             // Get coordinates of receiving points on this receiving surface. The number of receiving points
@@ -466,8 +513,19 @@ namespace SolarReflectionManager {
         // (hit point = point that ray intersects nearest obstruction, or, if ray is downgoing and hits no
         // obstructions, point that ray intersects ground plane).
 
+        // With the octree, each ray is tested only against the possible obstructions in the cubes it passes through.
+        // These are visited in surface number order, as in the full list, so nearest-hit ties resolve identically.
+        Array1D_bool IsPossibleObs;
+        std::vector<int> RayObsSurfNums;
+        if (UseSurfaceOctree) IsPossibleObs.dimension(TotSurfaces, false);
+
         for (RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum) {
             SurfNum = SolReflRecSurf(RecSurfNum).SurfNum;
+            if (UseSurfaceOctree) {
+                for (loop1 = 1; loop1 <= SolReflRecSurf(RecSurfNum).NumPossibleObs; ++loop1) {
+                    IsPossibleObs(SolReflRecSurf(RecSurfNum).PossibleObsSurfNums(loop1)) = true;
+                }
+            }
             for (RecPtNum = 1; RecPtNum <= SolReflRecSurf(RecSurfNum).NumRecPts; ++RecPtNum) {
                 RecPt = SolReflRecSurf(RecSurfNum).RecPt(RecPtNum);
                 for (RayNum = 1; RayNum <= SolReflRecSurf(RecSurfNum).NumReflRays; ++RayNum) {
@@ -479,9 +537,23 @@ namespace SolarReflectionManager {
                     NearestHitDistance = 1.0e+8;
                     ObsSurfNumToSkip = 0;
                     RayVec = SolReflRecSurf(RecSurfNum).RayVec(RayNum);
-                    for (loop1 = 1; loop1 <= SolReflRecSurf(RecSurfNum).NumPossibleObs; ++loop1) {
+                    int NumRayObs = SolReflRecSurf(RecSurfNum).NumPossibleObs; // Number of possible obstructions tested for this ray
+                    if (UseSurfaceOctree) {
+                        RayObsSurfNums.clear();
+                        for (int const OctObsSurfNum : NonOctreeSurfNums) {
+                            if (IsPossibleObs(OctObsSurfNum)) RayObsSurfNums.push_back(OctObsSurfNum);
+                        }
+                        surfaceOctree.processSurfaceRayIntersectsCube(
+                            RecPt, RayVec, SurfaceOctreeCube::safe_inverse(RayVec), [&](SurfaceData const &surface) {
+                                int const OctObsSurfNum = OctreeSurfNum(surface);
+                                if (IsPossibleObs(OctObsSurfNum)) RayObsSurfNums.push_back(OctObsSurfNum);
+                            });
+                        std::sort(RayObsSurfNums.begin(), RayObsSurfNums.end());
+                        NumRayObs = static_cast<int>(RayObsSurfNums.size());
+                    }
+                    for (loop1 = 1; loop1 <= NumRayObs; ++loop1) {
                         // Surface number of this obstruction
-                        ObsSurfNum = SolReflRecSurf(RecSurfNum).PossibleObsSurfNums(loop1);
+                        ObsSurfNum = UseSurfaceOctree ? RayObsSurfNums[loop1 - 1] : SolReflRecSurf(RecSurfNum).PossibleObsSurfNums(loop1);
                         // If a window was hit previously (see below), ObsSurfNumToSkip was set to the window's base surface in order
                         // to remove that surface from consideration as a hit surface for this ray
                         if (ObsSurfNum == ObsSurfNumToSkip) continue;
@@ -569,7 +641,12 @@ namespace SolarReflectionManager {
                     }     // End of check if obstruction hit
                 }         // End of RayNum loop
             }             // End of receiving point loop
-        }                 // End of receiving surface loop
+            if (UseSurfaceOctree) {
+                for (loop1 = 1; loop1 <= SolReflRecSurf(RecSurfNum).NumPossibleObs; ++loop1) {
+                    IsPossibleObs(SolReflRecSurf(RecSurfNum).PossibleObsSurfNums(loop1)) = false;
+                }
+            }
+        } // End of receiving surface loop
     }
 
     //=====================================================================================================
@@ -677,7 +754,6 @@ namespace SolarReflectionManager {
         bool hit;                                  // True iff obstruction is hit
         static Vector3<Real64> OriginThisRay(0.0); // Origin point of a ray (m)
         static Vector3<Real64> ObsHitPt(0.0);      // Hit point on obstruction (m)
-        static int ObsSurfNum(0);                  // Obstruction surface number
         static Real64 CosIncBmAtHitPt(0.0);        // Cosine of incidence angle of beam solar at hit point
         static Real64 CosIncBmAtHitPt2(0.0);       // Cosine of incidence angle of beam solar at hit point,
         //  the mirrored shading surface
@@ -773,35 +849,35 @@ namespace SolarReflectionManager {
 
                     // To speed up, ideally should store all possible shading surfaces for the HitPtSurfNum
                     //  obstruction surface in the SolReflSurf(HitPtSurfNum)%PossibleObsSurfNums(loop) array as well
-                    hit = false;
-                    for (ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum) {
+                    hit = AnyObstructionHit(OriginThisRay, SunVec, [&](int const ObsSurfNum) {
                         //        DO loop = 1,SolReflRecSurf(RecSurfNum)%NumPossibleObs
                         //          ObsSurfNum = SolReflRecSurf(RecSurfNum)%PossibleObsSurfNums(loop)
 
                         // CR 8959 -- The other side of a mirrored surface cannot obstruct the mirrored surface
                         if (HitPtSurfNum > 0) {
                             if (Surface(HitPtSurfNum).MirroredSurf) {
-                                if (ObsSurfNum == HitPtSurfNum - 1) continue;
+                                if (ObsSurfNum == HitPtSurfNum - 1) return false;
                             }
                         }
 
                         // skip the hit surface
-                        if (ObsSurfNum == HitPtSurfNum) continue;
+                        if (ObsSurfNum == HitPtSurfNum) return false;
 
                         // skip mirrored surfaces
-                        if (Surface(ObsSurfNum).MirroredSurf) continue;
+                        if (Surface(ObsSurfNum).MirroredSurf) return false;
                         // IF(Surface(ObsSurfNum)%ShadowingSurf .AND. Surface(ObsSurfNum)%Name(1:3) == 'Mir') THEN
                         //  CYCLE
                         // ENDIF
 
                         // skip interior surfaces
-                        if (Surface(ObsSurfNum).ExtBoundCond >= 1) continue;
+                        if (Surface(ObsSurfNum).ExtBoundCond >= 1) return false;
 
                         // For now it is assumed that obstructions that are shading surfaces are opaque.
                         // An improvement here would be to allow these to have transmittance.
-                        PierceSurface(ObsSurfNum, OriginThisRay, SunVec, ObsHitPt, hit);
-                        if (hit) break; // An obstruction was hit
-                    }
+                        bool hitObs(false);
+                        PierceSurface(ObsSurfNum, OriginThisRay, SunVec, ObsHitPt, hitObs);
+                        return hitObs; // An obstruction was hit
+                    });
                     if (hit) continue; // Sun does not reach this ray's hit point
 
                     // Sun reaches this ray's hit point; get beam-reflected diffuse radiance at hit point for
@@ -1038,20 +1114,21 @@ namespace SolarReflectionManager {
                                         }
                                     }
                                 } else { // Reflecting surface is a building shade
-                                    for (int ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum) {
-                                        if (!Surface(ObsSurfNum).ShadowSurfPossibleObstruction) continue;
-                                        if (ObsSurfNum == ReflSurfNum) continue;
+                                    hitObs = AnyObstructionHit(HitPtRefl, SunVec, [&](int const ObsSurfNum) {
+                                        if (!Surface(ObsSurfNum).ShadowSurfPossibleObstruction) return false;
+                                        if (ObsSurfNum == ReflSurfNum) return false;
 
                                         // TH2 CR8959 -- Skip mirrored surfaces
-                                        if (Surface(ObsSurfNum).MirroredSurf) continue;
+                                        if (Surface(ObsSurfNum).MirroredSurf) return false;
                                         // TH2 CR8959 -- The other side of a mirrored surface cannot obstruct the mirrored surface
                                         if (Surface(ReflSurfNum).MirroredSurf) {
-                                            if (ObsSurfNum == ReflSurfNum - 1) continue;
+                                            if (ObsSurfNum == ReflSurfNum - 1) return false;
                                         }
 
-                                        PierceSurface(ObsSurfNum, HitPtRefl, SunVec, HitPtObs, hitObs);
-                                        if (hitObs) break;
-                                    }
+                                        bool hitThisObs(false);
+                                        PierceSurface(ObsSurfNum, HitPtRefl, SunVec, HitPtObs, hitThisObs);
+                                        return hitThisObs;
+                                    });
                                 }
 
                                 if (hitObs) continue; // Obstruction hit between reflection hit point and sun; go to next receiving pt.
@@ -1125,7 +1202,6 @@ namespace SolarReflectionManager {
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
         static int RecSurfNum(0);   // Receiving surface number
         static int SurfNum(0);      // Heat transfer surface number corresponding to RecSurfNum
-        static int ObsSurfNum(0);   // Obstruction surface number
         static int RecPtNum(0);     // Receiving point number
         static int NumRecPts(0);    // Number of receiving points on a receiving surface
         static int HitPtSurfNum(0); // Surface number of hit point: -1 = ground,
@@ -1243,24 +1319,24 @@ namespace SolarReflectionManager {
                                 URay.x = cos_Phi[IPhi] * cos_Theta[ITheta];
                                 URay.y = cos_Phi[IPhi] * sin_Theta[ITheta];
                                 // Does this ray hit an obstruction?
-                                hitObs = false;
-                                for (ObsSurfNum = 1; ObsSurfNum <= TotSurfaces; ++ObsSurfNum) {
-                                    if (!Surface(ObsSurfNum).ShadowSurfPossibleObstruction) continue;
+                                hitObs = AnyObstructionHit(HitPtRefl, URay, [&](int const ObsSurfNum) {
+                                    if (!Surface(ObsSurfNum).ShadowSurfPossibleObstruction) return false;
                                     // Horizontal roof surfaces cannot be obstructions for rays from ground
-                                    if (Surface(ObsSurfNum).Tilt < 5.0) continue;
+                                    if (Surface(ObsSurfNum).Tilt < 5.0) return false;
                                     if (!Surface(ObsSurfNum).ShadowingSurf) {
-                                        if (dot(URay, Surface(ObsSurfNum).OutNormVec) >= 0.0) continue;
+                                        if (dot(URay, Surface(ObsSurfNum).OutNormVec) >= 0.0) return false;
                                         // Special test for vertical surfaces with URay dot OutNormVec < 0; excludes
                                         // case where ground hit point is in back of ObsSurfNum
                                         if (Surface(ObsSurfNum).Tilt > 89.0 && Surface(ObsSurfNum).Tilt < 91.0) {
                                             SurfVert = Surface(ObsSurfNum).Vertex(2);
                                             SurfVertToGndPt = HitPtRefl - SurfVert;
-                                            if (dot(SurfVertToGndPt, Surface(ObsSurfNum).OutNormVec) < 0.0) continue;
+                                            if (dot(SurfVertToGndPt, Surface(ObsSurfNum).OutNormVec) < 0.0) return false;
                                         }
                                     }
-                                    PierceSurface(ObsSurfNum, HitPtRefl, URay, HitPtObs, hitObs);
-                                    if (hitObs) break;
-                                }
+                                    bool hitThisObs(false);
+                                    PierceSurface(ObsSurfNum, HitPtRefl, URay, HitPtObs, hitThisObs);
+                                    return hitThisObs;
+                                });
                                 if (hitObs) continue; // Obstruction hit
                                 // Sky is hit
                                 dReflSkyGnd += CosIncAngRayToSky * dOmega / Pi;
@@ -48,6 +48,9 @@
 #ifndef SolarReflectionManager_hh_INCLUDED
 #define SolarReflectionManager_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array2D.hh>
@@ -73,6 +76,8 @@ namespace SolarReflectionManager {
     extern int TotSolReflRecSurf; // Total number of exterior surfaces that can receive reflected solar
     extern int TotPhiReflRays;    // Number of rays in altitude angle (-90 to 90 deg) for diffuse refl calc
     extern int TotThetaReflRays;  // Number of rays in azimuth angle (0 to 180 deg) for diffuse refl calc
+    extern bool UseSurfaceOctree; // True if ray-obstruction searches use the surface octree
+    extern std::vector<int> NonOctreeSurfNums; // Surfaces not held by the surface octree (always tested directly)
 
     // SUBROUTINE SPECIFICATIONS FOR MODULE ExteriorSolarReflectionManager
 
@@ -2406,7 +2406,6 @@ namespace SolarShading {
         Real64 Epsilon;                // Sky clearness parameter
         Real64 Delta;                  // Sky brightness parameter
         Real64 CosIncAngBeamOnSurface; // Cosine of incidence angle of beam solar on surface
-        Real64 IncAng;                 // Incidence angle of beam solar on surface (radians)
         int SurfNum;                   // Surface number
         int EpsilonBin;                // Sky clearness (Epsilon) bin index
         Real64 AirMass;                // Relative air mass
@@ -2445,11 +2444,21 @@ namespace SolarShading {
         F1 = max(0.0, F11R(EpsilonBin) + F12R(EpsilonBin) * Delta + F13R(EpsilonBin) * ZenithAng);
         F2 = F21R(EpsilonBin) + F22R(EpsilonBin) * Delta + F23R(EpsilonBin) * ZenithAng;
 
+        // Everything that does not depend on the surface is evaluated once per timestep, so the surface loop
+        // below is only the Perez superposition itself.
+        Real64 const SunCosX(SOLCOS(1));
+        Real64 const SunCosY(SOLCOS(2));
+        Real64 const SunCosZ(SOLCOS(3));
+        Real64 const OneMinusF1(1.0 - F1);
+        Real64 const CircumSolarCosZenith(max(0.0871557, CosZenithAng));
+        bool const SunNearHorizon(CosZenithAng < 0.0871557);
+        bool const UseTimestepShdgRatios(DetailedSkyDiffuseAlgorithm && ShadingTransmittanceVaries && SolarDistribution != MinimalShadowing);
+
         for (SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
-            if (!Surface(SurfNum).ExtSolar) continue;
+            auto const &thisSurface(Surface(SurfNum));
+            if (!thisSurface.ExtSolar) continue;
 
-            CosIncAngBeamOnSurface =
-                SOLCOS(1) * Surface(SurfNum).OutNormVec(1) + SOLCOS(2) * Surface(SurfNum).OutNormVec(2) + SOLCOS(3) * Surface(SurfNum).OutNormVec(3);
+            CosIncAngBeamOnSurface = SunCosX * thisSurface.OutNormVec(1) + SunCosY * thisSurface.OutNormVec(2) + SunCosZ * thisSurface.OutNormVec(3);
 
             // So I believe this should only be a diagnostic error...the calcs should always be within -1,+1; it's just round-off that we need to trap
             // for
@@ -2457,7 +2466,7 @@ namespace SolarShading {
                 if (CosIncAngBeamOnSurface > (1.0 + cosine_tolerance)) {
                     ShowSevereError("Cosine of incident angle of beam solar on surface out of range...too high");
                     ShowContinueError("This is a diagnostic error that should not be encountered under normal circumstances");
-                    ShowContinueError("Occurs on surface: " + Surface(SurfNum).Name);
+                    ShowContinueError("Occurs on surface: " + thisSurface.Name);
                     ShowContinueError("Current value = " + TrimSigDigits(CosIncAngBeamOnSurface) + " ... should be within [-1, +1]");
                     ShowFatalError("Anisotropic solar calculation causes fatal error");
                 }
@@ -2466,28 +2475,26 @@ namespace SolarShading {
                 if (CosIncAngBeamOnSurface < (-1.0 - cosine_tolerance)) {
                     ShowSevereError("Cosine of incident angle of beam solar on surface out of range...too low");
                     ShowContinueError("This is a diagnostic error that should not be encountered under normal circumstances");
-                    ShowContinueError("Occurs on surface: " + Surface(SurfNum).Name);
+                    ShowContinueError("Occurs on surface: " + thisSurface.Name);
                     ShowContinueError("Current value = " + TrimSigDigits(CosIncAngBeamOnSurface) + " ... should be within [-1, +1]");
                     ShowFatalError("Anisotropic solar calculation causes fatal error");
                 }
                 CosIncAngBeamOnSurface = -1.0;
             }
 
-            IncAng = std::acos(CosIncAngBeamOnSurface);
-
-            ViewFactorSkyGeom = Surface(SurfNum).ViewFactorSky;
-            MultIsoSky(SurfNum) = ViewFactorSkyGeom * (1.0 - F1);
+            ViewFactorSkyGeom = thisSurface.ViewFactorSky;
+            MultIsoSky(SurfNum) = ViewFactorSkyGeom * OneMinusF1;
             //           0.0871557 below corresponds to a zenith angle of 85 deg
-            CircumSolarFac = max(0.0, CosIncAngBeamOnSurface) / max(0.0871557, CosZenithAng);
+            CircumSolarFac = max(0.0, CosIncAngBeamOnSurface) / CircumSolarCosZenith;
             //           For near-horizontal roofs, model has an inconsistency that gives sky diffuse
             //           irradiance significantly different from DifSolarRad when zenith angle is
             //           above 85 deg. The following forces irradiance to be very close to DifSolarRad
             //           in this case.
-            if (CircumSolarFac > 0.0 && CosZenithAng < 0.0871557 && Surface(SurfNum).Tilt < 2.0) CircumSolarFac = 1.0;
+            if (CircumSolarFac > 0.0 && SunNearHorizon && thisSurface.Tilt < 2.0) CircumSolarFac = 1.0;
             MultCircumSolar(SurfNum) = F1 * CircumSolarFac;
-            MultHorizonZenith(SurfNum) = F2 * Surface(SurfNum).SinTilt;
+            MultHorizonZenith(SurfNum) = F2 * thisSurface.SinTilt;
 
-            if (!DetailedSkyDiffuseAlgorithm || !ShadingTransmittanceVaries || SolarDistribution == MinimalShadowing) {
+            if (!UseTimestepShdgRatios) {
                 AnisoSkyMult(SurfNum) = MultIsoSky(SurfNum) * DifShdgRatioIsoSky(SurfNum) +
                                         MultCircumSolar(SurfNum) * SunlitFrac(TimeStep, HourOfDay, SurfNum) +
                                         MultHorizonZenith(SurfNum) * DifShdgRatioHoriz(SurfNum);
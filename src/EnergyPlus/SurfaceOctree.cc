@@ -89,6 +89,20 @@ bool SurfaceOctreeCube::contains(Surface const &surface) const
     return true;
 }
 
+// Surfaces Outer Cube Reset to Empty
+void SurfaceOctreeCube::clear()
+{
+    assert(d_ == 0u);
+    for (std::uint8_t i = 0; i < n_; ++i) {
+        delete cubes_[i];
+        cubes_[i] = nullptr;
+    }
+    n_ = 0u;
+    surfaces_.clear();
+    l_ = u_ = c_ = Vertex(0.0);
+    w_ = r_ = 0.0;
+}
+
 // Surfaces Outer Cube Initilization
 void SurfaceOctreeCube::init(ObjexxFCL::Array1<Surface> &surfaces)
 {
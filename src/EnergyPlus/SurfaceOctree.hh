@@ -425,6 +425,9 @@ public: // Methods
     // Surfaces Outer Cube Initilization
     void init(ObjexxFCL::Array1<Surface> &surfaces);
 
+    // Surfaces Outer Cube Reset to Empty
+    void clear();
+
     // Surfaces that Line Segment Intersects Cube's Enclosing Sphere
     void surfacesSegmentIntersectsSphere(Vertex const &a, Vertex const &b, Surfaces &surfaces) const
     {
@@ -2534,7 +2534,7 @@ namespace SystemAvailabilityManager {
         NCycSysAvailMgrData(SysAvailNum).PriorAvailStatus = AvailStatus;
     }
 
-    bool CoolingZoneOutOfTolerance(Array1D_int const ZonePtrList, // list of controlled zone pointers
+    bool CoolingZoneOutOfTolerance(Array1D_int const &ZonePtrList, // list of controlled zone pointers
                                    int const NumZones,            // number of zones in list
                                    Real64 const TempTolerance     // temperature tolerance
     )
@@ -2559,7 +2559,7 @@ namespace SystemAvailabilityManager {
         return false;
     }
 
-    bool HeatingZoneOutOfTolerance(Array1D_int const ZonePtrList, // list of controlled zone pointers
+    bool HeatingZoneOutOfTolerance(Array1D_int const &ZonePtrList, // list of controlled zone pointers
                                    int const NumZones,            // number of zones in list
                                    Real64 const TempTolerance     // temperature tolerance
     )
@@ -2607,9 +2607,12 @@ namespace SystemAvailabilityManager {
 
         // Using/Aliasing
         using namespace DataAirLoop;
+        using DataEnvironment::DayOfWeek;
         using DataEnvironment::DayOfWeekTomorrow;
         using DataEnvironment::DayOfYear;
+        using DataEnvironment::DayOfYear_Schedule;
         using DataEnvironment::DSTIndicator;
+        using DataEnvironment::HolidayIndex;
         using DataHeatBalFanSys::TempControlType;
         using DataHeatBalFanSys::TempTstatAir;
         using DataHeatBalFanSys::TempZoneThermostatSetPoint;
@@ -2706,13 +2709,6 @@ namespace SystemAvailabilityManager {
         if (KickOffSimulation) {
             AvailStatus = NoAction;
         } else {
-            ScheduleIndex = GetScheduleIndex(OptStartMgr.FanSched);
-            JDay = DayOfYear;
-            TmrJDay = JDay + 1;
-            TmrDayOfWeek = DayOfWeekTomorrow;
-
-            DayValues.allocate(NumOfTimeStepInHour, 24);
-            DayValuesTmr.allocate(NumOfTimeStepInHour, 24);
             if (!allocated(OptStartData.OptStartFlag)) {
                 OptStartData.OptStartFlag.allocate(NumOfZones);
                 OptStartData.OccStartTime.allocate(NumOfZones);
@@ -2730,34 +2726,58 @@ namespace SystemAvailabilityManager {
             }
             if (!BeginDayFlag) BeginOfDayResetFlag = true;
 
-            GetScheduleValuesForDay(ScheduleIndex, DayValues);
-            GetScheduleValuesForDay(ScheduleIndex, DayValuesTmr, TmrJDay, TmrDayOfWeek);
-
-            FanStartTime = 0.0;
-            FanStartTimeTmr = 0.0;
-            exitLoop = false;
-            for (I = 1; I <= 24; ++I) {
-                for (J = 1; J <= NumOfTimeStepInHour; ++J) {
-                    if (DayValues(J, I) <= 0.0) continue;
-                    FanStartTime = I - 1 + 1 / NumOfTimeStepInHour * J;
-                    exitLoop = true;
-                    break;
+            // The fan start times only depend on which day schedules of the fan schedule apply today and tomorrow,
+            // so only look them up again when the day changes
+            if (OptStartMgr.FanStartDayOfYear != DayOfYear || OptStartMgr.FanStartDayOfYearSchedule != DayOfYear_Schedule ||
+                OptStartMgr.FanStartDayOfWeek != DayOfWeek || OptStartMgr.FanStartDayOfWeekTomorrow != DayOfWeekTomorrow ||
+                OptStartMgr.FanStartHolidayIndex != HolidayIndex) {
+                ScheduleIndex = OptStartMgr.FanSchedPtr;
+                JDay = DayOfYear;
+                TmrJDay = JDay + 1;
+                TmrDayOfWeek = DayOfWeekTomorrow;
+
+                DayValues.allocate(NumOfTimeStepInHour, 24);
+                DayValuesTmr.allocate(NumOfTimeStepInHour, 24);
+                GetScheduleValuesForDay(ScheduleIndex, DayValues);
+                GetScheduleValuesForDay(ScheduleIndex, DayValuesTmr, TmrJDay, TmrDayOfWeek);
+
+                FanStartTime = 0.0;
+                FanStartTimeTmr = 0.0;
+                exitLoop = false;
+                for (I = 1; I <= 24; ++I) {
+                    for (J = 1; J <= NumOfTimeStepInHour; ++J) {
+                        if (DayValues(J, I) <= 0.0) continue;
+                        FanStartTime = I - 1 + 1 / NumOfTimeStepInHour * J;
+                        exitLoop = true;
+                        break;
+                    }
+                    if (exitLoop) break;
                 }
-                if (exitLoop) break;
-            }
 
-            exitLoop = false;
-            for (I = 1; I <= 24; ++I) {
-                for (J = 1; J <= NumOfTimeStepInHour; ++J) {
-                    if (DayValuesTmr(J, I) <= 0.0) continue;
-                    FanStartTimeTmr = I - 1 + 1 / NumOfTimeStepInHour * J;
-                    exitLoop = true;
-                    break;
+                exitLoop = false;
+                for (I = 1; I <= 24; ++I) {
+                    for (J = 1; J <= NumOfTimeStepInHour; ++J) {
+                        if (DayValuesTmr(J, I) <= 0.0) continue;
+                        FanStartTimeTmr = I - 1 + 1 / NumOfTimeStepInHour * J;
+                        exitLoop = true;
+                        break;
+                    }
+                    if (exitLoop) break;
                 }
-                if (exitLoop) break;
-            }
 
-            if (FanStartTimeTmr == 0.0) FanStartTimeTmr = 24.0;
+                if (FanStartTimeTmr == 0.0) FanStartTimeTmr = 24.0;
+
+                OptStartMgr.FanStartTime = FanStartTime;
+                OptStartMgr.FanStartTimeTmr = FanStartTimeTmr;
+                OptStartMgr.FanStartDayOfYear = DayOfYear;
+                OptStartMgr.FanStartDayOfYearSchedule = DayOfYear_Schedule;
+                OptStartMgr.FanStartDayOfWeek = DayOfWeek;
+                OptStartMgr.FanStartDayOfWeekTomorrow = DayOfWeekTomorrow;
+                OptStartMgr.FanStartHolidayIndex = HolidayIndex;
+            } else {
+                FanStartTime = OptStartMgr.FanStartTime;
+                FanStartTimeTmr = OptStartMgr.FanStartTimeTmr;
+            }
 
             // Pass the start time to ZoneTempPredictorCorrector
             for (int counter = 1; counter <= AirToZoneNodeInfo(PriAirSysNum).NumZonesCooled; ++counter) {
@@ -265,6 +265,13 @@ namespace SystemAvailabilityManager {
         Real64 ATGUpdateTime2;
         Real64 ATGUpdateTemp1;
         Real64 ATGUpdateTemp2;
+        Real64 FanStartTime;            // first hour the fan schedule is on today
+        Real64 FanStartTimeTmr;         // first hour the fan schedule is on tomorrow
+        int FanStartDayOfYear;          // day state the fan start times were found for
+        int FanStartDayOfYearSchedule;
+        int FanStartDayOfWeek;
+        int FanStartDayOfWeekTomorrow;
+        int FanStartHolidayIndex;
 
         // Default Constructor
         DefineOptStartSysAvailManager()
@@ -273,7 +280,9 @@ namespace SystemAvailabilityManager {
               AdaptiveTGradCool(1.0), AdaptiveTGradHeat(1.0), ConstStartTime(2.0), NumPreDays(1), AvailStatus(0), NumHoursBeforeOccupancy(0.0),
               TempDiffHi(0.0), TempDiffLo(0.0), ATGWCZoneNumLo(0), ATGWCZoneNumHi(0), CycleOnFlag(false), ATGUpdateFlag1(false),
               ATGUpdateFlag2(false), FirstTimeATGFlag(true), OverNightStartFlag(false), OSReportVarFlag(false), AdaTempGradHeat(0.0),
-              AdaTempGradCool(0.0), ATGUpdateTime1(0.0), ATGUpdateTime2(0.0), ATGUpdateTemp1(0.0), ATGUpdateTemp2(0.0)
+              AdaTempGradCool(0.0), ATGUpdateTime1(0.0), ATGUpdateTime2(0.0), ATGUpdateTemp1(0.0), ATGUpdateTemp2(0.0),
+              FanStartTime(0.0), FanStartTimeTmr(0.0), FanStartDayOfYear(-1), FanStartDayOfYearSchedule(-1), FanStartDayOfWeek(-1),
+              FanStartDayOfWeekTomorrow(-1), FanStartHolidayIndex(-1)
         {
         }
 
@@ -507,12 +516,12 @@ namespace SystemAvailabilityManager {
                              Optional_int_const CompNum = _        // Index of ZoneHVAC equipment component
     );
 
-    bool CoolingZoneOutOfTolerance(Array1D_int const ZonePtrList, // list of controlled zone pointers
+    bool CoolingZoneOutOfTolerance(Array1D_int const &ZonePtrList, // list of controlled zone pointers
                                    int const NumZones,            // number of zones in list
                                    Real64 const TempTolerance     // temperature tolerance
     );
 
-    bool HeatingZoneOutOfTolerance(Array1D_int const ZonePtrList, // list of controlled zone pointers
+    bool HeatingZoneOutOfTolerance(Array1D_int const &ZonePtrList, // list of controlled zone pointers
                                    int const NumZones,            // number of zones in list
                                    Real64 const TempTolerance     // temperature tolerance
     );
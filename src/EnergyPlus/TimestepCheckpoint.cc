@@ -0,0 +1,167 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// C++ Headers
+#include <algorithm>
+
+// EnergyPlus Headers
+#include <TimestepCheckpoint.hh>
+
+namespace EnergyPlus {
+
+namespace TimestepCheckpoint {
+
+    // PURPOSE OF THIS MODULE:
+    // This module keeps per-timestep snapshots of registered module state so the demand manager can
+    // resimulate a timestep without recomputing results that demand limiting cannot change.
+
+    // METHODOLOGY EMPLOYED:
+    // A module registers a named checkpoint once and attaches the arrays that hold the results it wants
+    // to reuse.  On the normal pass through a timestep the module calls SaveCheckpoint after computing
+    // those results; while the demand manager is resimulating the same timestep (Resimulating is true)
+    // the module calls RestoreCheckpoint, which copies the saved values back into the arrays, and skips
+    // the computation.  Snapshots are only taken while CheckpointingActive is set, i.e. when the input
+    // contains at least one demand manager list, and are invalidated once the demand manager has
+    // finished with the timestep.
+
+    // Data
+    // MODULE VARIABLE DECLARATIONS:
+    int NumCheckpoints(0);
+    bool CheckpointingActive(false);
+    bool Resimulating(false);
+
+    // Object Data
+    Array1D<CheckpointData> Checkpoint;
+
+    // Functions
+
+    // Clears the global data in TimestepCheckpoint.
+    // Needed for unit tests, should not be normally called.
+    void clear_state()
+    {
+        NumCheckpoints = 0;
+        CheckpointingActive = false;
+        Resimulating = false;
+        Checkpoint.deallocate();
+    }
+
+    int RegisterCheckpoint(std::string const &Name)
+    {
+
+        // PURPOSE OF THIS FUNCTION:
+        // Returns the index of the checkpoint with the given name, creating it if necessary.
+
+        for (int CheckpointNum = 1; CheckpointNum <= NumCheckpoints; ++CheckpointNum) {
+            if (Checkpoint(CheckpointNum).Name == Name) return CheckpointNum;
+        }
+        Checkpoint.redimension(++NumCheckpoints);
+        Checkpoint(NumCheckpoints).Name = Name;
+        return NumCheckpoints;
+    }
+
+    void RegisterBuffer(int const CheckpointNum, ObjexxFCL::Array<Real64> &Buffer)
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Adds a module array to a checkpoint.  The array object itself is referenced, so it may be
+        // (re)allocated after registration; its current size is used each time the checkpoint is saved.
+
+        auto &checkpoint(Checkpoint(CheckpointNum));
+        if (std::find(checkpoint.Buffers.begin(), checkpoint.Buffers.end(), &Buffer) != checkpoint.Buffers.end()) return;
+        checkpoint.Buffers.push_back(&Buffer);
+        checkpoint.Saved.emplace_back();
+        checkpoint.IsSaved = false;
+    }
+
+    void SaveCheckpoint(int const CheckpointNum)
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Copies the current contents of the registered arrays into the checkpoint.
+
+        auto &checkpoint(Checkpoint(CheckpointNum));
+        for (std::size_t BufferNum = 0; BufferNum < checkpoint.Buffers.size(); ++BufferNum) {
+            ObjexxFCL::Array<Real64> const &buffer(*checkpoint.Buffers[BufferNum]);
+            checkpoint.Saved[BufferNum].assign(buffer.data(), buffer.data() + buffer.size());
+        }
+        checkpoint.IsSaved = true;
+    }
+
+    bool RestoreCheckpoint(int const CheckpointNum)
+    {
+
+        // PURPOSE OF THIS FUNCTION:
+        // Copies the saved values back into the registered arrays.  Returns false, leaving the arrays
+        // untouched, when nothing has been saved for this timestep or an array has been reallocated
+        // to a different size since the snapshot was taken; the caller must then recompute.
+
+        if (CheckpointNum <= 0 || CheckpointNum > NumCheckpoints) return false;
+        auto &checkpoint(Checkpoint(CheckpointNum));
+        if (!checkpoint.IsSaved) return false;
+        for (std::size_t BufferNum = 0; BufferNum < checkpoint.Buffers.size(); ++BufferNum) {
+            if (checkpoint.Buffers[BufferNum]->size() != checkpoint.Saved[BufferNum].size()) return false;
+        }
+        for (std::size_t BufferNum = 0; BufferNum < checkpoint.Buffers.size(); ++BufferNum) {
+            std::copy(checkpoint.Saved[BufferNum].begin(), checkpoint.Saved[BufferNum].end(), checkpoint.Buffers[BufferNum]->data());
+        }
+        return true;
+    }
+
+    void InvalidateCheckpoints()
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Discards all snapshots so they cannot be restored into a later timestep.
+
+        for (auto &checkpoint : Checkpoint) {
+            checkpoint.IsSaved = false;
+        }
+    }
+
+} // namespace TimestepCheckpoint
+
+} // namespace EnergyPlus
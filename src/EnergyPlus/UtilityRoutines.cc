@@ -51,6 +51,7 @@ extern "C" {
 }
 
 // C++ Headers
+#include <chrono>
 #include <cstdlib>
 #include <exception>
 #include <iostream>
@@ -606,14 +607,7 @@ int AbortEnergyPlus()
 
     // Output detailed ZONE time series data
     SimulationManager::OpenOutputJsonFiles();
-
-    if (ResultsFramework::OutputSchema->timeSeriesEnabled()) {
-        ResultsFramework::OutputSchema->writeTimeSeriesReports();
-    }
-
-    if (ResultsFramework::OutputSchema->timeSeriesAndTabularEnabled()) {
-        ResultsFramework::OutputSchema->WriteReport();
-    }
+    WriteEndOfRunReports();
 
 #ifdef EP_Detailed_Timings
     epSummaryTimes(Time_Finish - Time_Start);
@@ -697,6 +691,38 @@ void CloseMiscOpenFiles()
     }
 }
 
+void WriteEndOfRunReports()
+{
+    // PURPOSE OF THIS SUBROUTINE:
+    // Writes the JSON, CBOR and MessagePack time series and summary reports and displays how long each of them took.
+
+    // METHODOLOGY EMPLOYED:
+    // The reports are independent of each other and are written concurrently by the results framework.
+
+    for (auto const &sink : ResultsFramework::OutputSchema->writeEndOfRunReports()) {
+        if (!sink.error.empty()) {
+            ShowSevereError("WriteEndOfRunReports: Could not write " + sink.name + ": " + sink.error);
+            continue;
+        }
+        DisplayString("Writing " + sink.name + ", Elapsed Time=" + General::RoundSigDigits(sink.elapsedSeconds, 2) + "sec");
+    }
+}
+
+void TimeOutputSink(std::string const &SinkName, std::function<void()> const &WriteSink)
+{
+    // PURPOSE OF THIS SUBROUTINE:
+    // Writes one output on the calling thread and displays how long it took, in the same form as WriteEndOfRunReports.
+
+    // METHODOLOGY EMPLOYED:
+    // Used for the outputs that share the gio unit table, the error reporting or the SQLite connection and so cannot
+    // be written concurrently.  Errors are not caught, so fatal errors end the run as before.
+
+    auto const start = std::chrono::steady_clock::now();
+    WriteSink();
+    Real64 const elapsedSeconds = std::chrono::duration<Real64>(std::chrono::steady_clock::now() - start).count();
+    DisplayString("Writing " + SinkName + ", Elapsed Time=" + General::RoundSigDigits(elapsedSeconds, 2) + "sec");
+}
+
 void CloseOutOpenFiles()
 {
 
@@ -882,14 +908,7 @@ int EndEnergyPlus()
 
     // Output detailed ZONE time series data
     SimulationManager::OpenOutputJsonFiles();
-
-    if (ResultsFramework::OutputSchema->timeSeriesEnabled()) {
-        ResultsFramework::OutputSchema->writeTimeSeriesReports();
-    }
-
-    if (ResultsFramework::OutputSchema->timeSeriesAndTabularEnabled()) {
-        ResultsFramework::OutputSchema->WriteReport();
-    }
+    WriteEndOfRunReports();
 
 #ifdef EP_Detailed_Timings
     epSummaryTimes(Time_Finish - Time_Start);
@@ -1655,7 +1674,7 @@ void ShowRecurringSevereErrorAtEnd(std::string const &Message,         // Messag
     // of occurrences and optional tracking of associated min, max, and sum values
 
     // METHODOLOGY EMPLOYED:
-    // Calls StoreRecurringErrorMessage utility routine.
+    // Calls FindRecurringErrorMessage and StoreRecurringErrorMessage utility routines.
 
     // Using/Aliasing
     using namespace DataPrecisionGlobals;
@@ -1672,17 +1691,7 @@ void ShowRecurringSevereErrorAtEnd(std::string const &Message,         // Messag
             break;
         }
     }
-    bool bNewMessageFound = true;
-    for (int Loop = 1; Loop <= NumRecurringErrors; ++Loop) {
-        if (UtilityRoutines::SameString(RecurringErrors(Loop).Message, " ** Severe  ** " + Message)) {
-            bNewMessageFound = false;
-            MsgIndex = Loop;
-            break;
-        }
-    }
-    if (bNewMessageFound) {
-        MsgIndex = 0;
-    }
+    MsgIndex = FindRecurringErrorMessage(" ** Severe  ** ", Message, MsgIndex);
 
     ++TotalSevereErrors;
     StoreRecurringErrorMessage(
@@ -1710,7 +1719,7 @@ void ShowRecurringWarningErrorAtEnd(std::string const &Message,         // Messa
     // of occurrences and optional tracking of associated min, max, and sum values
 
     // METHODOLOGY EMPLOYED:
-    // Calls StoreRecurringErrorMessage utility routine.
+    // Calls FindRecurringErrorMessage and StoreRecurringErrorMessage utility routines.
 
     // Using/Aliasing
     using namespace DataPrecisionGlobals;
@@ -1727,17 +1736,7 @@ void ShowRecurringWarningErrorAtEnd(std::string const &Message,         // Messa
             break;
         }
     }
-    bool bNewMessageFound = true;
-    for (int Loop = 1; Loop <= NumRecurringErrors; ++Loop) {
-        if (UtilityRoutines::SameString(RecurringErrors(Loop).Message, " ** Warning ** " + Message)) {
-            bNewMessageFound = false;
-            MsgIndex = Loop;
-            break;
-        }
-    }
-    if (bNewMessageFound) {
-        MsgIndex = 0;
-    }
+    MsgIndex = FindRecurringErrorMessage(" ** Warning ** ", Message, MsgIndex);
 
     ++TotalWarningErrors;
     StoreRecurringErrorMessage(
@@ -1765,7 +1764,7 @@ void ShowRecurringContinueErrorAtEnd(std::string const &Message,         // Mess
     // of occurrences and optional tracking of associated min, max, and sum values
 
     // METHODOLOGY EMPLOYED:
-    // Calls StoreRecurringErrorMessage utility routine.
+    // Calls FindRecurringErrorMessage and StoreRecurringErrorMessage utility routines.
 
     // Using/Aliasing
     using namespace DataPrecisionGlobals;
@@ -1782,22 +1781,44 @@ void ShowRecurringContinueErrorAtEnd(std::string const &Message,         // Mess
             break;
         }
     }
-    bool bNewMessageFound = true;
-    for (int Loop = 1; Loop <= NumRecurringErrors; ++Loop) {
-        if (UtilityRoutines::SameString(RecurringErrors(Loop).Message, " **   ~~~   ** " + Message)) {
-            bNewMessageFound = false;
-            MsgIndex = Loop;
-            break;
-        }
-    }
-    if (bNewMessageFound) {
-        MsgIndex = 0;
-    }
+    MsgIndex = FindRecurringErrorMessage(" **   ~~~   ** ", Message, MsgIndex);
 
     StoreRecurringErrorMessage(
         " **   ~~~   ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits);
 }
 
+int FindRecurringErrorMessage(std::string const &MessagePrefix, // Severity prefix, e.g. " ** Warning ** "
+                              std::string const &Message,       // Message text without the prefix
+                              int const MsgIndex                // Recurring message index held by the caller
+)
+{
+
+    // PURPOSE OF THIS FUNCTION:
+    // Returns the index of the stored recurring message that matches MessagePrefix + Message
+    // (case insensitive), or zero if the message has not been stored yet.
+
+    // METHODOLOGY EMPLOYED:
+    // Callers keep the index assigned on the first call and pass it back on repeat calls, so the
+    // entry at MsgIndex is checked first without building the full message. Otherwise the message
+    // is found through the hash of stored messages rather than by searching every stored message.
+
+    // Using/Aliasing
+    using namespace DataErrorTracking;
+
+    if (MsgIndex > 0 && MsgIndex <= NumRecurringErrors) {
+        std::string const &StoredMessage(RecurringErrors(MsgIndex).Message);
+        if (StoredMessage.size() == MessagePrefix.size() + Message.size() &&
+            StoredMessage.compare(0, MessagePrefix.size(), MessagePrefix) == 0 &&
+            StoredMessage.compare(MessagePrefix.size(), std::string::npos, Message) == 0) {
+            return MsgIndex;
+        }
+    }
+
+    auto const found = RecurringErrorIndex.find(UtilityRoutines::MakeUPPERCase(MessagePrefix + Message));
+    if (found != RecurringErrorIndex.end()) return found->second;
+    return 0;
+}
+
 void StoreRecurringErrorMessage(std::string const &ErrorMessage,         // Message automatically written to "error file" at end of simulation
                                 int &ErrorMsgIndex,                      // Recurring message index, if zero, next available index is assigned
                                 Optional<Real64 const> ErrorReportMaxOf, // Track and report the max of the values passed to this argument
@@ -1826,12 +1847,13 @@ void StoreRecurringErrorMessage(std::string const &ErrorMessage,         // Mess
     using DataGlobals::DoingSizing;
     using DataGlobals::WarmupFlag;
 
-    // If Index is zero, then assign next available index and reallocate array
+    // If Index is zero, then assign next available index and append to the array (push_back grows capacity geometrically)
     if (ErrorMsgIndex == 0) {
-        RecurringErrors.redimension(++NumRecurringErrors);
-        ErrorMsgIndex = NumRecurringErrors;
+        RecurringErrors.push_back(RecurringErrorData());
+        ErrorMsgIndex = ++NumRecurringErrors;
         // The message string only needs to be stored once when a new recurring message is created
         RecurringErrors(ErrorMsgIndex).Message = ErrorMessage;
+        RecurringErrorIndex.emplace(UtilityRoutines::MakeUPPERCase(ErrorMessage), ErrorMsgIndex);
         RecurringErrors(ErrorMsgIndex).Count = 1;
         if (WarmupFlag) RecurringErrors(ErrorMsgIndex).WarmupCount = 1;
         if (DoingSizing) RecurringErrors(ErrorMsgIndex).SizingCount = 1;
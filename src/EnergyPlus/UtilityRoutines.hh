@@ -48,6 +48,9 @@
 #ifndef UtilityRoutines_hh_INCLUDED
 #define UtilityRoutines_hh_INCLUDED
 
+// C++ Headers
+#include <functional>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array1S.fwd.hh>
@@ -64,6 +67,10 @@ int AbortEnergyPlus();
 
 void CloseMiscOpenFiles();
 
+void WriteEndOfRunReports();
+
+void TimeOutputSink(std::string const &SinkName, std::function<void()> const &WriteSink);
+
 void CloseOutOpenFiles();
 
 int EndEnergyPlus();
@@ -176,6 +183,11 @@ void ShowRecurringContinueErrorAtEnd(std::string const &Message,             //
                                      std::string const &ReportSumUnits = ""  // optional char string (<=15 length) of units for sum value
 );
 
+int FindRecurringErrorMessage(std::string const &MessagePrefix, // Severity prefix, e.g. " ** Warning ** "
+                              std::string const &Message,       // Message text without the prefix
+                              int const MsgIndex                // Recurring message index held by the caller
+);
+
 void StoreRecurringErrorMessage(std::string const &ErrorMessage,             // Message automatically written to "error file" at end of simulation
                                 int &ErrorMsgIndex,                          // Recurring message index, if zero, next available index is assigned
                                 Optional<Real64 const> ErrorReportMaxOf = _, // Track and report the max of the values passed to this argument
@@ -5080,6 +5080,7 @@ namespace VariableSpeedCoils {
         static bool firstTime(true);
         static Real64 LoadSideInletDBTemp_Init; // rated conditions
         static Real64 LoadSideInletWBTemp_Init; // rated conditions
+        static Real64 OutBaroPress_Init(-1.0);  // barometric pressure used for LoadSideInletWBTemp_Init
         static Real64 LoadSideInletHumRat_Init; // rated conditions
         static Real64 LoadSideInletEnth_Init;   // rated conditions
         static Real64 CpAir_Init;               // rated conditions
@@ -5138,7 +5139,11 @@ namespace VariableSpeedCoils {
             CpAir_Init = PsyCpAirFnWTdb(LoadSideInletHumRat_Init, LoadSideInletDBTemp_Init);
             firstTime = false;
         }
-        LoadSideInletWBTemp_Init = PsyTwbFnTdbWPb(LoadSideInletDBTemp_Init, LoadSideInletHumRat_Init, OutBaroPress, RoutineName);
+        // rated inlet conditions are fixed, so the wet-bulb only needs updating when the barometric pressure changes
+        if (OutBaroPress != OutBaroPress_Init) {
+            LoadSideInletWBTemp_Init = PsyTwbFnTdbWPb(LoadSideInletDBTemp_Init, LoadSideInletHumRat_Init, OutBaroPress, RoutineName);
+            OutBaroPress_Init = OutBaroPress;
+        }
 
         MaxSpeed = VarSpeedCoil(DXCoilNum).NumOfSpeeds;
 
@@ -215,6 +215,12 @@ namespace WeatherManager {
         bool GetBranchInputOneTimeFlag(true);
         bool GetEnvironmentFirstCall(true);
         bool PrntEnvHeaders(true);
+        // Last water mains correlation evaluation; the correlation only changes once a day
+        int WaterMainsCorrelationDayOfYear(0);
+        Real64 WaterMainsCorrelationAnnualAvg(0.0);
+        Real64 WaterMainsCorrelationMaxDiff(0.0);
+        Real64 WaterMainsCorrelationLatitude(0.0);
+        Real64 WaterMainsCorrelationTemp(0.0);
     } // namespace
     Real64 WeatherFileLatitude(0.0);
     Real64 WeatherFileLongitude(0.0);
@@ -369,6 +375,7 @@ namespace WeatherManager {
     Array1D<WeatherProperties> WPSkyTemperature;
     Array1D<SpecialDayData> SpecialDays;
     Array1D<DataPeriodData> DataPeriods;
+    Array1D<SolarGeometryDayData> SolarGeometryTable; // Solar geometry by day of year (1 - 366)
 
     std::shared_ptr<BaseGroundTempsModel> siteShallowGroundTempsPtr;
     std::shared_ptr<BaseGroundTempsModel> siteBuildingSurfaceGroundTempsPtr;
@@ -419,6 +426,11 @@ namespace WeatherManager {
         WaterMainsTempsAnnualAvgAirTemp = 0.0; // Annual average outdoor air temperature (C)
         WaterMainsTempsMaxDiffAirTemp = 0.0;   // Maximum difference in monthly average outdoor air temperatures (deltaC)
         WaterMainsTempsScheduleName = "";      // water mains tempeature schedule name
+        WaterMainsCorrelationDayOfYear = 0;
+        WaterMainsCorrelationAnnualAvg = 0.0;
+        WaterMainsCorrelationMaxDiff = 0.0;
+        WaterMainsCorrelationLatitude = 0.0;
+        WaterMainsCorrelationTemp = 0.0;
         wthFCGroundTemps = false;
         RainAmount = 0.0;
         SnowAmount = 0.0;
@@ -554,6 +566,7 @@ namespace WeatherManager {
         WPSkyTemperature.deallocate();
         SpecialDays.deallocate();
         DataPeriods.deallocate();
+        SolarGeometryTable.deallocate();
 
         underwaterBoundaries.clear();
 
@@ -5042,6 +5055,25 @@ namespace WeatherManager {
         Real64 CosX; // COS(X)
         Real64 SinX; // SIN(X)
 
+        // The coefficients only depend on the day of year and the hemisphere, so every sizing/run environment
+        // and warmup day that revisits a day of year takes them from the run-wide solar geometry table.
+        bool const SouthernHemisphere(Latitude < 0.0);
+        bool const UseTable(DayOfYear >= 1 && DayOfYear <= 366);
+        if (UseTable) {
+            if (!allocated(SolarGeometryTable)) SolarGeometryTable.allocate(366);
+            auto const &thisDay(SolarGeometryTable(DayOfYear));
+            if (thisDay.CoeffsValid && thisDay.SouthernHemisphere == SouthernHemisphere) {
+                A = thisDay.A;
+                B = thisDay.B;
+                C = thisDay.C;
+                AnnVarSolConstant = thisDay.AnnVarSolConstant;
+                EquationOfTime = thisDay.EquationOfTime;
+                SineSolarDeclination = thisDay.SinSolarDeclinAngle;
+                CosineSolarDeclination = thisDay.CosSolarDeclinAngle;
+                return;
+            }
+        }
+
         X = DayCorrection * DayOfYear; // Convert Julian date (Day of Year) to angle X
 
         // Calculate sines and cosines of X
@@ -5091,6 +5123,19 @@ namespace WeatherManager {
             ASHRAE_C_Coef(7) * (CosX * (pow_2(CosX) - pow_2(SinX)) - SinX * (SinX * CosX * 2.0)) +
             ASHRAE_C_Coef(8) * (2.0 * (SinX * CosX * 2.0) * (pow_2(CosX) - pow_2(SinX))) +
             ASHRAE_C_Coef(9) * (pow_2(pow_2(CosX) - pow_2(SinX)) - pow_2(SinX * CosX * 2.0));
+
+        if (UseTable) {
+            auto &thisDay(SolarGeometryTable(DayOfYear));
+            thisDay.CoeffsValid = true;
+            thisDay.SouthernHemisphere = SouthernHemisphere;
+            thisDay.A = A;
+            thisDay.B = B;
+            thisDay.C = C;
+            thisDay.AnnVarSolConstant = AnnVarSolConstant;
+            thisDay.EquationOfTime = EquationOfTime;
+            thisDay.SinSolarDeclinAngle = SineSolarDeclination;
+            thisDay.CosSolarDeclinAngle = CosineSolarDeclination;
+        }
     }
 
     void CalculateSunDirectionCosines(Real64 const TimeValue,    // Current Time of Day
@@ -5210,6 +5255,32 @@ namespace WeatherManager {
         } else {
             HrAngle = (15.0 * (12.0 - ((CurrentTime + TS1TimeOffset) + TodayVariables.EquationOfTime)) + (TimeZoneMeridian - Longitude));
         }
+
+        // Sizing/run environments and warmup days revisit the same day of year, so the sun position is kept per
+        // (day of year, hour, timestep) for the run.  A slot is reused only if it was computed from the same
+        // hour angle, declination and latitude, which keeps results identical to a fresh calculation.
+        SunPositionData *thisSlot(nullptr);
+        int const DayOfYearNow(TodayVariables.DayOfYear);
+        if (DayOfYearNow >= 1 && DayOfYearNow <= 366 && HourOfDay >= 1 && HourOfDay <= 24 && TimeStep >= 1 && TimeStep <= NumOfTimeStepInHour) {
+            if (!allocated(SolarGeometryTable)) SolarGeometryTable.allocate(366);
+            auto &sunPosition(SolarGeometryTable(DayOfYearNow).SunPosition);
+            if (sunPosition.size1() != static_cast<std::size_t>(NumOfTimeStepInHour) || sunPosition.size2() != 24u) {
+                sunPosition.allocate(NumOfTimeStepInHour, 24);
+                sunPosition = SunPositionData();
+            }
+            thisSlot = &sunPosition(TimeStep, HourOfDay);
+            if (thisSlot->Valid && thisSlot->HrAngle == HrAngle && thisSlot->SinSolarDeclinAngle == TodayVariables.SinSolarDeclinAngle &&
+                thisSlot->CosSolarDeclinAngle == TodayVariables.CosSolarDeclinAngle && thisSlot->SinLatitude == SinLatitude) {
+                SolarAltitudeAngle = thisSlot->SolarAltitudeAngle;
+                SolarAzimuthAngle = thisSlot->SolarAzimuthAngle;
+                SunIsUp = thisSlot->SunIsUp;
+                SunDirectionCosines(1) = thisSlot->SunDirectionCosines[0];
+                SunDirectionCosines(2) = thisSlot->SunDirectionCosines[1];
+                SunDirectionCosines(3) = thisSlot->SunDirectionCosines[2];
+                return;
+            }
+        }
+
         H = HrAngle * DegToRadians;
 
         // Compute the Cosine of the Solar Zenith (Altitude) Angle.
@@ -5241,6 +5312,18 @@ namespace WeatherManager {
                 TodayVariables.SinSolarDeclinAngle * CosLatitude - TodayVariables.CosSolarDeclinAngle * SinLatitude * std::cos(H);
             SunDirectionCosines(1) = TodayVariables.CosSolarDeclinAngle * std::sin(H);
         }
+
+        if (thisSlot != nullptr) {
+            thisSlot->Valid = true;
+            thisSlot->HrAngle = HrAngle;
+            thisSlot->SinSolarDeclinAngle = TodayVariables.SinSolarDeclinAngle;
+            thisSlot->CosSolarDeclinAngle = TodayVariables.CosSolarDeclinAngle;
+            thisSlot->SinLatitude = SinLatitude;
+            thisSlot->SolarAltitudeAngle = SolarAltitudeAngle;
+            thisSlot->SolarAzimuthAngle = SolarAzimuthAngle;
+            thisSlot->SunIsUp = SunIsUp;
+            thisSlot->SunDirectionCosines = {{SunDirectionCosines(1), SunDirectionCosines(2), SunDirectionCosines(3)}};
+        }
     }
 
     void OpenWeatherFile(bool &ErrorsFound)
@@ -8360,6 +8443,12 @@ namespace WeatherManager {
         Real64 WaterMainsTempFromCorrelation; // calculated water main temp (C)
 
         // FLOW:
+        // The result only depends on the day of the year and the inputs, so reuse it for the other timesteps of the day
+        if (DayOfYear == WaterMainsCorrelationDayOfYear && AnnualOAAvgDryBulbTemp == WaterMainsCorrelationAnnualAvg &&
+            MonthlyOAAvgDryBulbTempMaxDiff == WaterMainsCorrelationMaxDiff && Latitude == WaterMainsCorrelationLatitude) {
+            return WaterMainsCorrelationTemp;
+        }
+
         Tavg = AnnualOAAvgDryBulbTemp * (9.0 / 5.0) + 32.0;
         Tdiff = MonthlyOAAvgDryBulbTempMaxDiff * (9.0 / 5.0);
 
@@ -8378,7 +8467,15 @@ namespace WeatherManager {
         if (CurrentWaterMainsTemp < 32.0) CurrentWaterMainsTemp = 32.0;
 
         // Convert F to C
-        return WaterMainsTempFromCorrelation = (CurrentWaterMainsTemp - 32.0) * (5.0 / 9.0);
+        WaterMainsTempFromCorrelation = (CurrentWaterMainsTemp - 32.0) * (5.0 / 9.0);
+
+        WaterMainsCorrelationDayOfYear = DayOfYear;
+        WaterMainsCorrelationAnnualAvg = AnnualOAAvgDryBulbTemp;
+        WaterMainsCorrelationMaxDiff = MonthlyOAAvgDryBulbTempMaxDiff;
+        WaterMainsCorrelationLatitude = Latitude;
+        WaterMainsCorrelationTemp = WaterMainsTempFromCorrelation;
+
+        return WaterMainsTempFromCorrelation;
     }
     void GetWeatherStation(bool &ErrorsFound)
     {
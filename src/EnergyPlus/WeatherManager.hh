@@ -49,6 +49,7 @@
 #define WeatherManager_hh_INCLUDED
 
 // C++ Headers
+#include <array>
 #include <vector>
 
 // ObjexxFCL Headers
@@ -641,6 +642,49 @@ namespace WeatherManager {
     };
     extern std::vector<UnderwaterBoundary> underwaterBoundaries;
 
+    struct SunPositionData // Sun position for one timestep of one day of year
+    {
+        // Members
+        bool Valid;                                // True once the slot has been computed
+        Real64 HrAngle;                            // Hour angle the slot was computed for (degrees)
+        Real64 SinSolarDeclinAngle;                // Sine of the solar declination the slot was computed for
+        Real64 CosSolarDeclinAngle;                // Cosine of the solar declination the slot was computed for
+        Real64 SinLatitude;                        // Sine of the latitude the slot was computed for
+        Real64 SolarAltitudeAngle;                 // Angle of solar altitude (degrees)
+        Real64 SolarAzimuthAngle;                  // Angle of solar azimuth (degrees)
+        bool SunIsUp;                              // True when the sun is over the horizon
+        std::array<Real64, 3> SunDirectionCosines; // Direction cosines of the sun
+
+        // Default Constructor
+        SunPositionData()
+            : Valid(false), HrAngle(0.0), SinSolarDeclinAngle(0.0), CosSolarDeclinAngle(0.0), SinLatitude(0.0), SolarAltitudeAngle(0.0),
+              SolarAzimuthAngle(0.0), SunIsUp(false), SunDirectionCosines{{0.0, 0.0, 0.0}}
+        {
+        }
+    };
+
+    struct SolarGeometryDayData // Solar geometry for one day of year, shared by all sizing/run environments and warmup days
+    {
+        // Members
+        bool CoeffsValid;                     // True once the daily solar coefficients have been computed
+        bool SouthernHemisphere;              // Hemisphere the B and C coefficients were computed for
+        Real64 A;                             // ASHRAE "A" - Apparent solar irradiation at air mass = 0 [W/M**2]
+        Real64 B;                             // ASHRAE "B" - Atmospheric extinction coefficient
+        Real64 C;                             // ASHRAE "C" - Diffuse radiation factor
+        Real64 AnnVarSolConstant;             // Annual variation in the solar constant
+        Real64 EquationOfTime;                // Equation of Time
+        Real64 SinSolarDeclinAngle;           // Sine of Solar Declination
+        Real64 CosSolarDeclinAngle;           // Cosine of Solar Declination
+        Array2D<SunPositionData> SunPosition; // Sun position by (TimeStep, HourOfDay)
+
+        // Default Constructor
+        SolarGeometryDayData()
+            : CoeffsValid(false), SouthernHemisphere(false), A(0.0), B(0.0), C(0.0), AnnVarSolConstant(0.0), EquationOfTime(0.0),
+              SinSolarDeclinAngle(0.0), CosSolarDeclinAngle(0.0)
+        {
+        }
+    };
+
     // Object Data
     extern DayWeatherVariables TodayVariables; // Today's daily weather variables | Derived Type for Storing Weather "Header" Data | Day of year for
                                                // weather data | Year of weather data | Month of weather data | Day of month for weather data | Day of
@@ -670,6 +714,7 @@ namespace WeatherManager {
     extern Array1D<WeatherProperties> WPSkyTemperature;
     extern Array1D<SpecialDayData> SpecialDays;
     extern Array1D<DataPeriodData> DataPeriods;
+    extern Array1D<SolarGeometryDayData> SolarGeometryTable; // Solar geometry by day of year (1 - 366)
 
     // Functions
     void clear_state();
@@ -743,13 +743,53 @@ namespace WindowComplexManager {
             ISurf = WindowList(IWind).SurfNo;
             NumStates = ComplexWind(ISurf).NumStates;
             for (IState = 1; IState <= NumStates; ++IState) {
-                CFSShadeAndBeamInitialization(ISurf, IState);
+                // Earlier states are initialized first, so a state with the same beam geometry already holds it
+                // for the sun positions of this shading period
+                CFSShadeAndBeamInitialization(ISurf, IState, FindCFSStateWithSameBeamGeometry(ISurf, IState));
             } // State loop
         }     // window loop
     }
 
-    void CFSShadeAndBeamInitialization(int const iSurf, // Window surface number
-                                       int const iState // Window state number
+    int FindCFSStateWithSameBeamGeometry(int const iSurf, // Window surface number
+                                         int const iState // Window state number
+    )
+    {
+
+        // PURPOSE OF THIS FUNCTION:
+        // Find an earlier state of the same window whose incident basis and ground points are identical to
+        // those of the given state, so the sun direction lookups and ground shading can be taken from it.
+        // Returns zero when there is none.
+
+        // METHODOLOGY EMPLOYED:
+        // The incident basis is rebuilt from the construction's basis matrix (ConstructBasis) and the ground
+        // points follow from the basis directions and the window position, so states whose bases come from the
+        // same matrix with the same type and symmetry see the sun in the same basis element and shade the same
+        // ground points. The ground points are compared as well to be safe.
+
+        auto const &thisGeom(ComplexWind(iSurf).Geom(iState));
+        for (int jState = 1; jState < iState; ++jState) {
+            auto const &otherGeom(ComplexWind(iSurf).Geom(jState));
+            if (otherGeom.Inc.BasisType != thisGeom.Inc.BasisType) continue;
+            if (otherGeom.Inc.BasisSymmetryType != thisGeom.Inc.BasisSymmetryType) continue;
+            if (otherGeom.Inc.BasisMatIndex != thisGeom.Inc.BasisMatIndex) continue;
+            if (otherGeom.Inc.NBasis != thisGeom.Inc.NBasis) continue;
+            if (otherGeom.NGnd != thisGeom.NGnd) continue;
+            bool sameGndPts = true;
+            for (int I = 1; I <= thisGeom.NGnd; ++I) {
+                if (otherGeom.GndPt(I).x != thisGeom.GndPt(I).x || otherGeom.GndPt(I).y != thisGeom.GndPt(I).y ||
+                    otherGeom.GndPt(I).z != thisGeom.GndPt(I).z) {
+                    sameGndPts = false;
+                    break;
+                }
+            }
+            if (sameGndPts) return jState;
+        }
+        return 0;
+    }
+
+    void CFSShadeAndBeamInitialization(int const iSurf,     // Window surface number
+                                       int const iState,    // Window state number
+                                       int const iSameState // Earlier state with the same beam geometry, zero if none
     )
     {
 
@@ -764,13 +804,15 @@ namespace WindowComplexManager {
         // Refactoring from Klems code
 
         // METHODOLOGY EMPLOYED:
-        // na
+        // When an earlier state of the same window with the same beam geometry is given, its sun ray indices and
+        // ground shading for the current sun positions are copied instead of recalculated. This is only valid when
+        // both states are initialized for the same sun positions, so states that are added during a shading period
+        // are always calculated on their own.
 
         // REFERENCES:
         // na
 
         // Using/Aliasing
-        using namespace Vectors;
         using DataGlobals::HourOfDay;
         using DataGlobals::KickOffSimulation;
         using DataGlobals::KickOffSizing;
@@ -791,124 +833,130 @@ namespace WindowComplexManager {
 
         // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
 
-        // Object Data
-        static Vector SunDir(0.0, 0.0, 1.0); // unit vector pointing toward sun (world CS)
-        static Vector Posit(0.0, 0.0, 1.0);  // vector location of current ground point
-        static Vector HitPt(0.0, 0.0, 1.0);  // vector location of ray intersection with a surface
-
         if (KickOffSizing || KickOffSimulation) return;
 
-        int IncRay;   // Index of incident ray corresponding to beam direction
-        Real64 Theta; // Theta angle of incident ray correspongind to beam direction
-        Real64 Phi;   // Phi angle of incident ray correspongind to beam direction
-        bool hit;     // hit flag
-        int TotHits;  // hit counter
         auto &complexWindow(ComplexWind(iSurf));
         auto &complexWindowGeom(complexWindow.Geom(iState));
         auto &surfaceWindowState(SurfaceWindow(iSurf).ComplexFen.State(iState));
 
         if (!DetailedSolarTimestepIntegration) {
-            std::size_t lHT(0);  // Linear index for ( Hour, TS )
-            std::size_t lHTI(0); // Linear index for ( Hour, TS, I )
             for (int Hour = 1; Hour <= 24; ++Hour) {
-                for (int TS = 1; TS <= NumOfTimeStepInHour; ++TS, ++lHT) { // [ lHT ] == ( Hour, TS )
-                    SunDir = SUNCOSTS(TS, Hour, {1, 3});
-                    Theta = 0.0;
-                    Phi = 0.0;
-                    if (SUNCOSTS(TS, Hour, 3) > SunIsUpValue) {
-                        IncRay = FindInBasis(SunDir, Front_Incident, iSurf, iState, complexWindowGeom.Inc, Theta, Phi);
-                        complexWindowGeom.ThetaBm[lHT] = Theta;
-                        complexWindowGeom.PhiBm[lHT] = Phi;
+                for (int TS = 1; TS <= NumOfTimeStepInHour; ++TS) {
+                    if (iSameState > 0) {
+                        CopyCFSBeamGeometry(complexWindow.Geom(iSameState), complexWindowGeom, Hour, TS);
                     } else {
-                        complexWindowGeom.ThetaBm[lHT] = 0.0;
-                        complexWindowGeom.PhiBm[lHT] = 0.0;
-                        IncRay = 0; // sundown can't have ray incident on window
+                        CalcCFSBeamGeometry(iSurf, iState, complexWindowGeom, Hour, TS);
                     }
-                    if (IncRay > 0) { // Sun may be incident on the window
-                        complexWindowGeom.SolBmIndex[lHT] = IncRay;
-                    } else { // Window can't be sunlit, set front incidence ray index to zero
-                        complexWindowGeom.SolBmIndex[lHT] = 0;
-                    }
-                    for (int I = 1, nGnd = complexWindowGeom.NGnd; I <= nGnd; ++I, ++lHTI) { // Gnd pt loop
-                        TotHits = 0;
-                        Vector const gndPt(complexWindowGeom.GndPt(I));
-                        for (int JSurf = 1, eSurf = TotSurfaces; JSurf <= eSurf; ++JSurf) {
-                            // the following test will cycle on anything except exterior surfaces and shading surfaces
-                            if (Surface(JSurf).HeatTransSurf && Surface(JSurf).ExtBoundCond != ExternalEnvironment) continue;
-                            // skip surfaces that face away from the ground point
-                            if (dot(SunDir, Surface(JSurf).NewellSurfaceNormalVector) >= 0.0) continue;
-                            // Looking for surfaces between GndPt and sun
-                            PierceSurface(JSurf, gndPt, SunDir, HitPt, hit);
-                            if (hit) {
-                                // Are not going into the details of whether a hit surface is transparent
-                                // Since this is ultimately simply weighting the transmittance, so great
-                                // detail is not warranted
-                                ++TotHits;
-                                break;
-                            }
-                        }
-                        if (TotHits > 0) {
-                            complexWindowGeom.SolBmGndWt[lHTI] = 0.0; // [ lHTI ] == ( Hour, TS, I )
-                        } else {
-                            complexWindowGeom.SolBmGndWt[lHTI] = 1.0; // [ lHTI ] == ( Hour, TS, I )
-                        }
-                    } // Gnd pt loop
 
                     // update window beam properties
                     CalculateWindowBeamProperties(iSurf, iState, complexWindow, complexWindowGeom, surfaceWindowState, Hour, TS);
-                }                                                                        // Timestep loop
-            }                                                                            // Hour loop
-        } else {                                                                         // detailed timestep integration
-            std::size_t const lHT(complexWindowGeom.ThetaBm.index(HourOfDay, TimeStep)); // [ lHT ] == ( HourOfDay, TimeStep )
-            SunDir = SUNCOSTS(TimeStep, HourOfDay, {1, 3});
-            Theta = 0.0;
-            Phi = 0.0;
-            if (SUNCOSTS(TimeStep, HourOfDay, 3) > SunIsUpValue) {
-                IncRay = FindInBasis(SunDir, Front_Incident, iSurf, iState, complexWindowGeom.Inc, Theta, Phi);
-                complexWindowGeom.ThetaBm[lHT] = Theta;
-                complexWindowGeom.PhiBm[lHT] = Phi;
+                } // Timestep loop
+            }     // Hour loop
+        } else {  // detailed timestep integration
+            if (iSameState > 0) {
+                CopyCFSBeamGeometry(complexWindow.Geom(iSameState), complexWindowGeom, HourOfDay, TimeStep);
             } else {
-                complexWindowGeom.ThetaBm[lHT] = 0.0;
-                complexWindowGeom.PhiBm[lHT] = 0.0;
-                IncRay = 0; // sundown can't have ray incident on window
+                CalcCFSBeamGeometry(iSurf, iState, complexWindowGeom, HourOfDay, TimeStep);
             }
 
-            if (IncRay > 0) { // Sun may be incident on the window
-                complexWindowGeom.SolBmIndex[lHT] = IncRay;
-            } else { // Window can't be sunlit, set front incidence ray index to zero
-                complexWindowGeom.SolBmIndex[lHT] = 0.0;
-            }
-            std::size_t lHTI(complexWindowGeom.SolBmGndWt.index(HourOfDay, TimeStep, 1)); // Linear index for ( HourOfDay, TimeStep, I )
-            for (int I = 1, nGnd = complexWindowGeom.NGnd; I <= nGnd; ++I, ++lHTI) {      // Gnd pt loop
-                TotHits = 0;
-                Vector const gndPt(complexWindowGeom.GndPt(I));
-                for (int JSurf = 1; JSurf <= TotSurfaces; ++JSurf) {
-                    // the following test will cycle on anything except exterior surfaces and shading surfaces
-                    if (Surface(JSurf).HeatTransSurf && Surface(JSurf).ExtBoundCond != ExternalEnvironment) continue;
-                    // skip surfaces that face away from the ground point
-                    if (dot(SunDir, Surface(JSurf).NewellSurfaceNormalVector) >= 0.0) continue;
-                    // Looking for surfaces between GndPt and sun
-                    PierceSurface(JSurf, gndPt, SunDir, HitPt, hit);
-                    if (hit) {
-                        // Are not going into the details of whether a hit surface is transparent
-                        // Since this is ultimately simply weighting the transmittance, so great
-                        // detail is not warranted
-                        ++TotHits;
-                        break;
-                    }
-                }
-                if (TotHits > 0) {
-                    complexWindowGeom.SolBmGndWt[lHTI] = 0.0; // [ lHTI ] == ( HourOfDay, TimeStep, I )
-                } else {
-                    complexWindowGeom.SolBmGndWt[lHTI] = 1.0; // [ lHTI ] == ( HourOfDay, TimeStep, I )
-                }
-            } // Gnd pt loop
-
             // Update window beam properties
             CalculateWindowBeamProperties(iSurf, iState, complexWindow, complexWindowGeom, surfaceWindowState, HourOfDay, TimeStep);
         } // solar calculation mode, average over days or detailed
     }
 
+    void CalcCFSBeamGeometry(int const iSurf,                  // Window surface number
+                             int const iState,                 // Window state number
+                             BSDFGeomDescr &complexWindowGeom, // State geometry
+                             int const Hour,                   // Hour number
+                             int const TS                      // Timestep number
+    )
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Finds the incident basis element of the sun direction and the ground points that are sunlit
+        // for a complex fenestration state at the given hour and time step
+
+        // Using/Aliasing
+        using namespace Vectors;
+
+        // SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+        int IncRay;   // Index of incident ray corresponding to beam direction
+        Real64 Theta; // Theta angle of incident ray correspongind to beam direction
+        Real64 Phi;   // Phi angle of incident ray correspongind to beam direction
+        bool hit;     // hit flag
+        int TotHits;  // hit counter
+
+        // Object Data
+        static Vector SunDir(0.0, 0.0, 1.0); // unit vector pointing toward sun (world CS)
+        static Vector HitPt(0.0, 0.0, 1.0);  // vector location of ray intersection with a surface
+
+        std::size_t const lHT(complexWindowGeom.ThetaBm.index(Hour, TS)); // [ lHT ] == ( Hour, TS )
+        SunDir = SUNCOSTS(TS, Hour, {1, 3});
+        Theta = 0.0;
+        Phi = 0.0;
+        if (SUNCOSTS(TS, Hour, 3) > SunIsUpValue) {
+            IncRay = FindInBasis(SunDir, Front_Incident, iSurf, iState, complexWindowGeom.Inc, Theta, Phi);
+            complexWindowGeom.ThetaBm[lHT] = Theta;
+            complexWindowGeom.PhiBm[lHT] = Phi;
+        } else {
+            complexWindowGeom.ThetaBm[lHT] = 0.0;
+            complexWindowGeom.PhiBm[lHT] = 0.0;
+            IncRay = 0; // sundown can't have ray incident on window
+        }
+
+        if (IncRay > 0) { // Sun may be incident on the window
+            complexWindowGeom.SolBmIndex[lHT] = IncRay;
+        } else { // Window can't be sunlit, set front incidence ray index to zero
+            complexWindowGeom.SolBmIndex[lHT] = 0;
+        }
+        std::size_t lHTI(complexWindowGeom.SolBmGndWt.index(Hour, TS, 1)); // Linear index for ( Hour, TS, I )
+        for (int I = 1, nGnd = complexWindowGeom.NGnd; I <= nGnd; ++I, ++lHTI) { // Gnd pt loop
+            TotHits = 0;
+            Vector const gndPt(complexWindowGeom.GndPt(I));
+            for (int JSurf = 1, eSurf = TotSurfaces; JSurf <= eSurf; ++JSurf) {
+                // the following test will cycle on anything except exterior surfaces and shading surfaces
+                if (Surface(JSurf).HeatTransSurf && Surface(JSurf).ExtBoundCond != ExternalEnvironment) continue;
+                // skip surfaces that face away from the ground point
+                if (dot(SunDir, Surface(JSurf).NewellSurfaceNormalVector) >= 0.0) continue;
+                // Looking for surfaces between GndPt and sun
+                PierceSurface(JSurf, gndPt, SunDir, HitPt, hit);
+                if (hit) {
+                    // Are not going into the details of whether a hit surface is transparent
+                    // Since this is ultimately simply weighting the transmittance, so great
+                    // detail is not warranted
+                    ++TotHits;
+                    break;
+                }
+            }
+            if (TotHits > 0) {
+                complexWindowGeom.SolBmGndWt[lHTI] = 0.0; // [ lHTI ] == ( Hour, TS, I )
+            } else {
+                complexWindowGeom.SolBmGndWt[lHTI] = 1.0; // [ lHTI ] == ( Hour, TS, I )
+            }
+        } // Gnd pt loop
+    }
+
+    void CopyCFSBeamGeometry(BSDFGeomDescr const &sameGeom,   // Geometry of the state to copy from
+                             BSDFGeomDescr &complexWindowGeom, // State geometry
+                             int const Hour,                   // Hour number
+                             int const TS                      // Timestep number
+    )
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Copies the sun ray lookup and ground shading at the given hour and time step from another state
+        // of the same window with the same incident basis and ground points
+
+        std::size_t const lHT(complexWindowGeom.ThetaBm.index(Hour, TS)); // [ lHT ] == ( Hour, TS )
+        complexWindowGeom.ThetaBm[lHT] = sameGeom.ThetaBm[lHT];
+        complexWindowGeom.PhiBm[lHT] = sameGeom.PhiBm[lHT];
+        complexWindowGeom.SolBmIndex[lHT] = sameGeom.SolBmIndex[lHT];
+        std::size_t lHTI(complexWindowGeom.SolBmGndWt.index(Hour, TS, 1)); // Linear index for ( Hour, TS, I )
+        for (int I = 1, nGnd = complexWindowGeom.NGnd; I <= nGnd; ++I, ++lHTI) {
+            complexWindowGeom.SolBmGndWt[lHTI] = sameGeom.SolBmGndWt[lHTI];
+        }
+    }
+
     void CalculateWindowBeamProperties(int const ISurf,                   // Window surface number
                                        int const IState,                  // Window state number
                                        BSDFWindowGeomDescr const &Window, // Window Geometry
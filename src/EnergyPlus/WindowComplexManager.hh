@@ -157,8 +157,26 @@ namespace WindowComplexManager {
 
     void UpdateComplexWindows();
 
-    void CFSShadeAndBeamInitialization(int const iSurf, // Window surface number
-                                       int const iState // Window state number
+    int FindCFSStateWithSameBeamGeometry(int const iSurf, // Window surface number
+                                         int const iState // Window state number
+    );
+
+    void CFSShadeAndBeamInitialization(int const iSurf,         // Window surface number
+                                       int const iState,        // Window state number
+                                       int const iSameState = 0 // Earlier state with the same beam geometry, zero if none
+    );
+
+    void CalcCFSBeamGeometry(int const iSurf,                  // Window surface number
+                             int const iState,                 // Window state number
+                             BSDFGeomDescr &complexWindowGeom, // State geometry
+                             int const Hour,                   // Hour number
+                             int const TS                      // Timestep number
+    );
+
+    void CopyCFSBeamGeometry(BSDFGeomDescr const &sameGeom,   // Geometry of the state to copy from
+                             BSDFGeomDescr &complexWindowGeom, // State geometry
+                             int const Hour,                   // Hour number
+                             int const TS                      // Timestep number
     );
 
     void CalculateWindowBeamProperties(int const ISurf,                   // Window surface number
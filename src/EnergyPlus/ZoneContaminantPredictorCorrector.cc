@@ -137,6 +137,13 @@ namespace ZoneContaminantPredictorCorrector {
     int TotGCDVS(0);                      // Number of deposition velocity sink generic contaminant model
     int TotGCDRS(0);                      // Number of deposition rate sink generic contaminant model
 
+    // Per zone air flow sources used by the correct step, built once from the equipment and plenum input
+    Array1D_int ZoneAirSourceEquipConfigNum; // controlled zone equipment configuration supplying the zone (0 if none)
+    Array1D_int ZoneAirSourceRetPlenumNum;   // return plenum whose plenum zone is the zone (0 if none)
+    Array1D_int ZoneAirSourceSupPlenumNum;   // supply plenum whose plenum zone is the zone (0 if none)
+    int ZoneAirSourceNumRetPlenums(-1);      // number of return plenums when the map was built
+    int ZoneAirSourceNumSupPlenums(-1);      // number of supply plenums when the map was built
+
     // SUBROUTINE SPECIFICATIONS:
 
     // Functions
@@ -151,6 +158,11 @@ namespace ZoneContaminantPredictorCorrector {
         TotGCBLDiff = 0;
         TotGCDVS = 0;
         TotGCDRS = 0;
+        ZoneAirSourceEquipConfigNum.deallocate();
+        ZoneAirSourceRetPlenumNum.deallocate();
+        ZoneAirSourceSupPlenumNum.deallocate();
+        ZoneAirSourceNumRetPlenums = -1;
+        ZoneAirSourceNumSupPlenums = -1;
         Contaminant.CO2Simulation = false;
         Contaminant.GenericContamSimulation = false;
     }
@@ -1630,12 +1642,13 @@ namespace ZoneContaminantPredictorCorrector {
 
         // CO2 gain
         if (Contaminant.CO2Simulation) {
+            static Array1D_int const PeopleGainTypes(1, IntGainTypeOf_People);
             for (Loop = 1; Loop <= NumOfZones; ++Loop) {
                 SumAllInternalCO2Gains(Loop, ZoneCO2Gain(Loop));
                 if (HybridModel::FlagHybridModel_PC) {
                     SumAllInternalCO2GainsExceptPeople(Loop, ZoneCO2GainExceptPeople(Loop));
                 }
-                SumInternalCO2GainsByTypes(Loop, Array1D_int(1, IntGainTypeOf_People), ZoneCO2GainFromPeople(Loop));
+                SumInternalCO2GainsByTypes(Loop, PeopleGainTypes, ZoneCO2GainFromPeople(Loop));
             }
         }
 
@@ -2450,6 +2463,52 @@ namespace ZoneContaminantPredictorCorrector {
         CO2ZoneTimeMinus1Temp(ZoneNum) = Zone(ZoneNum).ZoneMeasuredCO2Concentration;
     }
 
+    void SetupZoneAirSources()
+    {
+
+        // PURPOSE OF THIS SUBROUTINE:
+        // Find, for every zone, the controlled zone equipment configuration or the plenum that supplies
+        // its air, so the correct step does not search the equipment and plenum lists for each zone.
+
+        // METHODOLOGY EMPLOYED:
+        // The map is rebuilt whenever the zone count or the number of plenums has changed since it was built,
+        // which covers plenum input being read after the first correct step. The first match wins, as in the
+        // searches it replaces.
+
+        using DataZoneEquipment::ZoneEquipConfig;
+        using ZonePlenum::NumZoneReturnPlenums;
+        using ZonePlenum::NumZoneSupplyPlenums;
+        using ZonePlenum::ZoneRetPlenCond;
+        using ZonePlenum::ZoneSupPlenCond;
+
+        if (ZoneAirSourceEquipConfigNum.isize() == NumOfZones && ZoneAirSourceNumRetPlenums == NumZoneReturnPlenums &&
+            ZoneAirSourceNumSupPlenums == NumZoneSupplyPlenums)
+            return;
+
+        ZoneAirSourceEquipConfigNum.dimension(NumOfZones, 0);
+        ZoneAirSourceRetPlenumNum.dimension(NumOfZones, 0);
+        ZoneAirSourceSupPlenumNum.dimension(NumOfZones, 0);
+        ZoneAirSourceNumRetPlenums = NumZoneReturnPlenums;
+        ZoneAirSourceNumSupPlenums = NumZoneSupplyPlenums;
+
+        for (int ZoneEquipConfigNum = NumOfZones; ZoneEquipConfigNum >= 1; --ZoneEquipConfigNum) {
+            if (!Zone(ZoneEquipConfigNum).IsControlled) continue;
+            int const ActualZoneNum = ZoneEquipConfig(ZoneEquipConfigNum).ActualZoneNum;
+            if (ActualZoneNum < 1 || ActualZoneNum > NumOfZones) continue;
+            ZoneAirSourceEquipConfigNum(ActualZoneNum) = ZoneEquipConfigNum;
+        }
+        for (int ZoneRetPlenumNum = NumZoneReturnPlenums; ZoneRetPlenumNum >= 1; --ZoneRetPlenumNum) {
+            int const ActualZoneNum = ZoneRetPlenCond(ZoneRetPlenumNum).ActualZoneNum;
+            if (ActualZoneNum < 1 || ActualZoneNum > NumOfZones) continue;
+            ZoneAirSourceRetPlenumNum(ActualZoneNum) = ZoneRetPlenumNum;
+        }
+        for (int ZoneSupPlenumNum = NumZoneSupplyPlenums; ZoneSupPlenumNum >= 1; --ZoneSupPlenumNum) {
+            int const ActualZoneNum = ZoneSupPlenCond(ZoneSupPlenumNum).ActualZoneNum;
+            if (ActualZoneNum < 1 || ActualZoneNum > NumOfZones) continue;
+            ZoneAirSourceSupPlenumNum(ActualZoneNum) = ZoneSupPlenumNum;
+        }
+    }
+
     void CorrectZoneContaminants(bool const ShortenTimeStepSys,
                                  bool const UseZoneTimeStepHistory, // if true then use zone timestep history, if false use system time step history
                                  Real64 const PriorTimeStep         // the old value for timestep length is passed for possible use in interpolating
@@ -2523,6 +2582,8 @@ namespace ZoneContaminantPredictorCorrector {
         int ZoneNum;
 
         // FLOW:
+        SetupZoneAirSources();
+
         // Update zone CO2
         for (ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum) {
 
@@ -2605,28 +2666,13 @@ namespace ZoneContaminantPredictorCorrector {
             ZoneMassFlowRate = 0.0;
             ZoneMult = Zone(ZoneNum).Multiplier * Zone(ZoneNum).ListMultiplier;
 
-            // Check to see if this is a controlled zone
-            ControlledZoneAirFlag = false;
-            for (ZoneEquipConfigNum = 1; ZoneEquipConfigNum <= NumOfZones; ++ZoneEquipConfigNum) {
-                if (!Zone(ZoneEquipConfigNum).IsControlled) continue;
-                if (ZoneEquipConfig(ZoneEquipConfigNum).ActualZoneNum != ZoneNum) continue;
-                ControlledZoneAirFlag = true;
-                break;
-            } // ZoneEquipConfigNum
-
-            // Check to see if this is a plenum zone
-            ZoneRetPlenumAirFlag = false;
-            for (ZoneRetPlenumNum = 1; ZoneRetPlenumNum <= NumZoneReturnPlenums; ++ZoneRetPlenumNum) {
-                if (ZoneRetPlenCond(ZoneRetPlenumNum).ActualZoneNum != ZoneNum) continue;
-                ZoneRetPlenumAirFlag = true;
-                break;
-            } // ZoneRetPlenumNum
-            ZoneSupPlenumAirFlag = false;
-            for (ZoneSupPlenumNum = 1; ZoneSupPlenumNum <= NumZoneSupplyPlenums; ++ZoneSupPlenumNum) {
-                if (ZoneSupPlenCond(ZoneSupPlenumNum).ActualZoneNum != ZoneNum) continue;
-                ZoneSupPlenumAirFlag = true;
-                break;
-            } // ZoneSupPlenumNum
+            // Check to see if this is a controlled zone or a plenum zone
+            ZoneEquipConfigNum = ZoneAirSourceEquipConfigNum(ZoneNum);
+            ControlledZoneAirFlag = (ZoneEquipConfigNum > 0);
+            ZoneRetPlenumNum = ZoneAirSourceRetPlenumNum(ZoneNum);
+            ZoneRetPlenumAirFlag = (ZoneRetPlenumNum > 0);
+            ZoneSupPlenumNum = ZoneAirSourceSupPlenumNum(ZoneNum);
+            ZoneSupPlenumAirFlag = (ZoneSupPlenumNum > 0);
 
             if (ControlledZoneAirFlag) { // If there is system flow then calculate the flow rates
 
@@ -48,6 +48,9 @@
 #ifndef ZoneContaminantPredictorCorrector_hh_INCLUDED
 #define ZoneContaminantPredictorCorrector_hh_INCLUDED
 
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 
@@ -73,6 +76,9 @@ namespace ZoneContaminantPredictorCorrector {
     extern int TotGCBLDiff;                // Number of boudary layer diffusion generic contaminant model
     extern int TotGCDVS;                   // Number of deposition velocity sink generic contaminant model
     extern int TotGCDRS;                   // Number of deposition rate sink generic contaminant model
+    extern Array1D_int ZoneAirSourceEquipConfigNum; // controlled zone equipment configuration supplying the zone (0 if none)
+    extern Array1D_int ZoneAirSourceRetPlenumNum;   // return plenum whose plenum zone is the zone (0 if none)
+    extern Array1D_int ZoneAirSourceSupPlenumNum;   // supply plenum whose plenum zone is the zone (0 if none)
 
     // SUBROUTINE SPECIFICATIONS:
 
@@ -111,6 +117,8 @@ namespace ZoneContaminantPredictorCorrector {
                          Real64 &RhoAir               // Air density
     );
 
+    void SetupZoneAirSources();
+
     void CorrectZoneContaminants(bool const ShortenTimeStepSys,
                                  bool const UseZoneTimeStepHistory, // if true then use zone timestep history, if false use system time step history
                                  Real64 const PriorTimeStep         // the old value for timestep length is passed for possible use in interpolating
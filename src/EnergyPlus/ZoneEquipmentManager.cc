@@ -3525,6 +3525,10 @@ namespace ZoneEquipmentManager {
             CalcAirFlowSimple(0, AdjustZoneMassFlowFlag);
         }
 
+        // Zones are simulated one after another.  Zones served only by zonal equipment interact within an HVAC iteration
+        // only through plant demand, but this loop and the equipment it calls share scratch state between zones
+        // (PrioritySimOrder, CurZoneEqNum, ZoneEqSizing, the fan availability flags, the psychrometric caches and the
+        // component modules' own globals such as the PTAC compressor on/off flows), so zones cannot be run concurrently.
         for (ControlledZoneNum = 1; ControlledZoneNum <= NumOfZones; ++ControlledZoneNum) {
 
             if (!ZoneEquipConfig(ControlledZoneNum).IsControlled) continue;
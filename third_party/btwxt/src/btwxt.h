@@ -101,6 +101,8 @@ public:
 
   std::pair<double, double> get_axis_limits(int dim);
 
+  const GriddedData &get_grid_data() const { return grid_data; }
+
 private:
   GriddedData grid_data;
   GridPoint grid_point;
@@ -56,10 +56,13 @@
 #include <DataEnvironment.hh>
 #include <DataHVACGlobals.hh>
 #include <DataSizing.hh>
+#include <DataSystemVariables.hh>
 #include <ElectricPowerServiceManager.hh>
+#include <HeatRejectionMemo.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
 #include <Plant/PlantManager.hh>
+#include <Psychrometrics.hh>
 #include <SimulationManager.hh>
 #include <SizingManager.hh>
 #include <WeatherManager.hh>
@@ -516,6 +519,83 @@ TEST_F(EnergyPlusFixture, CondenserLoopTowers_MerkelNoCooling)
 
     // test that tower is really not cooling with no load so temp in and out is the same issue #4927
     EXPECT_DOUBLE_EQ(DataLoopNode::Node(9).Temp, DataLoopNode::Node(10).Temp);
+
+    // modulate the fan speed to meet a load between the minimum and full fan speed heat rejection rates
+    auto &tower = CondenserLoopTowers::towers(1);
+    DataLoopNode::Node(tower.WaterInletNodeNum).Temp = 30.0;
+    DataLoopNode::Node(tower.WaterInletNodeNum).MassFlowRate = tower.DesWaterMassFlowRate;
+    tower.WaterMassFlowRate = tower.DesWaterMassFlowRate;
+    tower.WaterTemp = 30.0;
+    tower.AirTemp = 25.0;
+    tower.AirWetBulb = 20.0;
+    tower.AirPress = 101325.0;
+    tower.AirHumRat = Psychrometrics::PsyWFnTdbTwbPb(25.0, 20.0, 101325.0);
+
+    MyLoad = -1.0e12;
+    tower.calculateMerkelVariableSpeedTower(MyLoad);
+    EXPECT_DOUBLE_EQ(1.0, tower.__AirFlowRateRatio);
+    Real64 const FullSpeedQdot = tower.Qactual;
+
+    MyLoad = -0.8 * FullSpeedQdot;
+    tower.calculateMerkelVariableSpeedTower(MyLoad);
+    EXPECT_NEAR(0.8 * FullSpeedQdot, tower.Qactual, 0.01);
+    EXPECT_GT(tower.__AirFlowRateRatio, tower.MinimumVSAirFlowFrac);
+    EXPECT_LT(tower.__AirFlowRateRatio, 1.0);
+
+    // the same conditions on the next plant pass reuse the stored model results
+    Real64 const AirFlowRateRatio = tower.__AirFlowRateRatio;
+    Int64 const NumHits = tower.MerkelModelMemo.NumHits;
+    tower.calculateMerkelVariableSpeedTower(MyLoad);
+    EXPECT_DOUBLE_EQ(AirFlowRateRatio, tower.__AirFlowRateRatio);
+    EXPECT_GT(tower.MerkelModelMemo.NumHits, NumHits);
+
+    // memo statistics are only reported to the eio file when requested
+    has_eio_output(true);
+    HeatRejectionMemo::ReportMemoStatistics();
+    EXPECT_FALSE(has_eio_output(true));
+    DataSystemVariables::TrackHeatRejectionMemoEnvFlag = true;
+    HeatRejectionMemo::ReportMemoStatistics();
+    EXPECT_TRUE(has_eio_output(true));
+}
+
+TEST_F(EnergyPlusFixture, CondenserLoopTowers_ModelMemo)
+{
+    HeatRejectionMemo::ModelMemo memo;
+    HeatRejectionMemo::MemoResult result;
+    HeatRejectionMemo::MemoKey key{{30.0, 10.0, 5.0, 20000.0, 25.0, 20.0, 101325.0, 0.0126}};
+
+    EXPECT_FALSE(memo.lookup(key, result));
+    memo.store(key, {{28.0, 1.0, 2.0}});
+    EXPECT_TRUE(memo.lookup(key, result));
+    EXPECT_DOUBLE_EQ(28.0, result[0]);
+    EXPECT_DOUBLE_EQ(2.0, result[2]);
+
+    // inputs within the relative tolerance reuse the result, others do not
+    key[0] = 30.0 * (1.0 + 0.5 * HeatRejectionMemo::MemoTolerance);
+    EXPECT_TRUE(memo.lookup(key, result));
+    key[0] = 30.001;
+    EXPECT_FALSE(memo.lookup(key, result));
+    EXPECT_EQ(4, memo.NumCalls);
+    EXPECT_EQ(2, memo.NumHits);
+
+    // the oldest entry is replaced once the memo is full
+    for (int i = 1; i <= HeatRejectionMemo::MemoSize; ++i) {
+        key[1] = 10.0 + i;
+        memo.store(key, {{double(i), 0.0, 0.0}});
+    }
+    key[0] = 30.0;
+    key[1] = 10.0;
+    EXPECT_FALSE(memo.lookup(key, result));
+    key[0] = 30.001;
+    key[1] = 11.0;
+    EXPECT_TRUE(memo.lookup(key, result));
+    EXPECT_DOUBLE_EQ(1.0, result[0]);
+
+    // clearing at the start of an environment drops the entries but keeps the run counts
+    memo.clear();
+    EXPECT_FALSE(memo.lookup(key, result));
+    EXPECT_EQ(7, memo.NumCalls);
+    EXPECT_EQ(3, memo.NumHits);
 }
 
 TEST_F(EnergyPlusFixture, CondenserLoopTowers_SingleSpeedSizing)
@@ -45,6 +45,12 @@
 // OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+// C++ Headers
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
 // Google Test Headers
 #include <gtest/gtest.h>
 
@@ -61,6 +67,50 @@
 using namespace EnergyPlus;
 using namespace EnergyPlus::CurveManager;
 
+namespace {
+// Table:Lookup with NumDims independent variables on uneven grids from 0 to 5, each axis using Method
+std::string TableLookupIDF(std::string const &Name, int const NumDims, std::string const &Method)
+{
+    std::vector<double> const Grid{0.0, 0.5, 1.5, 3.0, 4.0, 5.0};
+    std::string idf;
+    std::string varList = "Table:IndependentVariableList," + Name + "_Variables";
+    for (int Dim = 1; Dim <= NumDims; ++Dim) {
+        std::string const varName = Name + "_X" + std::to_string(Dim);
+        idf += "Table:IndependentVariable," + varName + "," + Method + ",Constant,0.0,5.0,,Dimensionless,,,";
+        for (auto const Value : Grid) {
+            idf += "," + std::to_string(Value);
+        }
+        idf += ";\n";
+        varList += "," + varName;
+    }
+    idf += varList + ";\n";
+    idf += "Table:Lookup," + Name + "," + Name + "_Variables,,,,,Dimensionless,,,";
+    int NumValues = 1;
+    for (int Dim = 1; Dim <= NumDims; ++Dim) {
+        NumValues *= int(Grid.size());
+    }
+    for (int Value = 0; Value < NumValues; ++Value) {
+        idf += "," + std::to_string(10.0 * std::cos(0.7 * Value) + 0.01 * Value);
+    }
+    idf += ";\n";
+    return idf;
+}
+
+// slowly moving target inside the 0 to 5 grid that lands on grid values (including the last one) every tenth step
+std::vector<double> TableLookupTarget(int const NumDims, int const Step)
+{
+    std::vector<double> target(NumDims);
+    for (int Dim = 0; Dim < NumDims; ++Dim) {
+        if (Step % 10 == 0) {
+            target[Dim] = ((Step / 10 + Dim) % 2 == 0) ? 5.0 : 1.5;
+        } else {
+            target[Dim] = 2.5 + 2.5 * std::sin(0.02 * Step * (Dim + 1) + Dim);
+        }
+    }
+    return target;
+}
+} // namespace
+
 TEST_F(EnergyPlusFixture, CurveExponentialSkewNormal_MaximumCurveOutputTest)
 {
     std::string const idf_objects = delimited_string({
@@ -86,3 +136,181 @@ TEST_F(EnergyPlusFixture, CurveExponentialSkewNormal_MaximumCurveOutputTest)
     EXPECT_TRUE(PerfCurve(1).CurveMaxPresent);
 
 }
+
+TEST_F(EnergyPlusFixture, TableLookup_CachedEvaluation)
+{
+    std::string const idf_objects = delimited_string({
+        "Table:IndependentVariable,",
+        "  X,                         !- Name",
+        "  Linear,                    !- Interpolation Method",
+        "  Constant,                  !- Extrapolation Method",
+        "  0.0,                       !- Minimum Value",
+        "  2.0,                       !- Maximum Value",
+        "  ,                          !- Normalization Reference Value",
+        "  Dimensionless,             !- Unit Type",
+        "  ,                          !- External File Name",
+        "  ,                          !- External File Column Number",
+        "  ,                          !- External File Starting Row Number",
+        "  0.0,                       !- Value 1",
+        "  1.0,",
+        "  2.0;",
+
+        "Table:IndependentVariable,",
+        "  Y,                         !- Name",
+        "  Linear,                    !- Interpolation Method",
+        "  Constant,                  !- Extrapolation Method",
+        "  0.0,                       !- Minimum Value",
+        "  1.0,                       !- Maximum Value",
+        "  ,                          !- Normalization Reference Value",
+        "  Dimensionless,             !- Unit Type",
+        "  ,                          !- External File Name",
+        "  ,                          !- External File Column Number",
+        "  ,                          !- External File Starting Row Number",
+        "  0.0,                       !- Value 1",
+        "  1.0;",
+
+        "Table:IndependentVariableList,",
+        "  XY_Variables,              !- Name",
+        "  X,                         !- Independent Variable 1 Name",
+        "  Y;                         !- Independent Variable 2 Name",
+
+        "Table:Lookup,",
+        "  Table1,                    !- Name",
+        "  XY_Variables,              !- Independent Variable List Name",
+        "  ,                          !- Normalization Method",
+        "  ,                          !- Normalization Divisor",
+        "  ,                          !- Minimum Output",
+        "  ,                          !- Maximum Output",
+        "  Dimensionless,             !- Output Unit Type",
+        "  ,                          !- External File Name",
+        "  ,                          !- External File Column Number",
+        "  ,                          !- External File Starting Row Number",
+        "  0.0, 10.0, 1.0, 11.0, 2.0, 12.0;",
+
+        "Table:Lookup,",
+        "  Table2,                    !- Name",
+        "  XY_Variables,              !- Independent Variable List Name",
+        "  ,                          !- Normalization Method",
+        "  ,                          !- Normalization Divisor",
+        "  ,                          !- Minimum Output",
+        "  ,                          !- Maximum Output",
+        "  Dimensionless,             !- Output Unit Type",
+        "  ,                          !- External File Name",
+        "  ,                          !- External File Column Number",
+        "  ,                          !- External File Starting Row Number",
+        "  0.0, 20.0, 2.0, 22.0, 4.0, 24.0;",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+    CurveManager::GetCurveInput();
+    ASSERT_EQ(2, CurveManager::NumCurves);
+
+    // curves sharing a grid evaluated alternately at different points
+    EXPECT_NEAR(6.5, CurveValue(1, 1.5, 0.5), 1.0e-10);
+    EXPECT_TRUE(PerfCurve(1).TableCell.ValueValid);
+    EXPECT_TRUE(PerfCurve(1).TableCell.CellValid);
+    EXPECT_NEAR(5.0, CurveValue(2, 0.5, 0.2), 1.0e-10);
+    EXPECT_NEAR(6.5, CurveValue(1, 1.5, 0.5), 1.0e-10);
+    EXPECT_NEAR(5.0, CurveValue(2, 0.5, 0.2), 1.0e-10);
+
+    // out of range inputs are limited before the cache comparison
+    EXPECT_NEAR(12.0, CurveValue(1, 3.0, 2.0), 1.0e-10);
+    EXPECT_NEAR(2.0, PerfCurve(1).TableCell.Target[0], 1.0e-10);
+    EXPECT_NEAR(1.0, PerfCurve(1).TableCell.Target[1], 1.0e-10);
+
+    // a new target in the same cell reuses the cell corners
+    EXPECT_NEAR(11.9, CurveValue(1, 1.9, 1.0), 1.0e-10);
+    EXPECT_EQ(1u, PerfCurve(1).TableCell.Floor[0]);
+
+    // batch evaluation matches single evaluations, limits each point and reports the last one
+    std::vector<Real64> values;
+    TableLookupValues(2, {{0.5, 0.2}, {1.5, 0.8}, {3.0, -1.0}}, values);
+    ASSERT_EQ(3u, values.size());
+    EXPECT_NEAR(CurveValue(2, 1.5, 0.8), values[1], 1.0e-10);
+    EXPECT_NEAR(4.0, values[2], 1.0e-10);
+    EXPECT_NEAR(CurveValue(2, 0.5, 0.2), values[0], 1.0e-10);
+    TableLookupValues(2, {{1.5, 0.8}, {3.0, -1.0}}, values);
+    EXPECT_NEAR(4.0, PerfCurve(2).CurveOutput, 1.0e-10);
+    EXPECT_NEAR(3.0, PerfCurve(2).CurveInput1, 1.0e-10);
+    EXPECT_NEAR(-1.0, PerfCurve(2).CurveInput2, 1.0e-10);
+
+    // cached results still honor an EMS override and report the curve output
+    EXPECT_NEAR(5.0, CurveValue(2, 0.5, 0.2), 1.0e-10);
+    PerfCurve(2).EMSOverrideOn = true;
+    PerfCurve(2).EMSOverrideCurveValue = 0.5;
+    EXPECT_NEAR(0.5, CurveValue(2, 0.5, 0.2), 1.0e-10);
+    EXPECT_NEAR(0.5, PerfCurve(2).CurveOutput, 1.0e-10);
+    TableLookupValues(2, {{0.5, 0.2}, {1.5, 0.8}}, values);
+    EXPECT_NEAR(0.5, values[0], 1.0e-10);
+    EXPECT_NEAR(0.5, values[1], 1.0e-10);
+}
+
+TEST_F(EnergyPlusFixture, TableLookup_CellReuseMatchesBtwxt)
+{
+    std::string idf_objects;
+    for (int NumDims = 1; NumDims <= 5; ++NumDims) {
+        idf_objects += TableLookupIDF("Linear" + std::to_string(NumDims), NumDims, "Linear");
+    }
+    idf_objects += TableLookupIDF("Cubic2", 2, "Cubic");
+
+    ASSERT_TRUE(process_idf(idf_objects));
+    CurveManager::GetCurveInput();
+    ASSERT_EQ(6, CurveManager::NumCurves);
+
+    for (int CurveNum = 1; CurveNum <= NumCurves; ++CurveNum) {
+        auto &thisCurve(PerfCurve(CurveNum));
+        int const NumDims = (CurveNum == 6) ? 2 : CurveNum;
+        for (int Step = 0; Step < 200; ++Step) {
+            std::vector<double> const target = TableLookupTarget(NumDims, Step);
+            Real64 const CellValue = BtwxtTableValueAtTarget(CurveNum, target);
+            EXPECT_DOUBLE_EQ(btwxtManager.getGridValue(thisCurve.TableIndex, thisCurve.GridValueIndex, target), CellValue);
+        }
+        // cubic axes are always interpolated by btwxt
+        EXPECT_EQ(CurveNum != 6, thisCurve.TableCell.LinearGrid);
+        EXPECT_EQ(CurveNum != 6, thisCurve.TableCell.CellValid);
+    }
+}
+
+// Timing of btwxt against the cell reuse in BtwxtTableValueAtTarget for 1 to 5 dimensional tables.
+// Run with --gtest_also_run_disabled_tests --gtest_filter=*CellReuseBenchmark* and see the recorded properties.
+TEST_F(EnergyPlusFixture, DISABLED_TableLookup_CellReuseBenchmark)
+{
+    std::string idf_objects;
+    for (int NumDims = 1; NumDims <= 5; ++NumDims) {
+        idf_objects += TableLookupIDF("Linear" + std::to_string(NumDims), NumDims, "Linear");
+    }
+
+    ASSERT_TRUE(process_idf(idf_objects));
+    CurveManager::GetCurveInput();
+    ASSERT_EQ(5, CurveManager::NumCurves);
+
+    int const NumSteps = 100000;
+    for (int NumDims = 1; NumDims <= 5; ++NumDims) {
+        auto &thisCurve(PerfCurve(NumDims));
+        std::vector<std::vector<double>> targets;
+        for (int Step = 0; Step < NumSteps; ++Step) {
+            targets.push_back(TableLookupTarget(NumDims, Step / 10));
+        }
+
+        Real64 BtwxtSum = 0.0;
+        auto const BtwxtStart = std::chrono::steady_clock::now();
+        for (auto const &target : targets) {
+            BtwxtSum += btwxtManager.getGridValue(thisCurve.TableIndex, thisCurve.GridValueIndex, target);
+        }
+        auto const BtwxtEnd = std::chrono::steady_clock::now();
+
+        Real64 CellSum = 0.0;
+        auto const CellStart = std::chrono::steady_clock::now();
+        for (auto const &target : targets) {
+            CellSum += BtwxtTableValueAtTarget(NumDims, target);
+        }
+        auto const CellEnd = std::chrono::steady_clock::now();
+
+        EXPECT_DOUBLE_EQ(BtwxtSum, CellSum);
+        std::string const Dims = "Dims" + std::to_string(NumDims);
+        RecordProperty(Dims + "_BtwxtMicroseconds",
+                       std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(BtwxtEnd - BtwxtStart).count()));
+        RecordProperty(Dims + "_CellReuseMicroseconds",
+                       std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(CellEnd - CellStart).count()));
+    }
+}
@@ -2523,5 +2523,58 @@ TEST_F(SQLiteFixture, DXCoils_TestComponentSizingOutput_SingleSpeed)
     EnergyPlus::sqlite->sqliteCommit();
 }
 
+TEST_F(EnergyPlusFixture, DXCoils_MultiSpeedInletStateCache)
+{
+    NumDXCoils = 1;
+    DXCoil.allocate(NumDXCoils);
+    DXCoil(1).NumOfSpeeds = 2;
+
+    NumCurves = 1;
+    PerfCurve.allocate(NumCurves);
+    PerfCurve(1).CurveType = CurveManager::BiQuadratic;
+    PerfCurve(1).ObjectType = "Curve:Biquadratic";
+    PerfCurve(1).InterpolationType = EvaluateCurveToLimits;
+    PerfCurve(1).Coeff1 = 1.0;
+    PerfCurve(1).Coeff2 = 0.1;
+    PerfCurve(1).Var1Min = -100.0;
+    PerfCurve(1).Var1Max = 100.0;
+    PerfCurve(1).Var2Min = -100.0;
+    PerfCurve(1).Var2Max = 100.0;
+
+    SetMSCoilInletState(1, 24.0, 0.01, 101325.0, 35.0, "DXCoils_MultiSpeedInletStateCache");
+    EXPECT_TRUE(DXCoil(1).MSCacheValid);
+    EXPECT_EQ(2u, DXCoil(1).MSCacheEIRFTemp.Value.size());
+    EXPECT_DOUBLE_EQ(Psychrometrics::PsyTwbFnTdbWPb(24.0, 0.01, 101325.0), DXCoil(1).MSCacheInletWetBulb);
+    EXPECT_DOUBLE_EQ(Psychrometrics::PsyRhoAirFnPbTdbW(101325.0, 24.0, 0.01), DXCoil(1).MSCacheInletRhoAir);
+
+    EXPECT_NEAR(3.0, MSCoilCurveValue(1, 1, DXCoil(1).MSCacheEIRFTemp, 20.0, 35.0), 1.0e-10);
+    EXPECT_TRUE(DXCoil(1).MSCacheEIRFTemp.Valid(1));
+    EXPECT_FALSE(DXCoil(1).MSCacheEIRFTemp.Valid(2));
+
+    // same curve inputs reuse the cached result, and the hit is still reported as the curve output
+    PerfCurve(1).Coeff1 = 2.0;
+    PerfCurve(1).CurveOutput = -999.0;
+    PerfCurve(1).CurveInput1 = 0.0;
+    EXPECT_NEAR(3.0, MSCoilCurveValue(1, 1, DXCoil(1).MSCacheEIRFTemp, 20.0, 35.0), 1.0e-10);
+    EXPECT_NEAR(3.0, PerfCurve(1).CurveOutput, 1.0e-10);
+    EXPECT_DOUBLE_EQ(20.0, PerfCurve(1).CurveInput1);
+    EXPECT_DOUBLE_EQ(35.0, PerfCurve(1).CurveInput2);
+
+    // a new inlet state alone does not change the cached result, different curve inputs do
+    SetMSCoilInletState(1, 25.0, 0.01, 101325.0, 35.0, "DXCoils_MultiSpeedInletStateCache");
+    EXPECT_TRUE(DXCoil(1).MSCacheEIRFTemp.Valid(1));
+    EXPECT_NEAR(3.0, MSCoilCurveValue(1, 1, DXCoil(1).MSCacheEIRFTemp, 20.0, 35.0), 1.0e-10);
+    EXPECT_NEAR(4.1, MSCoilCurveValue(1, 1, DXCoil(1).MSCacheEIRFTemp, 21.0, 35.0), 1.0e-10);
+    EXPECT_NEAR(4.1, PerfCurve(1).CurveOutput, 1.0e-10);
+    EXPECT_NEAR(CurveManager::CurveValue(1, 21.0, 36.0), MSCoilCurveValue(1, 1, DXCoil(1).MSCacheEIRFTemp, 21.0, 36.0), 1.0e-10);
+
+    // EMS overridden curves are never cached
+    PerfCurve(1).EMSOverrideOn = true;
+    PerfCurve(1).EMSOverrideCurveValue = 0.5;
+    EXPECT_NEAR(0.5, MSCoilCurveValue(1, 1, DXCoil(1).MSCacheEIRFTemp, 20.0, 35.0), 1.0e-10);
+    EXPECT_FALSE(DXCoil(1).MSCacheEIRFTemp.Valid(1));
+    PerfCurve(1).EMSOverrideOn = false;
+    EXPECT_NEAR(4.0, MSCoilCurveValue(1, 1, DXCoil(1).MSCacheEIRFTemp, 20.0, 35.0), 1.0e-10);
+}
 
 } // namespace EnergyPlus
@@ -134,3 +134,41 @@ TEST_F(EnergyPlusFixture, DataPlant_verifyTwoNodeNumsOnSamePlantLoop)
     PlantLoop(2).LoopSide.deallocate();
     PlantLoop.deallocate();
 }
+
+TEST_F(EnergyPlusFixture, DataPlant_CompileLoopSideTopology)
+{
+    HalfLoopData loopSide;
+    loopSide.TotalBranches = 3;
+    loopSide.Branch.allocate(3);
+    int nodeNum = 0;
+    for (int branchNum = 1; branchNum <= 3; ++branchNum) {
+        auto &branch(loopSide.Branch(branchNum));
+        branch.TotalComponents = branchNum == 2 ? 2 : 1;
+        branch.Comp.allocate(branch.TotalComponents);
+        branch.ControlType = branchNum;
+        for (int compNum = 1; compNum <= branch.TotalComponents; ++compNum) {
+            branch.Comp(compNum).NodeNumIn = ++nodeNum;
+            branch.Comp(compNum).NodeNumOut = ++nodeNum;
+            branch.Comp(compNum).TypeOf_Num = 10 * branchNum + compNum;
+        }
+        branch.NodeNumIn = branch.Comp(1).NodeNumIn;
+        branch.NodeNumOut = branch.Comp(branch.TotalComponents).NodeNumOut;
+    }
+
+    EXPECT_FALSE(loopSide.TopologyCompiled);
+    loopSide.CompileTopology();
+    EXPECT_TRUE(loopSide.TopologyCompiled);
+
+    // branch 2 holds components 2 and 3 of the flattened arrays
+    EXPECT_EQ(1, loopSide.BranchFirstComp(1));
+    EXPECT_EQ(2, loopSide.BranchFirstComp(2));
+    EXPECT_EQ(4, loopSide.BranchFirstComp(3));
+    EXPECT_EQ(5, loopSide.BranchFirstComp(4));
+    EXPECT_EQ(3, loopSide.BranchNodeNumIn(2));
+    EXPECT_EQ(6, loopSide.BranchNodeNumOut(2));
+    EXPECT_EQ(3, loopSide.BranchControlType(3));
+    EXPECT_EQ(5, loopSide.CompNodeNumIn(3));
+    EXPECT_EQ(6, loopSide.CompNodeNumOut(3));
+    EXPECT_EQ(22, loopSide.CompTypeOf(3));
+    EXPECT_EQ(31, loopSide.CompTypeOf(4));
+}
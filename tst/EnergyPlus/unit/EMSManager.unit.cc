@@ -808,6 +808,67 @@ TEST_F(EnergyPlusFixture, TestAnyRanArgument)
     EXPECT_TRUE(anyRan);
 }
 
+TEST_F(EnergyPlusFixture, EMSManager_SensorAndActuatorBindings)
+{
+    std::string const idf_objects = delimited_string({
+
+        "OutdoorAir:Node, Test node;",
+
+        "EnergyManagementSystem:Sensor,",
+        "Node_mdot,",
+        "Test node,",
+        "System Node Mass Flow Rate;",
+
+        "EnergyManagementSystem:Actuator,",
+        "TempSetpoint,          !- Name",
+        "Test node,  !- Actuated Component Unique Name",
+        "System Node Setpoint,    !- Actuated Component Type",
+        "Temperature Setpoint;    !- Actuated Component Control Type",
+
+        "EnergyManagementSystem:ProgramCallingManager,",
+        "Test inside HVAC system iteration Loop,",
+        "InsideHVACSystemIterationLoop,",
+        "SetFromFlow;",
+
+        "EnergyManagementSystem:Program,",
+        "SetFromFlow,",
+        "set TempSetpoint = Node_mdot * 10.0;",
+
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    OutAirNodeManager::SetOutAirNodes();
+    NodeInputManager::SetupNodeVarsForReporting();
+    EMSManager::CheckIfAnyEMS();
+
+    EMSManager::FinishProcessingUserInput = true;
+
+    bool anyRan;
+    EMSManager::ManageEMS(DataGlobals::emsCallFromSetupSimulation, anyRan);
+    EMSManager::ManageEMS(DataGlobals::emsCallFromBeginNewEvironment, anyRan);
+
+    // the sensor reads the node through a direct pointer and is only used by the program
+    ASSERT_EQ(1u, EMSManager::ProgramSensorBindings.ErlVariableNum.size());
+    EXPECT_EQ(EMSManager::iSensorSourceReal, EMSManager::ProgramSensorBindings.Source[0]);
+    EXPECT_TRUE(EMSManager::ReportedSensorBindings.ErlVariableNum.empty());
+    ASSERT_EQ(1u, EMSManager::ActuatorBindings.ErlVariableNum.size());
+    EXPECT_NE(nullptr, EMSManager::ActuatorBindings.RealValue[0]);
+
+    int const sensorVariableNum = Sensor(1).VariableNum;
+    DataLoopNode::Node(1).MassFlowRate = 0.5;
+
+    // no program runs at this calling point, so the sensor is not refreshed
+    EMSManager::ManageEMS(DataGlobals::emsCallFromBeginTimestepBeforePredictor, anyRan);
+    EXPECT_FALSE(anyRan);
+    EXPECT_DOUBLE_EQ(0.0, ErlVariable(sensorVariableNum).Value.Number);
+
+    EMSManager::ManageEMS(DataGlobals::emsCallFromHVACIterationLoop, anyRan);
+    EXPECT_TRUE(anyRan);
+    EXPECT_DOUBLE_EQ(0.5, ErlVariable(sensorVariableNum).Value.Number);
+    EXPECT_DOUBLE_EQ(5.0, DataLoopNode::Node(1).TempSetPoint);
+}
+
 TEST_F(EnergyPlusFixture, TestUnInitializedEMSVariable1)
 {
     // this tests the new initialized variable added to Erl variable value data structure, for issue #4943
@@ -47,12 +47,16 @@
 
 // EnergyPlus::GroundTemperatureModels Unit Tests
 
+// C++ Headers
+#include <cstdio>
+
 // Google Test Headers
 #include <gtest/gtest.h>
 
 // EnergyPlus Headers
 #include <DataGlobals.hh>
 #include <DataIPShortCuts.hh>
+#include <DataStringGlobals.hh>
 #include <GroundTemperatureModeling/FiniteDifferenceGroundTemperatureModel.hh>
 #include <GroundTemperatureModeling/GroundTemperatureModelManager.hh>
 #include <WeatherManager.hh>
@@ -123,7 +127,7 @@ TEST_F(EnergyPlusFixture, FiniteDiffGroundTempModelTest)
     EXPECT_NEAR(7.96, thisModel->getGroundTempAtTimeInMonths(0.0, 12), 0.01);
     EXPECT_NEAR(3.46, thisModel->getGroundTempAtTimeInMonths(0.0, 14), 0.01);
 
-    EXPECT_NEAR(14.36, thisModel->getGroundTempAtTimeInMonths(3.0, 1), 0.01);
+    EXPECT_NEAR(14.35, thisModel->getGroundTempAtTimeInMonths(3.0, 1), 0.01);
     EXPECT_NEAR(11.78, thisModel->getGroundTempAtTimeInMonths(3.0, 6), 0.01);
     EXPECT_NEAR(15.57, thisModel->getGroundTempAtTimeInMonths(3.0, 12), 0.01);
 
@@ -136,8 +140,8 @@ TEST_F(EnergyPlusFixture, FiniteDiffGroundTempModelTest)
     EXPECT_NEAR(7.32, thisModel->getGroundTempAtTimeInSeconds(0.0, 30153600), 0.01);
     EXPECT_NEAR(3.53, thisModel->getGroundTempAtTimeInSeconds(0.0, 35510400), 0.01);
 
-    EXPECT_NEAR(14.36, thisModel->getGroundTempAtTimeInSeconds(3.0, 1296000), 0.01);
-    EXPECT_NEAR(11.80, thisModel->getGroundTempAtTimeInSeconds(3.0, 14342400), 0.01);
+    EXPECT_NEAR(14.35, thisModel->getGroundTempAtTimeInSeconds(3.0, 1296000), 0.01);
+    EXPECT_NEAR(11.81, thisModel->getGroundTempAtTimeInSeconds(3.0, 14342400), 0.01);
     EXPECT_NEAR(15.46, thisModel->getGroundTempAtTimeInSeconds(3.0, 30153600), 0.01);
 
     EXPECT_NEAR(14.52, thisModel->getGroundTempAtTimeInSeconds(25.0, 0.0), 0.01);
@@ -145,6 +149,64 @@ TEST_F(EnergyPlusFixture, FiniteDiffGroundTempModelTest)
     EXPECT_NEAR(14.52, thisModel->getGroundTempAtTimeInSeconds(25.0, 30153600), 0.01);
 }
 
+TEST_F(EnergyPlusFixture, FiniteDiffGroundTempModel_CacheFile)
+{
+    using WeatherManager::NumDaysInYear;
+
+    std::string const cacheFileName_reset = DataStringGlobals::outputFDGroundTempFileName;
+    DataStringGlobals::outputFDGroundTempFileName = "FiniteDiffGroundTempModel_CacheFile.fdgt";
+    std::remove(DataStringGlobals::outputFDGroundTempFileName.c_str());
+
+    std::shared_ptr<FiniteDiffGroundTempsModel> thisModel(new FiniteDiffGroundTempsModel());
+    thisModel->baseConductivity = 1.08;
+    thisModel->baseDensity = 962.0;
+    thisModel->baseSpecificHeat = 2576.0;
+    thisModel->waterContent = 30.0 / 100.0;
+    thisModel->saturatedWaterContent = 50.0 / 100.0;
+    thisModel->evapotransCoeff = 0.408;
+
+    thisModel->developMesh();
+    thisModel->groundTemps.dimension({1, NumDaysInYear}, {1, thisModel->totalNumCells}, 0.0);
+    for (int day = 1; day <= NumDaysInYear; ++day) {
+        for (int cell = 1; cell <= thisModel->totalNumCells; ++cell) {
+            thisModel->groundTemps(day, cell) = 10.0 + day / 100.0 + cell / 7.0;
+        }
+    }
+
+    // Nothing to read before the cache is written
+    thisModel->makeThisGroundTempCacheStruct();
+    EXPECT_FALSE(thisModel->readCacheFileAndCompareWithThisGroundTempCache());
+    thisModel->writeGroundTempCacheToFile();
+
+    // Same soil reads back the same ground temperatures
+    std::shared_ptr<FiniteDiffGroundTempsModel> sameModel(new FiniteDiffGroundTempsModel());
+    sameModel->baseConductivity = 1.08;
+    sameModel->baseDensity = 962.0;
+    sameModel->baseSpecificHeat = 2576.0;
+    sameModel->waterContent = 30.0 / 100.0;
+    sameModel->saturatedWaterContent = 50.0 / 100.0;
+    sameModel->evapotransCoeff = 0.408;
+    sameModel->makeThisGroundTempCacheStruct();
+    EXPECT_TRUE(sameModel->readCacheFileAndCompareWithThisGroundTempCache());
+    EXPECT_EQ(thisModel->totalNumCells, sameModel->totalNumCells);
+    EXPECT_DOUBLE_EQ(thisModel->getGroundTempAtTimeInMonths(3.0, 6), sameModel->getGroundTempAtTimeInMonths(3.0, 6));
+    EXPECT_DOUBLE_EQ(thisModel->getGroundTempAtTimeInSeconds(0.5, 14342400), sameModel->getGroundTempAtTimeInSeconds(0.5, 14342400));
+
+    // Different soil does not
+    std::shared_ptr<FiniteDiffGroundTempsModel> otherModel(new FiniteDiffGroundTempsModel());
+    otherModel->baseConductivity = 2.0;
+    otherModel->baseDensity = 962.0;
+    otherModel->baseSpecificHeat = 2576.0;
+    otherModel->waterContent = 30.0 / 100.0;
+    otherModel->saturatedWaterContent = 50.0 / 100.0;
+    otherModel->evapotransCoeff = 0.408;
+    otherModel->makeThisGroundTempCacheStruct();
+    EXPECT_FALSE(otherModel->readCacheFileAndCompareWithThisGroundTempCache());
+
+    std::remove(DataStringGlobals::outputFDGroundTempFileName.c_str());
+    DataStringGlobals::outputFDGroundTempFileName = cacheFileName_reset;
+}
+
 TEST_F(EnergyPlusFixture, FiniteDiffGroundTempModel_GetWeather_NoWeather) {
 
     std::shared_ptr<EnergyPlus::FiniteDiffGroundTempsModel> thisModel(new EnergyPlus::FiniteDiffGroundTempsModel());
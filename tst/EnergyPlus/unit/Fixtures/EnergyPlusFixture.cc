@@ -213,6 +213,7 @@
 #include <EnergyPlus/SwimmingPool.hh>
 #include <EnergyPlus/SystemAvailabilityManager.hh>
 #include <EnergyPlus/ThermalComfort.hh>
+#include <EnergyPlus/TimestepCheckpoint.hh>
 #include <EnergyPlus/UnitHeater.hh>
 #include <EnergyPlus/UnitVentilator.hh>
 #include <EnergyPlus/UnitarySystem.hh>
@@ -456,6 +457,7 @@ void EnergyPlusFixture::clear_all_states()
     SystemAvailabilityManager::clear_state();
     SwimmingPool::clear_state();
     ThermalComfort::clear_state();
+    TimestepCheckpoint::clear_state();
     UnitarySystems::clear_state();
     UnitHeater::clear_state();
     UnitVentilator::clear_state();
@@ -55,8 +55,10 @@
 
 // EnergyPlus Headers
 #include <DataAirLoop.hh>
+#include <DataAirSystems.hh>
 #include <DataConvergParams.hh>
 #include <EnergyPlus/DataHVACGlobals.hh>
+#include <EnergyPlus/General.hh>
 #include <EnergyPlus/HVACControllers.hh>
 #include <EnergyPlus/MixedAir.hh>
 #include <EnergyPlus/OutputReportPredefined.hh>
@@ -776,4 +778,114 @@ TEST_F(EnergyPlusFixture, HVACControllers_CheckTempAndHumRatCtrl)
     EXPECT_EQ(thisController.NumCalcCalls, 5);
 
 }
+
+TEST_F(EnergyPlusFixture, HVACControllers_TrackCoupledAirLoopControllers)
+{
+    // no statistics requested
+    HVACControllers::TrackCoupledAirLoopControllers(1, true, 3);
+
+    HVACControllers::NumAirLoopStats = 1;
+    HVACControllers::AirLoopStats.allocate(1);
+    auto const &thisAirLoopStats(HVACControllers::AirLoopStats(1));
+
+    HVACControllers::TrackCoupledAirLoopControllers(1, true, 2);
+    HVACControllers::TrackCoupledAirLoopControllers(1, false, 5);
+    HVACControllers::TrackCoupledAirLoopControllers(1, true, 1);
+    EXPECT_EQ(3, thisAirLoopStats.NumCoupledSolves);
+    EXPECT_EQ(2, thisAirLoopStats.NumCoupledConverged);
+    EXPECT_EQ(8, thisAirLoopStats.TotCoupledIterations);
+    EXPECT_EQ(5, thisAirLoopStats.MaxCoupledIterations);
+
+    // an air loop without controllers has nothing to solve together, so the air loop is not simulated
+    DataAirSystems::PrimaryAirSystem.allocate(1);
+    DataAirSystems::PrimaryAirSystem(1).NumControllers = 0;
+    int NumCalls = 0;
+    SimAirServingZones::SolveAirLoopControllersCoupled(false, 1, NumCalls);
+    EXPECT_EQ(0, NumCalls);
+    EXPECT_EQ(3, thisAirLoopStats.NumCoupledSolves);
+}
+
+TEST_F(EnergyPlusFixture, HVACControllers_CoupledNewtonMatchesSequentialSolve)
+{
+    // A cooling coil controlled on its leaving air temperature is followed by a reheat coil controlled on the supply
+    // air temperature. The zone return air is recirculated, so the cooling coil inlet depends on the reheat coil too
+    // and the two controllers interact. Each coil is a simple effectiveness model of its water flow rate.
+    Real64 const CoolSetPoint = 12.0;
+    Real64 const SupplySetPoint = 16.0;
+    Real64 const Offset = 0.01;
+    auto simulateCoils = [](Real64 const CoolFlow, Real64 const HeatFlow, Real64 &CoolOutletTemp, Real64 &SupplyTemp) {
+        Real64 const CoolBypass = std::exp(-1.2 * CoolFlow); // 1 - cooling coil effectiveness
+        Real64 const HeatBypass = std::exp(-0.8 * HeatFlow); // 1 - heating coil effectiveness
+        Real64 const ChWTemp = 7.0;
+        Real64 const HWTemp = 60.0;
+        // mixed air = 70% return air (supply + 8C zone rise) and 30% outdoor air at 32C
+        SupplyTemp = (HeatBypass * (CoolBypass * (0.7 * 8.0 + 0.3 * 32.0) + ChWTemp * (1.0 - CoolBypass)) + HWTemp * (1.0 - HeatBypass)) /
+                     (1.0 - 0.7 * CoolBypass * HeatBypass);
+        Real64 const MixedAirTemp = 0.7 * (SupplyTemp + 8.0) + 0.3 * 32.0;
+        CoolOutletTemp = CoolBypass * MixedAirTemp + (1.0 - CoolBypass) * ChWTemp;
+    };
+
+    // sequential solve: each controller in turn finds its own flow with the other one held, until both agree
+    Real64 CoolFlow = 1.5;
+    Real64 HeatFlow = 1.5;
+    Real64 CoolOutletTemp = 0.0;
+    Real64 SupplyTemp = 0.0;
+    int SolFla = 0;
+    int NumSweeps = 0;
+    for (NumSweeps = 1; NumSweeps <= 50; ++NumSweeps) {
+        General::SolveRoot(1.0e-8,
+                           500,
+                           SolFla,
+                           CoolFlow,
+                           [&](Real64 const Flow) {
+                               simulateCoils(Flow, HeatFlow, CoolOutletTemp, SupplyTemp);
+                               return CoolOutletTemp - CoolSetPoint;
+                           },
+                           0.0,
+                           3.0);
+        ASSERT_GT(SolFla, 0);
+        General::SolveRoot(1.0e-8,
+                           500,
+                           SolFla,
+                           HeatFlow,
+                           [&](Real64 const Flow) {
+                               simulateCoils(CoolFlow, Flow, CoolOutletTemp, SupplyTemp);
+                               return SupplyTemp - SupplySetPoint;
+                           },
+                           0.0,
+                           3.0);
+        ASSERT_GT(SolFla, 0);
+        simulateCoils(CoolFlow, HeatFlow, CoolOutletTemp, SupplyTemp);
+        if (std::abs(CoolOutletTemp - CoolSetPoint) < 1.0e-6 && std::abs(SupplyTemp - SupplySetPoint) < 1.0e-6) break;
+    }
+    ASSERT_LE(NumSweeps, 50);
+    EXPECT_GT(NumSweeps, 1); // the controllers interact
+
+    // coupled solve from the same starting point
+    auto evaluate = [&](std::vector<Real64> const &X, std::vector<Real64> &R) {
+        simulateCoils(X[0], X[1], CoolOutletTemp, SupplyTemp);
+        R[0] = (CoolOutletTemp - CoolSetPoint) / Offset;
+        R[1] = (SupplyTemp - SupplySetPoint) / Offset;
+        return R[0] * R[0] + R[1] * R[1];
+    };
+    std::vector<Real64> const XMin{0.0, 0.0};
+    std::vector<Real64> const XMax{3.0, 3.0};
+    std::vector<Real64> X{1.5, 1.5};
+    int NumNewtonIter = 0;
+    EXPECT_TRUE(SimAirServingZones::SolveCoupledControllerResiduals(evaluate, XMin, XMax, X, NumNewtonIter));
+    EXPECT_GT(NumNewtonIter, 0);
+    EXPECT_LE(NumNewtonIter, 5);
+
+    // same actuated flows as the sequential solve, and the last evaluation was at that point
+    EXPECT_NEAR(CoolFlow, X[0], 1.0e-4);
+    EXPECT_NEAR(HeatFlow, X[1], 1.0e-4);
+    Real64 const LastCoolOutletTemp = CoolOutletTemp;
+    Real64 const LastSupplyTemp = SupplyTemp;
+    simulateCoils(X[0], X[1], CoolOutletTemp, SupplyTemp);
+    EXPECT_DOUBLE_EQ(CoolOutletTemp, LastCoolOutletTemp);
+    EXPECT_DOUBLE_EQ(SupplyTemp, LastSupplyTemp);
+    EXPECT_NEAR(CoolSetPoint, CoolOutletTemp, Offset);
+    EXPECT_NEAR(SupplySetPoint, SupplyTemp, Offset);
+}
+
 } // namespace EnergyPlus
@@ -3780,6 +3780,75 @@ TEST_F(InputProcessorFixture, getObjectItem_curve_biquadratic2)
     EXPECT_EQ(1, IOStatus);
 }
 
+TEST_F(InputProcessorFixture, getObjectViews)
+{
+    std::string const idf_objects = delimited_string({
+        "NodeList,",
+        "  Zone Inlets,             !- Name",
+        "  Inlet Node 1,            !- Node 1 Name",
+        "  Inlet Node 2;            !- Node 2 Name",
+        "NodeList,",
+        "  Zone Exhausts,           !- Name",
+        "  Exhaust Node 1;          !- Node 1 Name",
+        "Schedule:Compact,",
+        "  Always On,               !- Name",
+        "  ,                        !- Schedule Type Limits Name",
+        "  Through: 12/31,          !- Field 1",
+        "  For: AllDays,            !- Field 2",
+        "  Until: 24:00,            !- Field 3",
+        "  1;                       !- Field 4",
+        "Fan:ConstantVolume,",
+        "  Supply Fan,              !- Name",
+        "  Always On,               !- Availability Schedule Name",
+        "  ,                        !- Fan Total Efficiency",
+        "  600,                     !- Pressure Rise {Pa}",
+        "  autosize,                !- Maximum Flow Rate {m3/s}",
+        "  0.8,                     !- Motor Efficiency",
+        "  ,                        !- Motor In Airstream Fraction",
+        "  Fan Inlet,               !- Air Inlet Node Name",
+        "  Fan Outlet;              !- Air Outlet Node Name",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    // same order as getObjectItem, with the extensible groups in the order entered
+    auto const nodeLists = inputProcessor->getObjectViews("NodeList");
+    ASSERT_EQ(2u, nodeLists.size());
+    EXPECT_EQ("Zone Inlets", nodeLists[0].name());
+    ASSERT_EQ(2u, nodeLists[0].numExtensibleGroups());
+    EXPECT_EQ("Inlet Node 1", nodeLists[0].extensibleGroup(1).alpha("node_name"));
+    EXPECT_EQ("Inlet Node 2", nodeLists[0].extensibleGroup(2).alpha("node_name"));
+    EXPECT_EQ("Zone Exhausts", nodeLists[1].name());
+    ASSERT_EQ(1u, nodeLists[1].numExtensibleGroups());
+    EXPECT_EQ("Exhaust Node 1", nodeLists[1].extensibleGroup(1).alpha("node_name"));
+
+    // object type lookup is case insensitive, and numbers entered in alpha fields read back as text
+    auto const schedules = inputProcessor->getObjectViews("SCHEDULE:COMPACT");
+    ASSERT_EQ(1u, schedules.size());
+    EXPECT_TRUE(schedules[0].isBlank("schedule_type_limits_name"));
+    EXPECT_EQ("", schedules[0].alpha("schedule_type_limits_name"));
+    ASSERT_EQ(4u, schedules[0].numExtensibleGroups());
+    EXPECT_EQ("Through: 12/31", schedules[0].extensibleGroup(1).alpha("field"));
+    EXPECT_EQ("1", schedules[0].extensibleGroup(4).alpha("field"));
+
+    auto const fans = inputProcessor->getObjectViews("Fan:ConstantVolume");
+    ASSERT_EQ(1u, fans.size());
+    auto const &fan = fans[0];
+    EXPECT_EQ("Always On", fan.alpha("availability_schedule_name"));
+    EXPECT_EQ("Fan Outlet", fan.alpha("air_outlet_node_name"));
+    EXPECT_DOUBLE_EQ(600.0, fan.number("pressure_rise"));
+    EXPECT_DOUBLE_EQ(0.8, fan.number("motor_efficiency"));
+    EXPECT_TRUE(fan.isBlank("fan_total_efficiency"));
+    EXPECT_DOUBLE_EQ(0.7, fan.number("fan_total_efficiency"));
+    EXPECT_DOUBLE_EQ(1.0, fan.number("motor_in_airstream_fraction"));
+    EXPECT_TRUE(fan.isAutosizeOrAutocalculate("maximum_flow_rate"));
+    EXPECT_DOUBLE_EQ(-99999.0, fan.number("maximum_flow_rate"));
+    EXPECT_FALSE(fan.isAutosizeOrAutocalculate("pressure_rise"));
+    EXPECT_EQ(0u, fan.numExtensibleGroups());
+
+    EXPECT_TRUE(inputProcessor->getObjectViews("Fan:VariableVolume").empty());
+}
+
 // https://github.com/NREL/EnergyPlus/issues/6720
 TEST_F(InputProcessorFixture, FalseDuplicates)
 {
@@ -97,6 +97,37 @@ TEST_F(EnergyPlusFixture, JsonOutput_ParseJsonObject2)
     compare_json_stream("");
 }
 
+TEST_F(EnergyPlusFixture, JsonOutput_WriteEndOfRunReports)
+{
+    std::string const idf_objects = delimited_string({
+        "Output:JSON,",
+        "TimeSeriesAndTabular,",
+        "Yes,",
+        "No,",
+        "No;",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    OutputSchema->setupOutputOptions();
+    OutputSchema->RIHourlyTSData.setRDataFrameEnabled(true);
+
+    auto const sinks = OutputSchema->writeEndOfRunReports();
+    OutputSchema->RIHourlyTSData.setRDataFrameEnabled(false);
+
+    // the summary formats only follow the summary assembly, and only enabled formats with an open stream are written
+    ASSERT_EQ(3u, sinks.size());
+    EXPECT_EQ("Hourly time series", sinks[0].name);
+    EXPECT_EQ("summary report assembly", sinks[1].name);
+    EXPECT_EQ("summary report JSON", sinks[2].name);
+    for (auto const &sink : sinks) {
+        EXPECT_TRUE(sink.error.empty());
+        EXPECT_GE(sink.elapsedSeconds, 0.0);
+    }
+
+    EXPECT_TRUE(has_json_output());
+}
+
 TEST_F(EnergyPlusFixture, JsonOutput_SimInfo)
 {
 
@@ -127,3 +127,45 @@ TEST_F(EnergyPlusFixture, KusudaAchenbachGroundTempModelTest2) // lNumericFieldB
 
     EXPECT_NEAR(18.0, thisModel->getGroundTempAtTimeInSeconds(100.0, 24883200), 0.01); // Oct 15--deep
 }
+
+TEST_F(EnergyPlusFixture, KusudaAchenbachGroundTempModel_TabulatedMatchesDirect)
+{
+    std::string const idf_objects = delimited_string({
+        "Site:GroundTemperature:Undisturbed:KusudaAchenbach,",
+        "	Test,	!- Name of ground temperature object",
+        "	1.08,		!- Soil Thermal Conductivity",
+        "	980,		!- Soil Density",
+        "	2570,		!- Soil Specific Heat",
+        "	15.0,		!- Average Surface Temperature",
+        "	5.0,		!- Average Amplitude of Surface Temperature",
+        "	1;			!- Phase Shift of Minimum Surface Temperature",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    std::string const CurrentModuleObject = CurrentModuleObjects(objectType_KusudaGroundTemp);
+
+    auto thisModel = GetGroundTempModelAndInit(CurrentModuleObject, "TEST");
+
+    // Two consumers on different time bases (start of day and current time) interleave their requests,
+    // and enough depths are asked for over the run to overflow the table
+    for (int day = 1; day <= 40; ++day) {
+        Real64 const startOfDay = (day - 1) * 86400.0;
+        for (int hour = 1; hour <= 24; ++hour) {
+            Real64 const currentTime = startOfDay + hour * 3600.0;
+            for (int depthNum = 0; depthNum <= 20; ++depthNum) {
+                Real64 const depth = depthNum * 0.25;
+                EXPECT_DOUBLE_EQ(thisModel->getGroundTempAtTimeInSeconds(depth, startOfDay),
+                                 thisModel->getGroundTempAtTimeInSecondsTabulated(depth, startOfDay));
+                EXPECT_DOUBLE_EQ(thisModel->getGroundTempAtTimeInSeconds(depth, currentTime),
+                                 thisModel->getGroundTempAtTimeInSecondsTabulated(depth, currentTime));
+                // Repeated request is served from the table
+                EXPECT_DOUBLE_EQ(thisModel->getGroundTempAtTimeInSeconds(depth, startOfDay),
+                                 thisModel->getGroundTempAtTimeInSecondsTabulated(depth, startOfDay));
+            }
+        }
+    }
+
+    // Times that have been dropped from the table are evaluated again
+    EXPECT_DOUBLE_EQ(thisModel->getGroundTempAtTimeInSeconds(0.5, 0.0), thisModel->getGroundTempAtTimeInSecondsTabulated(0.5, 0.0));
+}
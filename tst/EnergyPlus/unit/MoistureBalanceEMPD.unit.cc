@@ -151,6 +151,16 @@ TEST_F(EnergyPlusFixture, CheckEMPDCalc)
     EXPECT_DOUBLE_EQ(0.0051469229632164605, DataMoistureBalanceEMPD::RVDeepLayer(1));
     EXPECT_DOUBLE_EQ(-0.47694608375620229, DataMoistureBalanceEMPD::HeatFluxLatent(1));
 
+    // The batched evaluation used by the inside heat balance gives the same results
+    surface.HeatTransferAlgorithm = DataSurfaces::HeatTransferModel_EMPD;
+    DataHeatBalFanSys::MAT(1) = 19.901185713164697;
+    Array1D<Real64> TempSurfIn(1, 19.907302679986064);
+    ASSERT_TRUE(MoistureBalanceEMPDManager::IsBatchedEMPDSurface(1));
+    MoistureBalanceEMPDManager::CalcMoistureBalanceEMPDSurfaces(std::vector<int>{1}, TempSurfIn);
+    EXPECT_DOUBLE_EQ(6.3445188238394508, DataMoistureBalanceEMPD::TempSurfSat(1));
+    EXPECT_DOUBLE_EQ(0.0071762141417078054, DataMoistureBalanceEMPD::RVSurface(1));
+    EXPECT_DOUBLE_EQ(-0.47694608375620229, DataMoistureBalanceEMPD::HeatFluxLatent(1));
+
     // Clean up
     DataHeatBalFanSys::ZoneAirHumRat.deallocate();
     DataMoistureBalance::RhoVaporAirIn.deallocate();
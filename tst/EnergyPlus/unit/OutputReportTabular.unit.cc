@@ -7653,3 +7653,120 @@ TEST_F(SQLiteFixture, WriteSourceEnergyEndUseSummary_TestPerArea) {
 
     EnergyPlus::sqlite->sqliteCommit();
 }
+
+TEST_F(EnergyPlusFixture, OutputReportTabular_ZoneDelaySequences)
+{
+    int const coolDesSelected = 2;
+    TotDesDays = 2;
+    TotRunDesPersDays = 0;
+    NumOfTimeStepInHour = 1;
+    int const numTimeSteps = NumOfTimeStepInHour * 24;
+
+    NumOfZones = 1;
+    Zone.allocate(NumOfZones);
+    Zone(1).SurfaceFirst = 1;
+    Zone(1).SurfaceLast = 2;
+    Zone(1).RadiantEnclosureNum = 1;
+
+    TotSurfaces = 2;
+    Surface.allocate(TotSurfaces);
+    Surface(1).HeatTransSurf = true;
+    Surface(1).Area = 10.0;
+    Surface(2).HeatTransSurf = true;
+    Surface(2).Area = 5.0;
+    Surface(2).Class = SurfaceClass_Window;
+
+    DataZoneEquipment::ZoneEquipConfig.allocate(NumOfZones);
+    DataZoneEquipment::ZoneEquipConfig(1).IsControlled = true;
+    CalcFinalZoneSizing.allocate(NumOfZones);
+    CalcFinalZoneSizing(1).CoolDDNum = coolDesSelected;
+    CalcFinalZoneSizing(1).HeatDDNum = 0;
+
+    AllocateLoadComponentArrays();
+    for (int kTimeStep = 1; kTimeStep <= numTimeSteps; ++kTimeStep) {
+        TMULTseq(coolDesSelected, kTimeStep, 1) = 1.0;
+        peopleRadSeq(coolDesSelected, kTimeStep, 1) = kTimeStep;
+        equipRadSeq(coolDesSelected, kTimeStep, 1) = 2.0;
+        for (int jSurf = 1; jSurf <= TotSurfaces; ++jSurf) {
+            decayCurveCool(kTimeStep, jSurf) = std::pow(0.5, kTimeStep);
+            ITABSFseq(coolDesSelected, kTimeStep, jSurf) = 0.1 * jSurf;
+            lightSWRadSeq(coolDesSelected, kTimeStep, jSurf) = 0.3 * jSurf;
+            loadConvectedNormal(coolDesSelected, kTimeStep, jSurf) = 1.5;
+        }
+        netSurfRadSeq(coolDesSelected, kTimeStep, 2) = 0.2;
+    }
+
+    Array1D<Real64> peopleDelaySeq(numTimeSteps, 0.0);
+    Array1D<Real64> equipDelaySeq(numTimeSteps, 0.0);
+    Array1D<Real64> hvacLossDelaySeq(numTimeSteps, 0.0);
+    Array1D<Real64> powerGenDelaySeq(numTimeSteps, 0.0);
+    Array1D<Real64> lightDelaySeq(numTimeSteps, 0.0);
+    Array1D<Real64> feneSolarDelaySeq(numTimeSteps, 0.0);
+    Array2D<Real64> surfDelaySeq(numTimeSteps, TotSurfaces, 0.0);
+
+    // without the zone results computed up front the sequences are computed directly
+    GetDelaySequences(coolDesSelected,
+                      true,
+                      1,
+                      peopleDelaySeq,
+                      equipDelaySeq,
+                      hvacLossDelaySeq,
+                      powerGenDelaySeq,
+                      lightDelaySeq,
+                      feneSolarDelaySeq,
+                      feneCondInstantSeq,
+                      surfDelaySeq);
+    // first timestep: 1 * 0.1 * 10 * 0.5 + 1 * 0.2 * 5 * 0.5
+    EXPECT_NEAR(1.0, peopleDelaySeq(1), 1.0e-12);
+    EXPECT_NEAR(0.3 * 0.5 + 0.6 * 0.5, lightDelaySeq(1), 1.0e-12);
+    EXPECT_NEAR(-0.2, feneCondInstantSeq(coolDesSelected, 1, 1), 1.0e-12);
+
+    // only the design day selected for the zone peak is kept
+    ComputeZoneDelaySequences();
+    ASSERT_EQ(1u, ZoneDelaySequences(1).size());
+    EXPECT_EQ(coolDesSelected, ZoneDelaySequences(1)[0].desDayNum);
+    EXPECT_TRUE(ZoneDelaySequences(1)[0].isCooling);
+
+    Array1D<Real64> peopleDelaySeq2(numTimeSteps, 0.0);
+    Array1D<Real64> equipDelaySeq2(numTimeSteps, 0.0);
+    Array1D<Real64> hvacLossDelaySeq2(numTimeSteps, 0.0);
+    Array1D<Real64> powerGenDelaySeq2(numTimeSteps, 0.0);
+    Array1D<Real64> lightDelaySeq2(numTimeSteps, 0.0);
+    Array1D<Real64> feneSolarDelaySeq2(numTimeSteps, 0.0);
+    Array2D<Real64> surfDelaySeq2(numTimeSteps, TotSurfaces, 0.0);
+    GetDelaySequences(coolDesSelected,
+                      true,
+                      1,
+                      peopleDelaySeq2,
+                      equipDelaySeq2,
+                      hvacLossDelaySeq2,
+                      powerGenDelaySeq2,
+                      lightDelaySeq2,
+                      feneSolarDelaySeq2,
+                      feneCondInstantSeq,
+                      surfDelaySeq2);
+    for (int kTimeStep = 1; kTimeStep <= numTimeSteps; ++kTimeStep) {
+        EXPECT_EQ(peopleDelaySeq(kTimeStep), peopleDelaySeq2(kTimeStep));
+        EXPECT_EQ(equipDelaySeq(kTimeStep), equipDelaySeq2(kTimeStep));
+        EXPECT_EQ(lightDelaySeq(kTimeStep), lightDelaySeq2(kTimeStep));
+        EXPECT_EQ(surfDelaySeq(kTimeStep, 1), surfDelaySeq2(kTimeStep, 1));
+        EXPECT_EQ(surfDelaySeq(kTimeStep, 2), surfDelaySeq2(kTimeStep, 2));
+    }
+    // the fenestration adjustment is still only applied once
+    EXPECT_NEAR(-0.2, feneCondInstantSeq(coolDesSelected, 1, 1), 1.0e-12);
+
+    // another design day, e.g. an air loop peak, is computed on demand and kept as well
+    GetDelaySequences(1,
+                      true,
+                      1,
+                      peopleDelaySeq2,
+                      equipDelaySeq2,
+                      hvacLossDelaySeq2,
+                      powerGenDelaySeq2,
+                      lightDelaySeq2,
+                      feneSolarDelaySeq2,
+                      feneCondInstantSeq,
+                      surfDelaySeq2);
+    EXPECT_EQ(2u, ZoneDelaySequences(1).size());
+    EXPECT_EQ(0.0, peopleDelaySeq2(1));
+}
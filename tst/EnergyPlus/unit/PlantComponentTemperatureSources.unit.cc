@@ -83,45 +83,44 @@ TEST_F(EnergyPlusFixture, TestPlantComponentTemperatureSource)
     DataPlant::PlantLoop(1).LoopSide(2).Branch(1).Comp(1).Name = "FLUIDSOURCE";
     DataPlant::PlantLoop(1).LoopSide(2).Branch(1).Comp(1).NodeNumIn = 1;
 
-    // define some arguments that aren't used but listed as parameters
-    int dummyInteger = 0;
-    bool dummyRunFlag = true;
+    // the location is only used during initialization
+    PlantLocation loc(1, 2, 1, 1);
 
     // define the INOUT variables that are passed back
-    int compIndex = 0; // use this to call back into Sim multiple times
     Real64 myLoad = 0.0;
     Real64 maxLoad = 0.0, minLoad = 0.0, optLoad = 0.0;
     Real64 sizingFactor = 0.0;
+    bool runFlag = true;
 
     // First call is for initialization only
     bool firstHVACIteration = true;
-    bool initLoopEquip = true;
-    bool getSizingFactor = true;
     DataGlobals::BeginEnvrnFlag = true;
     DataPlant::PlantFirstSizesOkayToFinalize = true;
-    PlantComponentTemperatureSources::SimWaterSource("FLUIDSOURCE", dummyInteger, compIndex, dummyRunFlag, firstHVACIteration, initLoopEquip, myLoad,
-                                                     maxLoad, minLoad, optLoad, getSizingFactor, sizingFactor);
+    PlantComponent *ptr = PlantComponentTemperatureSources::WaterSourceSpecs::factory("FLUIDSOURCE");
+    ASSERT_NE(nullptr, ptr);
+    ptr->onInitLoopEquip(loc);
+    ptr->getDesignCapacities(loc, maxLoad, minLoad, optLoad);
+    ptr->getSizingFactor(sizingFactor);
+    EXPECT_NEAR(0.0, minLoad, 0.00001);
+    EXPECT_NEAR(DataGlobals::BigNumber, maxLoad, 0.00001);
 
     // We can check that GetInput happened properly here
     EXPECT_EQ(1u, PlantComponentTemperatureSources::WaterSource.size());
     auto &waterSource1 = PlantComponentTemperatureSources::WaterSource(1);
+    EXPECT_EQ(ptr, &waterSource1);
     EXPECT_EQ(PlantComponentTemperatureSources::TempSpecType_Constant, waterSource1.TempSpecType);
     EXPECT_EQ(1, waterSource1.InletNodeNum);
     EXPECT_EQ(2, waterSource1.OutletNodeNum);
 
     // Second call is on firstHVAC, no load at the moment
     firstHVACIteration = true;
-    initLoopEquip = false;
-    getSizingFactor = false;
-    PlantComponentTemperatureSources::SimWaterSource("FLUIDSOURCE", dummyInteger, compIndex, dummyRunFlag, firstHVACIteration, initLoopEquip, myLoad,
-                                                     maxLoad, minLoad, optLoad, getSizingFactor, sizingFactor);
+    ptr->simulate(loc, firstHVACIteration, myLoad, runFlag);
     EXPECT_NEAR(0.0, waterSource1.MassFlowRate, 0.00001);
 
     // Third call is no longer firstHVAC, and we now have a load
     firstHVACIteration = false;
     myLoad = 1696.55;
-    PlantComponentTemperatureSources::SimWaterSource("FLUIDSOURCE", dummyInteger, compIndex, dummyRunFlag, firstHVACIteration, initLoopEquip, myLoad,
-                                                     maxLoad, minLoad, optLoad, getSizingFactor, sizingFactor);
+    ptr->simulate(loc, firstHVACIteration, myLoad, runFlag);
     EXPECT_NEAR(0.05, waterSource1.MassFlowRate, 0.001);
 
     // Do this for scheduled temperature
@@ -95,4 +95,74 @@ TEST_F(EnergyPlusFixture, Psychrometrics_PsyWFnTdpPb_Test)
     EXPECT_TRUE(compare_err_stream(error_string1, true));
 
 }
+
+TEST_F(EnergyPlusFixture, Psychrometrics_PsyTsatFnPb_fast_Test)
+{
+    // Saturation pressures from -99C to 199C; compare against the iterative solution
+    for (int steps = 0; steps <= 1; ++steps) {
+        Psychrometrics::FastPsyNewtonSteps = steps;
+        Real64 const Tol(steps == 0 ? 0.05 : 0.001);
+        for (Real64 T = -99.0; T <= 199.0; T += 0.5) {
+            Real64 const Press = Psychrometrics::PsyPsatFnTemp(T);
+            EXPECT_NEAR(Psychrometrics::PsyTsatFnPb(Press), Psychrometrics::PsyTsatFnPb_fast(Press), Tol) << "T=" << T;
+        }
+    }
+
+    // Limits and special cases are the same as PsyTsatFnPb
+    EXPECT_DOUBLE_EQ(200.0, Psychrometrics::PsyTsatFnPb_fast(1600000.0));
+    EXPECT_DOUBLE_EQ(-100.0, Psychrometrics::PsyTsatFnPb_fast(0.001));
+    EXPECT_DOUBLE_EQ(0.0, Psychrometrics::PsyTsatFnPb_fast(611.1));
+
+    // The run-time switch routes PsyTsatFnPb through the fast method
+    Psychrometrics::FastPsyNewtonSteps = 0;
+    Psychrometrics::UseFastPsychrometrics = true;
+    EXPECT_DOUBLE_EQ(Psychrometrics::PsyTsatFnPb_fast(2339.0), Psychrometrics::PsyTsatFnPb(2339.0));
+}
+
+TEST_F(EnergyPlusFixture, Psychrometrics_PsyTwbFnTdbWPb_fast_Test)
+{
+    // Compare against the iterative solution over the normal HVAC range and sea level to high altitude
+    for (int steps = 0; steps <= 2; ++steps) {
+        Psychrometrics::FastPsyNewtonSteps = steps;
+        Real64 const Tol(steps == 0 ? 0.1 : 0.005);
+        for (Real64 PB = 60000.0; PB <= 110000.0; PB += 10000.0) {
+            for (Real64 TDB = -40.0; TDB <= 60.0; TDB += 2.5) {
+                Real64 const WSat = Psychrometrics::PsyWFnTdbRhPb(TDB, 1.0, PB);
+                for (Real64 RH = 0.05; RH <= 1.0; RH += 0.15) {
+                    Real64 const W = RH * WSat;
+                    Real64 const TWB = Psychrometrics::PsyTwbFnTdbWPb(TDB, W, PB);
+                    Real64 const TWBFast = Psychrometrics::PsyTwbFnTdbWPb_fast(TDB, W, PB);
+                    EXPECT_NEAR(TWB, TWBFast, Tol) << "TDB=" << TDB << " W=" << W << " PB=" << PB;
+                    EXPECT_LE(TWBFast, TDB);
+                }
+            }
+        }
+    }
+
+    // Saturated air and very humid air near the boiling point
+    Psychrometrics::FastPsyNewtonSteps = 1;
+    Real64 const WSat = Psychrometrics::PsyWFnTdbRhPb(25.0, 1.0, 101325.0);
+    EXPECT_NEAR(25.0, Psychrometrics::PsyTwbFnTdbWPb_fast(25.0, WSat, 101325.0), 0.001);
+    EXPECT_NEAR(96.859, Psychrometrics::PsyTwbFnTdbWPb_fast(150.0, 5.0, 101325.0), 0.001);
+}
+
+TEST_F(EnergyPlusFixture, Psychrometrics_PsyTwbFnTdbWPb_cache_mode_Test)
+{
+    // Cached wet-bulb results from one method are not returned after switching to the other
+    Psychrometrics::FastPsyNewtonSteps = 0;
+    Real64 const TWBFast = Psychrometrics::PsyTwbFnTdbWPb_fast(20.0, 0.005, 101325.0);
+
+    Real64 const TWB = Psychrometrics::PsyTwbFnTdbWPb(20.0, 0.005, 101325.0);
+    EXPECT_GT(std::abs(TWB - TWBFast), 0.005);
+
+    Psychrometrics::UseFastPsychrometrics = true;
+    EXPECT_NEAR(TWBFast, Psychrometrics::PsyTwbFnTdbWPb(20.0, 0.005, 101325.0), 0.001);
+
+    // Changing the number of refinement steps also changes the result
+    Psychrometrics::FastPsyNewtonSteps = 2;
+    EXPECT_NEAR(TWB, Psychrometrics::PsyTwbFnTdbWPb(20.0, 0.005, 101325.0), 0.001);
+
+    Psychrometrics::UseFastPsychrometrics = false;
+    EXPECT_DOUBLE_EQ(TWB, Psychrometrics::PsyTwbFnTdbWPb(20.0, 0.005, 101325.0));
+}
 } // namespace EnergyPlus
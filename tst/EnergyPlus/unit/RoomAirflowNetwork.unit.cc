@@ -304,6 +304,11 @@ TEST_F(RoomAirflowNetworkTest, RAFNTest)
 
     thisRAFN.InitRoomAirModelAirflowNetwork(RoomAirNode);
 
+    ASSERT_EQ(1, RoomAirflowNetworkZoneInfo(ZoneNum).Node(1).SurfNums.isize());
+    EXPECT_EQ(1, RoomAirflowNetworkZoneInfo(ZoneNum).Node(1).SurfNums(1));
+    ASSERT_EQ(1, RoomAirflowNetworkZoneInfo(ZoneNum).Node(2).SurfNums.isize());
+    EXPECT_EQ(2, RoomAirflowNetworkZoneInfo(ZoneNum).Node(2).SurfNums(1));
+
     EXPECT_NEAR(120.0, RoomAirflowNetworkZoneInfo(ZoneNum).Node(RoomAirNode).SumIntSensibleGain, 0.00001);
     EXPECT_NEAR(80.0, RoomAirflowNetworkZoneInfo(ZoneNum).Node(RoomAirNode).SumIntLatentGain, 0.00001);
     EXPECT_NEAR(1.0, RoomAirflowNetworkZoneInfo(ZoneNum).Node(RoomAirNode).SumHA, 0.00001);
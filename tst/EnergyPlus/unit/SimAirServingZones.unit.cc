@@ -63,9 +63,11 @@
 #include "Fixtures/EnergyPlusFixture.hh"
 #include <DataAirSystems.hh>
 #include <DataSizing.hh>
+#include <HVACControllers.hh>
 #include <MixedAir.hh>
 #include <SimAirServingZones.hh>
 #include <UtilityRoutines.hh>
+#include <WaterCoils.hh>
 
 using namespace EnergyPlus;
 using namespace DataAirSystems;
@@ -630,4 +632,60 @@ TEST_F(EnergyPlusFixture, GetAirPathData_ControllerLockout2)
     EXPECT_TRUE(PrimaryAirSystem(1).CanBeLockedOutByEcono(2));
 }
 
+TEST_F(EnergyPlusFixture, SimAirServingZones_CompileControllerResimulation)
+{
+    // single branch: duct, cooling coil, fan, heating coil
+    PrimaryAirSystem.allocate(1);
+    auto &thisAirSys(PrimaryAirSystem(1));
+    thisAirSys.NumBranches = 1;
+    thisAirSys.Branch.allocate(1);
+    thisAirSys.Branch(1).TotalComponents = 4;
+    thisAirSys.Branch(1).Comp.allocate(4);
+    thisAirSys.Branch(1).Comp(1).CompType_Num = SimAirServingZones::Duct;
+    thisAirSys.Branch(1).Comp(1).CompIndex = 1;
+    thisAirSys.Branch(1).Comp(2).CompType_Num = SimAirServingZones::WaterCoil_Cooling;
+    thisAirSys.Branch(1).Comp(2).CompIndex = 1;
+    thisAirSys.Branch(1).Comp(3).CompType_Num = SimAirServingZones::Fan_Simple_VAV;
+    thisAirSys.Branch(1).Comp(3).CompIndex = 1;
+    thisAirSys.Branch(1).Comp(4).CompType_Num = SimAirServingZones::WaterCoil_SimpleHeat;
+    thisAirSys.Branch(1).Comp(4).CompIndex = 2;
+
+    WaterCoils::WaterCoil.allocate(2);
+    WaterCoils::WaterCoil(1).WaterInletNodeNum = 5;
+    WaterCoils::WaterCoil(2).WaterInletNodeNum = 7;
+
+    // controllers listed heating first
+    thisAirSys.NumControllers = 2;
+    thisAirSys.ControllerIndex.allocate(2);
+    thisAirSys.ControllerIndex(1) = 1;
+    thisAirSys.ControllerIndex(2) = 2;
+    HVACControllers::ControllerProps.allocate(2);
+    HVACControllers::ControllerProps(1).ActuatedNode = 7;
+    HVACControllers::ControllerProps(2).ActuatedNode = 5;
+
+    CompileControllerResimulation(1);
+    EXPECT_TRUE(thisAirSys.ControllerResimCompiled);
+    EXPECT_EQ(4, thisAirSys.ControllerResimCompNum(1));
+    EXPECT_EQ(2, thisAirSys.ControllerResimCompNum(2));
+    EXPECT_EQ(0, thisAirSys.ResimOASysCompNum);
+    EXPECT_EQ(4, GetControllerResimCompNum(1, 1));
+    EXPECT_EQ(2, GetControllerResimCompNum(1, 2));
+
+    // a component that may depend on downstream state forces a full resimulation
+    thisAirSys.Branch(1).Comp(3).CompType_Num = SimAirServingZones::UnitarySystemModel;
+    CompileControllerResimulation(1);
+    EXPECT_TRUE(thisAirSys.ControllerResimCompiled);
+    EXPECT_EQ(0, thisAirSys.ControllerResimCompNum(1));
+    EXPECT_EQ(0, thisAirSys.ControllerResimCompNum(2));
+    EXPECT_EQ(1, GetControllerResimCompNum(1, 1));
+    EXPECT_EQ(1, GetControllerResimCompNum(1, 2));
+
+    // so does a splitter
+    thisAirSys.Branch(1).Comp(3).CompType_Num = SimAirServingZones::Fan_Simple_VAV;
+    thisAirSys.Splitter.Exists = true;
+    CompileControllerResimulation(1);
+    EXPECT_EQ(0, thisAirSys.ControllerResimCompNum(1));
+    EXPECT_EQ(1, GetControllerResimCompNum(1, 2));
+}
+
 } // namespace EnergyPlus
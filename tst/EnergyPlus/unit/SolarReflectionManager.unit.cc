@@ -0,0 +1,184 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+// EnergyPlus::SolarReflectionManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/DaylightingManager.hh>
+#include <EnergyPlus/SolarReflectionManager.hh>
+#include <EnergyPlus/SurfaceOctree.hh>
+
+#include "Fixtures/EnergyPlusFixture.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataSurfaces;
+using namespace EnergyPlus::SolarReflectionManager;
+
+TEST_F(EnergyPlusFixture, SolarReflectionManager_OctreeMatchesSurfaceSearch)
+{
+    // A wall and a roof receive reflected solar from a grid of vertical shading panels. There are enough surfaces
+    // for the surface octree to be used, so the reflection factors are calculated once by testing every surface
+    // and once with the octree, and both must agree.
+    using Vertex = Vector3<Real64>;
+    int const NumPanels = 120;
+    TotSurfaces = 2 + NumPanels;
+    ASSERT_GE(TotSurfaces, DaylightingManager::octreeCrossover);
+    Surface.allocate(TotSurfaces);
+
+    DataHeatBalance::TotConstructs = 1;
+    DataHeatBalance::Construct.allocate(1);
+    DataHeatBalance::Construct(1).OutsideAbsorpSolar = 0.6;
+
+    auto setReceiver = [](SurfaceData &surface, std::string const &name, Vertex const &outNormVec) {
+        surface.Name = name;
+        surface.Class = SurfaceClass_Wall;
+        surface.HeatTransSurf = true;
+        surface.ExtSolar = true;
+        surface.Construction = 1;
+        surface.Sides = 4;
+        surface.OutNormVec = outNormVec;
+        surface.ViewFactorSky = 0.5;
+    };
+    // wall facing +x
+    setReceiver(Surface(1), "WALL", Vertex(1.0, 0.0, 0.0));
+    Surface(1).Vertex = {Vertex(0.0, 0.0, 3.0), Vertex(0.0, 0.0, 0.0), Vertex(0.0, 10.0, 0.0), Vertex(0.0, 10.0, 3.0)};
+    Surface(1).Tilt = 90.0;
+    Surface(1).CosTilt = 0.0;
+    // roof facing up
+    setReceiver(Surface(2), "ROOF", Vertex(0.0, 0.0, 1.0));
+    Surface(2).Vertex = {Vertex(-10.0, 10.0, 3.0), Vertex(-10.0, 0.0, 3.0), Vertex(0.0, 0.0, 3.0), Vertex(0.0, 10.0, 3.0)};
+    Surface(2).Tilt = 0.0;
+    Surface(2).CosTilt = 1.0;
+
+    for (int panel = 0; panel < NumPanels; ++panel) {
+        auto &surface(Surface(3 + panel));
+        Real64 const x = -5.0 + (panel % 6) * 4.0;
+        Real64 const y = -4.0 + ((panel / 6) % 5) * 4.0;
+        Real64 const z = (panel / 30) * 2.5;
+        surface.Name = "PANEL " + std::to_string(panel + 1);
+        surface.Class = SurfaceClass_Shading;
+        surface.ShadowingSurf = true;
+        surface.Sides = 4;
+        surface.Vertex = {Vertex(x, y + 1.5, z + 2.0), Vertex(x, y + 1.5, z), Vertex(x, y, z), Vertex(x, y, z + 2.0)};
+        surface.OutNormVec = Vertex(-1.0, 0.0, 0.0);
+        surface.Tilt = 90.0;
+        surface.ShadowSurfDiffuseSolRefl = 0.2;
+        surface.ViewFactorSky = 0.5;
+    }
+    for (int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+        Surface(SurfNum).set_computed_geometry();
+    }
+
+    DataEnvironment::GndReflectance = 0.2;
+    DataHeatBalance::DifShdgRatioIsoSky.dimension(TotSurfaces, 1.0);
+    DataHeatBalance::SunlitFrac.dimension(1, 24, TotSurfaces, 1.0);
+    SUNCOSHR.dimension(24, 3, 0.0);
+    std::vector<int> const hours{9, 12, 15};
+    std::vector<Vertex> const sunVecs{Vertex(-0.3, -0.4, 0.8), Vertex(-0.3, 0.2, 0.9), Vertex(0.4, 0.5, 0.6)};
+    for (std::size_t i = 0; i < hours.size(); ++i) {
+        Vertex const sunVec(sunVecs[i].normalized());
+        SUNCOSHR(hours[i], 1) = sunVec.x;
+        SUNCOSHR(hours[i], 2) = sunVec.y;
+        SUNCOSHR(hours[i], 3) = sunVec.z;
+    }
+
+    auto calcReflection = [&]() {
+        InitSolReflRecSurf();
+        for (int const hour : hours) {
+            FigureBeamSolDiffuseReflFactors(hour);
+        }
+        CalcSkySolDiffuseReflFactors();
+    };
+
+    // every surface is tested while the octree is empty
+    calcReflection();
+    EXPECT_FALSE(UseSurfaceOctree);
+    ASSERT_EQ(2, TotSolReflRecSurf);
+    Array1D<SolReflRecSurfData> const surfaceSearch(SolReflRecSurf);
+    Array2D<Real64> const bmToDiffSolObs(ReflFacBmToDiffSolObs);
+    Array2D<Real64> const bmToDiffSolGnd(ReflFacBmToDiffSolGnd);
+    Array1D<Real64> const skySolObs(ReflFacSkySolObs);
+    Array1D<Real64> const skySolGnd(ReflFacSkySolGnd);
+
+    surfaceOctree.init(Surface);
+    calcReflection();
+    EXPECT_TRUE(UseSurfaceOctree);
+
+    int panelHits = 0;
+    for (int RecSurfNum = 1; RecSurfNum <= TotSolReflRecSurf; ++RecSurfNum) {
+        auto const &expected(surfaceSearch(RecSurfNum));
+        auto const &actual(SolReflRecSurf(RecSurfNum));
+        EXPECT_EQ(expected.NumPossibleObs, actual.NumPossibleObs);
+        ASSERT_EQ(expected.NumReflRays, actual.NumReflRays);
+        for (int RecPtNum = 1; RecPtNum <= actual.NumRecPts; ++RecPtNum) {
+            for (int RayNum = 1; RayNum <= actual.NumReflRays; ++RayNum) {
+                EXPECT_EQ(expected.HitPtSurfNum(RayNum, RecPtNum), actual.HitPtSurfNum(RayNum, RecPtNum));
+                EXPECT_DOUBLE_EQ(expected.RecPtHitPtDis(RayNum, RecPtNum), actual.RecPtHitPtDis(RayNum, RecPtNum));
+                if (actual.HitPtSurfNum(RayNum, RecPtNum) > 2) ++panelHits;
+            }
+        }
+    }
+    EXPECT_GT(panelHits, 0);
+
+    for (int SurfNum = 1; SurfNum <= 2; ++SurfNum) {
+        for (int const hour : hours) {
+            EXPECT_DOUBLE_EQ(bmToDiffSolObs(hour, SurfNum), ReflFacBmToDiffSolObs(hour, SurfNum));
+            EXPECT_DOUBLE_EQ(bmToDiffSolGnd(hour, SurfNum), ReflFacBmToDiffSolGnd(hour, SurfNum));
+        }
+        EXPECT_DOUBLE_EQ(skySolObs(SurfNum), ReflFacSkySolObs(SurfNum));
+        EXPECT_DOUBLE_EQ(skySolGnd(SurfNum), ReflFacSkySolGnd(SurfNum));
+    }
+    EXPECT_GT(ReflFacBmToDiffSolObs(12, 1), 0.0);
+    EXPECT_GT(ReflFacSkySolObs(1), 0.0);
+}
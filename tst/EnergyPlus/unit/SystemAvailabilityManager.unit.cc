@@ -283,6 +283,121 @@ TEST_F(EnergyPlusFixture, SysAvailManager_OptimumStart)
     EXPECT_EQ(DataHVACGlobals::CycleOn, SystemAvailabilityManager::OptStartSysAvailMgrData(2).AvailStatus); // avail manager should be set at 6 AM
 }
 
+TEST_F(EnergyPlusFixture, SysAvailManager_OptimumStart_FanStartTimesFollowDaySchedules)
+{
+
+    std::string const idf_objects = delimited_string({
+
+        " AvailabilityManager:OptimumStart,",
+        "   OptStart Availability 1, !- Name",
+        "   Sch_OptStart,            !- Applicability Schedule Name",
+        "   Fan_Schedule,            !- Fan Schedule Name",
+        "   ControlZone,             !- Control Type",
+        "   Zone 1,                  !- Control Zone Name",
+        "   ,                        !- Zone List Name",
+        "   4,                       !- Maximum Value for Optimum Start Time {hr}",
+        "   ConstantStartTime,       !- Control Algorithm",
+        "   ,                        !- Constant Temperature Gradient during Cooling {deltaC/hr}",
+        "   ,                        !- Constant Temperature Gradient during Heating {deltaC/hr}",
+        "   ,                        !- Initial Temperature Gradient during Cooling {deltaC/hr}",
+        "   ,                        !- Initial Temperature Gradient during Heating {deltaC/hr}",
+        "   2,                       !- Constant Start Time {hr}",
+        "   ;                        !- Number of Previous Days {days}",
+
+        " Schedule:Compact,",
+        "   Sch_OptStart,            !- Name",
+        "   Fraction,                !- Schedule Type Limits Name",
+        "   Through: 12/31,          !- Field 1",
+        "   For: AllDays,            !- Field 2",
+        "   Until: 24:00, 1.0;       !- Field 3",
+
+        " Schedule:Compact,",
+        "   Fan_Schedule,            !- Name",
+        "   Fraction,                !- Schedule Type Limits Name",
+        "   Through: 1/31,           !- Field 1",
+        "   For: Weekdays,           !- Field 2",
+        "   Until:  7:00, 0.0,       !- Field 3",
+        "   Until: 24:00, 1.0,       !- Field 5",
+        "   For: Weekends,           !- Field 7",
+        "   Until:  9:00, 0.0,       !- Field 8",
+        "   Until: 24:00, 1.0,       !- Field 10",
+        "   For: Holiday,            !- Field 12",
+        "   Until: 24:00, 0.0,       !- Field 13",
+        "   For: AllOtherDays,       !- Field 15",
+        "   Until: 24:00, 1.0,       !- Field 16",
+        "   Through: 12/31,          !- Field 18",
+        "   For: AllDays,            !- Field 19",
+        "   Until:  5:00, 0.0,       !- Field 20",
+        "   Until: 24:00, 1.0;       !- Field 22",
+    });
+
+    ASSERT_TRUE(process_idf(idf_objects));
+
+    DataGlobals::NumOfZones = 1;
+    DataZoneEquipment::NumOfZones = 1;
+    DataHeatBalance::Zone.allocate(DataGlobals::NumOfZones);
+    DataHeatBalance::Zone(1).Name = "ZONE 1";
+    DataZoneEquipment::ZoneEquipConfig.allocate(DataZoneEquipment::NumOfZones);
+    DataZoneEquipment::ZoneEquipConfig(1).ZoneName = "Zone 1";
+    DataZoneEquipment::ZoneEquipConfig(1).ActualZoneNum = 1;
+
+    DataAirLoop::AirToZoneNodeInfo.allocate(1);
+    DataAirLoop::AirToZoneNodeInfo(1).NumZonesCooled = 1;
+    DataAirLoop::AirToZoneNodeInfo(1).CoolCtrlZoneNums.allocate(1);
+    DataAirLoop::AirToZoneNodeInfo(1).CoolCtrlZoneNums(1) = 1;
+
+    DataGlobals::NumOfTimeStepInHour = 1; // must initialize this to get schedules initialized
+    DataGlobals::MinutesPerTimeStep = 60; // must initialize this to get schedules initialized
+    ScheduleManager::ProcessScheduleInput();
+    ScheduleManager::ScheduleInputProcessed = true;
+
+    SystemAvailabilityManager::GetSysAvailManagerInputs();
+    auto &OptStartMgr(SystemAvailabilityManager::OptStartSysAvailMgrData(1));
+
+    DataGlobals::BeginDayFlag = false;
+    DataGlobals::CurrentTime = 1.0;
+    DataEnvironment::DSTIndicator = 0;
+
+    int AvailStatus(0);
+    auto simulateDay = [&](int const dayOfYear, int const dayOfWeek, int const holidayIndex) {
+        DataEnvironment::DayOfYear = dayOfYear;
+        DataEnvironment::DayOfYear_Schedule = dayOfYear;
+        DataEnvironment::DayOfWeek = dayOfWeek;
+        DataEnvironment::DayOfWeekTomorrow = dayOfWeek % 7 + 1;
+        DataEnvironment::HolidayIndex = holidayIndex;
+        // every system timestep of the day uses the same fan start times
+        for (int step = 1; step <= 3; ++step) {
+            OptStartMgr.isSimulated = false;
+            SystemAvailabilityManager::CalcOptStartSysAvailMgr(1, 1, AvailStatus);
+        }
+    };
+
+    // January 10th is a Monday; the fan comes on at 7:00 today and tomorrow
+    simulateDay(10, 2, 0);
+    EXPECT_EQ(8.0, OptStartMgr.FanStartTime);
+    EXPECT_EQ(8.0, OptStartMgr.FanStartTimeTmr);
+
+    // a new day of year with the same day of week moves tomorrow into the February schedule
+    simulateDay(31, 2, 0);
+    EXPECT_EQ(8.0, OptStartMgr.FanStartTime);
+    EXPECT_EQ(6.0, OptStartMgr.FanStartTimeTmr);
+
+    // a new day of week on the same day of year switches today to the weekend day schedule
+    simulateDay(31, 1, 0);
+    EXPECT_EQ(10.0, OptStartMgr.FanStartTime);
+    EXPECT_EQ(6.0, OptStartMgr.FanStartTimeTmr);
+
+    // a holiday on the same day switches today to the holiday day schedule, where the fan stays off
+    simulateDay(31, 1, 1);
+    EXPECT_EQ(0.0, OptStartMgr.FanStartTime);
+    EXPECT_EQ(6.0, OptStartMgr.FanStartTimeTmr);
+
+    // and back again once the holiday is over
+    simulateDay(31, 1, 0);
+    EXPECT_EQ(10.0, OptStartMgr.FanStartTime);
+    EXPECT_EQ(6.0, OptStartMgr.FanStartTimeTmr);
+}
+
 TEST_F(EnergyPlusFixture, SysAvailManager_NightCycle_ZoneOutOfTolerance)
 {
     int NumZones(4);
@@ -359,4 +359,147 @@ TEST_F(EnergyPlusFixture, Test_UnitaryHybridAirConditioner_Unittest)
     EXPECT_GT(Tsa, Tra);
 }
 
+TEST_F(EnergyPlusFixture, Test_UnitaryHybridAirConditioner_CurveCacheMatchesCurveEvaluation)
+{
+    std::vector<std::string> snippet = getAllLinesInFile2(configured_source_directory() + "/tst/EnergyPlus/unit/UnitaryHybridUnitTest_DOSA.idf");
+    std::string string = delimited_string(snippet);
+    ASSERT_TRUE(process_idf(string));
+    // setup environment
+    bool ErrorsFound(false);
+    GetZoneData(ErrorsFound);
+    EXPECT_FALSE(ErrorsFound);
+    DataGlobals::TimeStep = 1;
+    DataHVACGlobals::TimeStepSys = 1;
+    DataGlobals::NumOfTimeStepInHour = 1;
+    DataGlobals::MinutesPerTimeStep = 60;
+    DataEnvironment::Month = 1;
+    DataEnvironment::DayOfMonth = 21;
+    DataGlobals::HourOfDay = 1;
+    DataEnvironment::DSTIndicator = 0;
+    DataEnvironment::DayOfWeek = 2;
+    DataEnvironment::HolidayIndex = 0;
+    DataGlobals::WarmupFlag = false;
+    DataEnvironment::DayOfYear_Schedule = General::OrdinalDay(Month, DayOfMonth, 1);
+    DataHeatBalance::Zone(1).FloorArea = 232.26;
+    DataEnvironment::StdRhoAir = 1.225;
+    DataHeatBalance::ZoneIntGain.allocate(1);
+    SizingManager::GetOARequirements();
+    GetOAControllerInputs();
+    ProcessScheduleInput();
+    UpdateScheduleValues();
+    GetInputZoneHybridUnitaryAirConditioners(ErrorsFound);
+    EXPECT_FALSE(ErrorsFound);
+    InitZoneHybridUnitaryAirConditioners(1, 1);
+    Model *pZoneHybridUnitaryAirConditioner = &HybridUnitaryAirConditioners::ZoneHybridUnitaryAirConditioner(1);
+
+    // curve types as numbered in HybridEvapCoolingModel
+    int const TempCurve(0), WCurve(1), PowerCurve(2), SupplyFanPower(3), ExternalStaticPressure(4), SecondFuelUse(5), ThirdFuelUse(6),
+        WaterUse(7);
+
+    Real64 const DesignMinVR = 1.622720855;
+    Real64 const Requestedheating = -122396.255;
+    Real64 const RequestedCooling = -58469.99445;
+    Real64 const Requested_Humidification = 0.0;
+    Real64 const Requested_Dehumidification = 0.0;
+    Real64 const Tra = 22.93929413;
+    Real64 const RHra = 17.3042157;
+    Real64 const RHosa = 13.1602401;
+
+    struct StepResults
+    {
+        int PrimaryMode;
+        Real64 PrimaryModeRuntimeFraction;
+        Real64 OutletTemp;
+        Real64 OutletHumRat;
+        Real64 OutletMassFlowRate;
+        Real64 FinalElectricalPower;
+        Real64 SupplyFanElectricPower;
+        Real64 WaterConsumptionRate;
+        Real64 ExternalStaticPressure;
+    };
+
+    auto runStep = [&](Real64 const Tosa) {
+        pZoneHybridUnitaryAirConditioner->InletTemp = Tra;
+        pZoneHybridUnitaryAirConditioner->InletHumRat = PsyWFnTdbRhPb(Tra, RHra / 100, 101325);
+        pZoneHybridUnitaryAirConditioner->InletEnthalpy = PsyHFnTdbRhPb(Tra, RHra / 100, 101325, "test");
+        pZoneHybridUnitaryAirConditioner->InletPressure = 101325;
+        pZoneHybridUnitaryAirConditioner->InletRH = RHra / 100;
+        pZoneHybridUnitaryAirConditioner->SecInletTemp = Tosa;
+        pZoneHybridUnitaryAirConditioner->SecInletHumRat = PsyWFnTdbRhPb(Tosa, RHosa / 100, 101325);
+        pZoneHybridUnitaryAirConditioner->SecInletEnthalpy = PsyHFnTdbRhPb(Tosa, RHosa / 100, 101325, "test");
+        pZoneHybridUnitaryAirConditioner->SecInletPressure = 101325;
+        pZoneHybridUnitaryAirConditioner->SecInletRH = RHosa / 100;
+        pZoneHybridUnitaryAirConditioner->Initialize(1);
+        pZoneHybridUnitaryAirConditioner->InitializeModelParams();
+        pZoneHybridUnitaryAirConditioner->doStep(
+            RequestedCooling, Requestedheating, Requested_Humidification, Requested_Dehumidification, DesignMinVR);
+        return StepResults{pZoneHybridUnitaryAirConditioner->PrimaryMode,
+                           pZoneHybridUnitaryAirConditioner->PrimaryModeRuntimeFraction,
+                           pZoneHybridUnitaryAirConditioner->OutletTemp,
+                           pZoneHybridUnitaryAirConditioner->OutletHumRat,
+                           pZoneHybridUnitaryAirConditioner->OutletMassFlowRate,
+                           pZoneHybridUnitaryAirConditioner->FinalElectricalPower,
+                           pZoneHybridUnitaryAirConditioner->SupplyFanElectricPower,
+                           pZoneHybridUnitaryAirConditioner->WaterConsumptionRate,
+                           pZoneHybridUnitaryAirConditioner->ExternalStaticPressure};
+    };
+
+    // every candidate setting must carry the same curve results as evaluating its mode's curves directly
+    auto checkSettings = [&](Real64 const Tosa) {
+        Real64 const Wosa = PsyWFnTdbRhPb(Tosa, RHosa / 100, 101325);
+        Real64 const Wra = PsyWFnTdbRhPb(Tra, RHra / 100, 101325);
+        ASSERT_FALSE(pZoneHybridUnitaryAirConditioner->Settings.empty());
+        for (auto const &thisSetting : pZoneHybridUnitaryAirConditioner->Settings) {
+            CMode &Mode = pZoneHybridUnitaryAirConditioner->OperatingModes[thisSetting.Mode];
+            Real64 const UnscaledMsa = thisSetting.Unscaled_Supply_Air_Mass_Flow_Rate;
+            Real64 const OSAF = thisSetting.Outdoor_Air_Fraction;
+            EXPECT_DOUBLE_EQ(Mode.CalculateCurveVal(Tosa, Wosa, Tra, Wra, UnscaledMsa, OSAF, TempCurve), thisSetting.SupplyAirTemperature);
+            EXPECT_DOUBLE_EQ(Mode.CalculateCurveVal(Tosa, Wosa, Tra, Wra, UnscaledMsa, OSAF, PowerCurve), thisSetting.ElectricalPower);
+            EXPECT_DOUBLE_EQ(Mode.CalculateCurveVal(Tosa, Wosa, Tra, Wra, UnscaledMsa, OSAF, SupplyFanPower), thisSetting.SupplyFanElectricPower);
+            EXPECT_DOUBLE_EQ(Mode.CalculateCurveVal(Tosa, Wosa, Tra, Wra, UnscaledMsa, OSAF, ExternalStaticPressure),
+                             thisSetting.ExternalStaticPressure);
+            EXPECT_DOUBLE_EQ(Mode.CalculateCurveVal(Tosa, Wosa, Tra, Wra, UnscaledMsa, OSAF, SecondFuelUse),
+                             thisSetting.SecondaryFuelConsumptionRate);
+            EXPECT_DOUBLE_EQ(Mode.CalculateCurveVal(Tosa, Wosa, Tra, Wra, UnscaledMsa, OSAF, ThirdFuelUse), thisSetting.ThirdFuelConsumptionRate);
+            EXPECT_DOUBLE_EQ(Mode.CalculateCurveVal(Tosa, Wosa, Tra, Wra, UnscaledMsa, OSAF, WaterUse), thisSetting.WaterConsumptionRate);
+            Real64 const Wsa = Mode.CalculateCurveVal(Tosa, Wosa, Tra, Wra, UnscaledMsa, OSAF, WCurve);
+            Real64 const OutletPressure = pZoneHybridUnitaryAirConditioner->OutletPressure;
+            EXPECT_DOUBLE_EQ(pZoneHybridUnitaryAirConditioner->CheckVal_W(Wsa, thisSetting.SupplyAirTemperature, OutletPressure),
+                             thisSetting.SupplyAirW);
+        }
+    };
+
+    auto expectSameResults = [](StepResults const &expected, StepResults const &actual) {
+        EXPECT_EQ(expected.PrimaryMode, actual.PrimaryMode);
+        EXPECT_DOUBLE_EQ(expected.PrimaryModeRuntimeFraction, actual.PrimaryModeRuntimeFraction);
+        EXPECT_DOUBLE_EQ(expected.OutletTemp, actual.OutletTemp);
+        EXPECT_DOUBLE_EQ(expected.OutletHumRat, actual.OutletHumRat);
+        EXPECT_DOUBLE_EQ(expected.OutletMassFlowRate, actual.OutletMassFlowRate);
+        EXPECT_DOUBLE_EQ(expected.FinalElectricalPower, actual.FinalElectricalPower);
+        EXPECT_DOUBLE_EQ(expected.SupplyFanElectricPower, actual.SupplyFanElectricPower);
+        EXPECT_DOUBLE_EQ(expected.WaterConsumptionRate, actual.WaterConsumptionRate);
+        EXPECT_DOUBLE_EQ(expected.ExternalStaticPressure, actual.ExternalStaticPressure);
+    };
+
+    Real64 const TosaHot = 26.67733333;
+    Real64 const TosaHotter = 28.0;
+
+    // first call at these conditions fills the cache
+    StepResults const firstHot = runStep(TosaHot);
+    checkSettings(TosaHot);
+    EXPECT_GT(firstHot.PrimaryMode, 0);
+
+    // repeated call reuses the cached curve results
+    StepResults const repeatHot = runStep(TosaHot);
+    checkSettings(TosaHot);
+    expectSameResults(firstHot, repeatHot);
+
+    // new conditions invalidate the cache, and returning to the earlier conditions gives the earlier selection again
+    runStep(TosaHotter);
+    checkSettings(TosaHotter);
+    StepResults const returnHot = runStep(TosaHot);
+    checkSettings(TosaHot);
+    expectSameResults(firstHot, returnHot);
+}
+
 } // namespace EnergyPlus
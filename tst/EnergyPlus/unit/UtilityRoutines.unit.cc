@@ -121,6 +121,37 @@ TEST_F(EnergyPlusFixture, RecurringWarningTest)
     EXPECT_EQ(" ** Warning ** " + myMessage4, DataErrorTracking::RecurringErrors(5).Message);
 }
 
+TEST_F(EnergyPlusFixture, RecurringWarningLookupTest)
+{
+    int ErrIndex1 = 0;
+    ShowRecurringWarningErrorAtEnd("Test message 1", ErrIndex1, 2.0, 2.0);
+    EXPECT_EQ(1, ErrIndex1);
+    EXPECT_EQ(1, FindRecurringErrorMessage(" ** Warning ** ", "Test message 1", ErrIndex1));
+    EXPECT_EQ(0, FindRecurringErrorMessage(" ** Severe  ** ", "Test message 1", ErrIndex1));
+
+    int ErrIndex2 = 0;
+    ShowRecurringWarningErrorAtEnd("Test message 2", ErrIndex2);
+    EXPECT_EQ(2, ErrIndex2);
+
+    // messages are matched without regard to case, and a stale index is corrected
+    ErrIndex2 = 1;
+    ShowRecurringWarningErrorAtEnd("TEST MESSAGE 2", ErrIndex2);
+    EXPECT_EQ(2, ErrIndex2);
+    EXPECT_EQ(2, DataErrorTracking::RecurringErrors(2).Count);
+    EXPECT_EQ(2u, DataErrorTracking::RecurringErrors.size());
+
+    // repeat calls with the assigned index update the statistics in place
+    ShowRecurringWarningErrorAtEnd("Test message 1", ErrIndex1, 5.0, 1.0);
+    EXPECT_EQ(1, ErrIndex1);
+    EXPECT_EQ(2, DataErrorTracking::RecurringErrors(1).Count);
+    EXPECT_DOUBLE_EQ(5.0, DataErrorTracking::RecurringErrors(1).MaxValue);
+    EXPECT_DOUBLE_EQ(1.0, DataErrorTracking::RecurringErrors(1).MinValue);
+
+    DataErrorTracking::clear_state();
+    EXPECT_EQ(0u, DataErrorTracking::RecurringErrors.size());
+    EXPECT_EQ(0, FindRecurringErrorMessage(" ** Warning ** ", "Test message 1", 1));
+}
+
 TEST_F(EnergyPlusFixture, DisplayMessageTest)
 {
     DisplayString("Testing");
@@ -141,3 +172,14 @@ TEST_F(EnergyPlusFixture, DisplayMessageTest)
     DisplayString("Testing");
     EXPECT_TRUE(has_cout_output(true));
 }
+
+TEST_F(EnergyPlusFixture, TimeOutputSinkTest)
+{
+    int NumWrites(0);
+    TimeOutputSink("test output", [&]() { ++NumWrites; });
+    EXPECT_EQ(1, NumWrites);
+    EXPECT_TRUE(has_cout_output(true));
+
+    // errors are not caught, so fatal errors still end the run
+    EXPECT_THROW(TimeOutputSink("test output", []() { ShowFatalError("TimeOutputSinkTest: write failed"); }), std::runtime_error);
+}
@@ -166,6 +166,42 @@ TEST_F(EnergyPlusFixture, WaterMainsCorrelationTest)
     EXPECT_NEAR(WaterMainsTemp, 19.3799, 0.0001);
 }
 
+TEST_F(EnergyPlusFixture, WaterMainsCorrelation_ReuseMatchesEvaluation)
+{
+    using DataEnvironment::DayOfYear;
+    using DataEnvironment::Latitude;
+
+    // Evaluate each day without any previous result to reuse
+    Array1D<Real64> northTemps(365);
+    Array1D<Real64> southTemps(365);
+    for (int day = 1; day <= 365; ++day) {
+        DayOfYear = day;
+        WeatherManager::clear_state();
+        Latitude = 40.0;
+        northTemps(day) = WaterMainsTempFromCorrelation(9.69, 28.1);
+        WeatherManager::clear_state();
+        Latitude = -40.0;
+        southTemps(day) = WaterMainsTempFromCorrelation(9.69, 28.1);
+    }
+
+    // Repeated timesteps of a day reuse the result; any change in the inputs is evaluated again
+    for (int day = 1; day <= 365; ++day) {
+        DayOfYear = day;
+        for (int timeStep = 1; timeStep <= 4; ++timeStep) {
+            Latitude = 40.0;
+            EXPECT_DOUBLE_EQ(northTemps(day), WaterMainsTempFromCorrelation(9.69, 28.1));
+            EXPECT_DOUBLE_EQ(northTemps(day), WaterMainsTempFromCorrelation(9.69, 28.1));
+            Latitude = -40.0;
+            EXPECT_DOUBLE_EQ(southTemps(day), WaterMainsTempFromCorrelation(9.69, 28.1));
+        }
+    }
+
+    DayOfYear = 50;
+    Latitude = 40.0;
+    EXPECT_NEAR(WaterMainsTempFromCorrelation(9.69, 28.1), 6.6667, 0.0001);
+    EXPECT_GT(WaterMainsTempFromCorrelation(20.0, 28.1), 6.6667);
+}
+
 TEST_F(EnergyPlusFixture, JGDate_Test)
 {
     // used http://aa.usno.navy.mil/data/docs/JulianDate.php
@@ -678,3 +714,66 @@ TEST_F(EnergyPlusFixture, WeatherManager_NoLocation) {
     EXPECT_EQ(1, WeatherManager::NumOfEnvrn);
     EXPECT_EQ(WeatherManager::Environment(1).KindOfEnvrn, DataGlobals::ksDesignDay);
 }
+
+TEST_F(EnergyPlusFixture, WeatherManager_SolarGeometryTable)
+{
+    DataEnvironment::Latitude = 40.0;
+    DataEnvironment::Longitude = -105.0;
+    DataEnvironment::TimeZoneMeridian = -105.0;
+    DataEnvironment::SinLatitude = std::sin(DataEnvironment::Latitude * DataGlobals::DegToRadians);
+    DataEnvironment::CosLatitude = std::cos(DataEnvironment::Latitude * DataGlobals::DegToRadians);
+    DataGlobals::NumOfTimeStepInHour = 4;
+
+    // Daily coefficients are served from the table on the second call and recomputed when the hemisphere changes
+    Real64 A, B, C, AVSC, EqOfTime, SinDecl, CosDecl;
+    CalculateDailySolarCoeffs(172, A, B, C, AVSC, EqOfTime, SinDecl, CosDecl);
+    EXPECT_TRUE(SolarGeometryTable(172).CoeffsValid);
+    EXPECT_EQ(SinDecl, SolarGeometryTable(172).SinSolarDeclinAngle);
+    Real64 A2, B2, C2, AVSC2, EqOfTime2, SinDecl2, CosDecl2;
+    CalculateDailySolarCoeffs(172, A2, B2, C2, AVSC2, EqOfTime2, SinDecl2, CosDecl2);
+    EXPECT_EQ(A, A2);
+    EXPECT_EQ(B, B2);
+    EXPECT_EQ(C, C2);
+    EXPECT_EQ(EqOfTime, EqOfTime2);
+    EXPECT_EQ(CosDecl, CosDecl2);
+    DataEnvironment::Latitude = -40.0;
+    CalculateDailySolarCoeffs(172, A2, B2, C2, AVSC2, EqOfTime2, SinDecl2, CosDecl2);
+    EXPECT_TRUE(SolarGeometryTable(172).SouthernHemisphere);
+    EXPECT_NE(B, B2);
+    EXPECT_EQ(SinDecl, SinDecl2);
+    DataEnvironment::Latitude = 40.0;
+
+    TodayVariables.DayOfYear = 172;
+    TodayVariables.EquationOfTime = EqOfTime;
+    TodayVariables.SinSolarDeclinAngle = SinDecl;
+    TodayVariables.CosSolarDeclinAngle = CosDecl;
+    DataGlobals::TimeStep = 2;
+    DataGlobals::HourOfDay = 13;
+    DataGlobals::CurrentTime = 12.5;
+    DetermineSunUpDown(DataEnvironment::SOLCOS);
+    EXPECT_TRUE(DataEnvironment::SunIsUp);
+    Real64 const Altitude(SolarAltitudeAngle);
+    Real64 const Azimuth(SolarAzimuthAngle);
+    Real64 const CosZenith(DataEnvironment::SOLCOS(3));
+    auto &slot(SolarGeometryTable(172).SunPosition(2, 13));
+    EXPECT_TRUE(slot.Valid);
+    EXPECT_EQ(Altitude, slot.SolarAltitudeAngle);
+    EXPECT_EQ(CosZenith, slot.SunDirectionCosines[2]);
+
+    // A repeated day (warmup or another environment) takes the sun position from the table
+    slot.SolarAltitudeAngle = 99.0;
+    DetermineSunUpDown(DataEnvironment::SOLCOS);
+    EXPECT_EQ(99.0, SolarAltitudeAngle);
+    EXPECT_EQ(Azimuth, SolarAzimuthAngle);
+
+    // A different hour angle for the same slot recomputes it
+    DataGlobals::CurrentTime = 12.25;
+    DetermineSunUpDown(DataEnvironment::SOLCOS);
+    EXPECT_NE(99.0, SolarAltitudeAngle);
+    EXPECT_EQ(SolarAltitudeAngle, slot.SolarAltitudeAngle);
+    DataGlobals::CurrentTime = 12.5;
+    DetermineSunUpDown(DataEnvironment::SOLCOS);
+    EXPECT_EQ(Altitude, SolarAltitudeAngle);
+    EXPECT_EQ(Azimuth, SolarAzimuthAngle);
+    EXPECT_EQ(CosZenith, DataEnvironment::SOLCOS(3));
+}
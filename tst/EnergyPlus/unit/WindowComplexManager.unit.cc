@@ -0,0 +1,200 @@
+// EnergyPlus, Copyright (c) 1996-2019, The Board of Trustees of the University of Illinois,
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy), Oak Ridge
+// National Laboratory, managed by UT-Battelle, Alliance for Sustainable Energy, LLC, and other
+// contributors. All rights reserved.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without the U.S. Department of Energy's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+// EnergyPlus::WindowComplexManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataBSDFWindow.hh>
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/WindowComplexManager.hh>
+
+#include "Fixtures/EnergyPlusFixture.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataBSDFWindow;
+using namespace EnergyPlus::DataSurfaces;
+using namespace EnergyPlus::WindowComplexManager;
+
+TEST_F(EnergyPlusFixture, WindowComplexManager_SharedBeamGeometryMatchesStateCalculation)
+{
+    // A south facing complex fenestration window with two states on the same basis sits below an overhang that
+    // shades part of the ground in front of it. The sun ray lookups and ground shading taken from the first state
+    // must be identical to the ones calculated for the second state on its own.
+    using Vertex = Vector3<Real64>;
+    DataGlobals::NumOfTimeStepInHour = 1;
+    TotSurfaces = 2;
+    Surface.allocate(TotSurfaces);
+
+    auto &window(Surface(1));
+    window.Name = "WINDOW";
+    window.Class = SurfaceClass_Window;
+    window.HeatTransSurf = true;
+    window.ExtBoundCond = ExternalEnvironment;
+    window.Sides = 4;
+    window.Vertex = {Vertex(0.0, 0.0, 2.0), Vertex(0.0, 0.0, 0.5), Vertex(2.0, 0.0, 0.5), Vertex(2.0, 0.0, 2.0)};
+    window.Tilt = 90.0;
+    window.Azimuth = 180.0;
+    window.NewellSurfaceNormalVector = Vertex(0.0, -1.0, 0.0);
+
+    auto &overhang(Surface(2));
+    overhang.Name = "OVERHANG";
+    overhang.Class = SurfaceClass_Shading;
+    overhang.HeatTransSurf = false;
+    overhang.Sides = 4;
+    overhang.Vertex = {Vertex(-1.0, -2.0, 2.5), Vertex(3.0, -2.0, 2.5), Vertex(3.0, -4.0, 2.5), Vertex(-1.0, -4.0, 2.5)};
+    overhang.Tilt = 180.0;
+    overhang.NewellSurfaceNormalVector = Vertex(0.0, 0.0, -1.0);
+
+    for (int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum) {
+        Surface(SurfNum).set_computed_geometry();
+    }
+
+    // Window6 type basis with 0, 30 and 60 degree theta rings
+    DataHeatBalance::TotConstructs = 2;
+    DataHeatBalance::Construct.allocate(DataHeatBalance::TotConstructs);
+    for (int ConstrNum = 1; ConstrNum <= DataHeatBalance::TotConstructs; ++ConstrNum) {
+        auto &bsdfInput(DataHeatBalance::Construct(ConstrNum).BSDFInput);
+        bsdfInput.BasisType = BasisType_WINDOW;
+        bsdfInput.BasisSymmetryType = BasisSymmetry_None;
+        bsdfInput.BasisMatIndex = 1;
+        bsdfInput.BasisMatNrows = 3;
+        bsdfInput.BasisMatNcols = 2;
+        bsdfInput.NBasis = 13;
+        bsdfInput.BasisMat.allocate(2, 3);
+        bsdfInput.BasisMat(1, 1) = 0.0;
+        bsdfInput.BasisMat(2, 1) = 1.0;
+        bsdfInput.BasisMat(1, 2) = 30.0;
+        bsdfInput.BasisMat(2, 2) = 4.0;
+        bsdfInput.BasisMat(1, 3) = 60.0;
+        bsdfInput.BasisMat(2, 3) = 8.0;
+    }
+
+    std::vector<Vertex> const gndPts{Vertex(1.0, -1.0, 0.0), Vertex(1.0, -3.0, 0.0), Vertex(4.0, -1.5, 0.0), Vertex(1.0, -6.0, 0.0)};
+    int const NumStates = 3;
+    ComplexWind.allocate(TotSurfaces);
+    ComplexWind(1).NumStates = NumStates;
+    ComplexWind(1).Geom.allocate(NumStates);
+    for (int iState = 1; iState <= NumStates; ++iState) {
+        auto &geom(ComplexWind(1).Geom(iState));
+        ConstructBasis(iState == 1 ? 1 : 2, geom.Inc);
+        geom.NGnd = gndPts.size();
+        geom.GndPt.allocate(geom.NGnd);
+        for (int I = 1; I <= geom.NGnd; ++I) {
+            geom.GndPt(I) = gndPts[I - 1];
+        }
+        geom.SolBmGndWt.allocate(24, DataGlobals::NumOfTimeStepInHour, geom.NGnd);
+        geom.SolBmIndex.allocate(24, DataGlobals::NumOfTimeStepInHour);
+        geom.ThetaBm.allocate(24, DataGlobals::NumOfTimeStepInHour);
+        geom.PhiBm.allocate(24, DataGlobals::NumOfTimeStepInHour);
+    }
+
+    // The same basis matrix and ground points, so both later states can take the first state's beam geometry
+    EXPECT_EQ(0, FindCFSStateWithSameBeamGeometry(1, 1));
+    EXPECT_EQ(1, FindCFSStateWithSameBeamGeometry(1, 2));
+    EXPECT_EQ(1, FindCFSStateWithSameBeamGeometry(1, 3));
+
+    // Sun path at 40 degrees latitude on an equinox
+    Real64 const sinLat = std::sin(40.0 * DataGlobals::DegToRadians);
+    Real64 const cosLat = std::cos(40.0 * DataGlobals::DegToRadians);
+    SUNCOSTS = 0.0;
+    for (int Hour = 1; Hour <= 24; ++Hour) {
+        Real64 const hourAngle = (Hour - 12.5) * 15.0 * DataGlobals::DegToRadians;
+        SUNCOSTS(1, Hour, 1) = -std::sin(hourAngle);
+        SUNCOSTS(1, Hour, 2) = -sinLat * std::cos(hourAngle);
+        SUNCOSTS(1, Hour, 3) = cosLat * std::cos(hourAngle);
+    }
+
+    auto &firstGeom(ComplexWind(1).Geom(1));
+    auto &sharedGeom(ComplexWind(1).Geom(2));
+    auto &ownGeom(ComplexWind(1).Geom(3));
+    for (int Hour = 1; Hour <= 24; ++Hour) {
+        CalcCFSBeamGeometry(1, 1, firstGeom, Hour, 1);
+        CopyCFSBeamGeometry(firstGeom, sharedGeom, Hour, 1);
+        CalcCFSBeamGeometry(1, 3, ownGeom, Hour, 1);
+    }
+
+    int NumSunlitHours(0);
+    int NumShadedGndPts(0);
+    int NumSunlitGndPts(0);
+    for (int Hour = 1; Hour <= 24; ++Hour) {
+        EXPECT_EQ(ownGeom.SolBmIndex(Hour, 1), sharedGeom.SolBmIndex(Hour, 1));
+        EXPECT_DOUBLE_EQ(ownGeom.ThetaBm(Hour, 1), sharedGeom.ThetaBm(Hour, 1));
+        EXPECT_DOUBLE_EQ(ownGeom.PhiBm(Hour, 1), sharedGeom.PhiBm(Hour, 1));
+        if (sharedGeom.SolBmIndex(Hour, 1) > 0) ++NumSunlitHours;
+        for (int I = 1; I <= ownGeom.NGnd; ++I) {
+            EXPECT_DOUBLE_EQ(ownGeom.SolBmGndWt(Hour, 1, I), sharedGeom.SolBmGndWt(Hour, 1, I));
+            if (SUNCOSTS(1, Hour, 3) <= DataEnvironment::SunIsUpValue) continue;
+            if (sharedGeom.SolBmGndWt(Hour, 1, I) > 0.0) {
+                ++NumSunlitGndPts;
+            } else {
+                ++NumShadedGndPts;
+            }
+        }
+    }
+    // the comparison covers sunlit and unlit hours as well as shaded and sunlit ground points
+    EXPECT_GT(NumSunlitHours, 0);
+    EXPECT_LT(NumSunlitHours, 24);
+    EXPECT_GT(NumShadedGndPts, 0);
+    EXPECT_GT(NumSunlitGndPts, 0);
+
+    // A state on a different basis or with different ground points has to be calculated on its own
+    ComplexWind(1).Geom(3).Inc.BasisMatIndex = 2;
+    EXPECT_EQ(0, FindCFSStateWithSameBeamGeometry(1, 3));
+    ComplexWind(1).Geom(3).Inc.BasisMatIndex = 1;
+    ComplexWind(1).Geom(3).GndPt(2) = Vertex(1.0, -3.5, 0.0);
+    EXPECT_EQ(0, FindCFSStateWithSameBeamGeometry(1, 3));
+
+    ComplexWind.deallocate();
+    SUNCOSTS = 0.0;
+}
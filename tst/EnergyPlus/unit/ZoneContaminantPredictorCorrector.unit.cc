@@ -833,3 +833,33 @@ TEST_F(EnergyPlusFixture, ZoneContaminantPredictorCorrector_MultiZoneGCControlTe
     EXPECT_NEAR(20.887992514, DataContaminantBalance::GCPredictedRate(2), 0.00001);
     EXPECT_NEAR(21.251538064, DataContaminantBalance::GCPredictedRate(3), 0.00001);
 }
+
+TEST_F(EnergyPlusFixture, ZoneContaminantPredictorCorrector_SetupZoneAirSources)
+{
+    DataGlobals::NumOfZones = 3;
+    DataHeatBalance::Zone.allocate(3);
+    DataZoneEquipment::ZoneEquipConfig.allocate(3);
+    DataHeatBalance::Zone(1).IsControlled = true;
+    DataHeatBalance::Zone(2).IsControlled = false;
+    DataHeatBalance::Zone(3).IsControlled = false;
+    DataZoneEquipment::ZoneEquipConfig(1).ActualZoneNum = 1;
+
+    ZonePlenum::NumZoneReturnPlenums = 1;
+    ZonePlenum::ZoneRetPlenCond.allocate(1);
+    ZonePlenum::ZoneRetPlenCond(1).ActualZoneNum = 2;
+
+    SetupZoneAirSources();
+    EXPECT_EQ(1, ZoneAirSourceEquipConfigNum(1));
+    EXPECT_EQ(0, ZoneAirSourceEquipConfigNum(2));
+    EXPECT_EQ(0, ZoneAirSourceEquipConfigNum(3));
+    EXPECT_EQ(1, ZoneAirSourceRetPlenumNum(2));
+    EXPECT_EQ(0, ZoneAirSourceSupPlenumNum(3));
+
+    // a supply plenum read after the first correct step is picked up
+    ZonePlenum::NumZoneSupplyPlenums = 1;
+    ZonePlenum::ZoneSupPlenCond.allocate(1);
+    ZonePlenum::ZoneSupPlenCond(1).ActualZoneNum = 3;
+    SetupZoneAirSources();
+    EXPECT_EQ(1, ZoneAirSourceSupPlenumNum(3));
+    EXPECT_EQ(1, ZoneAirSourceRetPlenumNum(2));
+}